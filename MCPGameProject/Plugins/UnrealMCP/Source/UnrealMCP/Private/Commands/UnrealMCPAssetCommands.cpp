@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPAssetCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "MCPAssetNameIndex.h"
 #include "EditorAssetLibrary.h"
 #if ENGINE_MAJOR_VERSION >= 5
 #include "Subsystems/AssetEditorSubsystem.h"
@@ -22,20 +23,51 @@
 #include "Factories/DataTableFactory.h"
 #include "UObject/SavePackage.h"
 #include "Misc/PackageName.h"
+#include "Async/Async.h"
+#include "Algo/AnyOf.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
 
-FUnrealMCPAssetCommands::FUnrealMCPAssetCommands()
+/**
+ * Asset registry accessor usable from any thread. The module manager may only be
+ * touched on the game thread, so UE5 goes through the registry singleton.
+ */
+static IAssetRegistry& GetAssetRegistry()
+{
+#if ENGINE_MAJOR_VERSION >= 5
+    return *IAssetRegistry::Get();
+#else
+    return FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+#endif
+}
+
+FUnrealMCPAssetCommands::FUnrealMCPAssetCommands(TSharedPtr<FMCPAssetNameIndex, ESPMode::ThreadSafe> InNameIndex)
+    : NameIndex(MoveTemp(InNameIndex))
 {
 }
 
 void FUnrealMCPAssetCommands::RegisterCommands(FMCPCommandRegistry& Registry)
 {
+#if ENGINE_MAJOR_VERSION >= 5
+    // Registry query: safe on the server thread once the initial scan has finished;
+    // short class names are still resolved on the game thread (see AddClassToFilter).
+    Registry.RegisterCommand(TEXT("list_assets"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleListAssets(P); },
+        []() { return !GetAssetRegistry().IsLoadingAssets(); });
+#else
     Registry.RegisterCommand(TEXT("list_assets"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleListAssets(P); });
+#endif
     Registry.RegisterCommand(TEXT("find_asset"),
-        [this](const TSharedPtr<FJsonObject>& P) { return HandleFindAsset(P); });
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleFindAsset(P); },
+        [this]() { return NameIndex.IsValid() && NameIndex->IsReady(); });
+    Registry.RegisterCommand(TEXT("get_asset_dependencies"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleGetAssetDependencies(P); },
+        []() { return !GetAssetRegistry().IsLoadingAssets(); });
+    Registry.RegisterCommand(TEXT("get_asset_referencers"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleGetAssetReferencers(P); },
+        []() { return !GetAssetRegistry().IsLoadingAssets(); });
     Registry.RegisterCommand(TEXT("does_asset_exist"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleDoesAssetExist(P); });
     Registry.RegisterCommand(TEXT("get_asset_info"),
@@ -70,67 +102,281 @@ void FUnrealMCPAssetCommands::RegisterCommands(FMCPCommandRegistry& Registry)
 // Asset Registry queries
 // ---------------------------------------------------------------------------
 
-TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleListAssets(const TSharedPtr<FJsonObject>& Params)
+enum class EMCPAssetField : uint32
 {
-    FString DirectoryPath = TEXT("/Game/");
-    Params->TryGetStringField(TEXT("path"), DirectoryPath);
-
-    bool bRecursive = true;
-    if (Params->HasField(TEXT("recursive")))
+    None        = 0,
+    Path        = 1 << 0,   // object path, e.g. /Game/Foo/Bar.Bar
+    Name        = 1 << 1,
+    Class       = 1 << 2,   // short class name
+    ClassPath   = 1 << 3,   // full class path, e.g. /Script/Engine.StaticMesh
+    Package     = 1 << 4,
+    PackagePath = 1 << 5,   // containing folder
+    Tags        = 1 << 6,
+    Default     = Path | Name | Class | Package,
+};
+ENUM_CLASS_FLAGS(EMCPAssetField);
+
+static EMCPAssetField ParseAssetFields(const TSharedPtr<FJsonObject>& Params, FString& OutError)
+{
+    const TArray<TSharedPtr<FJsonValue>>* FieldArray = nullptr;
+    if (!Params->TryGetArrayField(TEXT("fields"), FieldArray))
     {
-        bRecursive = Params->GetBoolField(TEXT("recursive"));
+        return EMCPAssetField::Default;
     }
 
-    FString ClassFilter;
-    Params->TryGetStringField(TEXT("class_filter"), ClassFilter);
+    static const TMap<FString, EMCPAssetField> FieldNames = {
+        { TEXT("path"),         EMCPAssetField::Path },
+        { TEXT("name"),         EMCPAssetField::Name },
+        { TEXT("class"),        EMCPAssetField::Class },
+        { TEXT("class_path"),   EMCPAssetField::ClassPath },
+        { TEXT("package"),      EMCPAssetField::Package },
+        { TEXT("package_path"), EMCPAssetField::PackagePath },
+        { TEXT("tags"),         EMCPAssetField::Tags },
+    };
+
+    EMCPAssetField Fields = EMCPAssetField::None;
+    for (const TSharedPtr<FJsonValue>& Value : *FieldArray)
+    {
+        const EMCPAssetField* Found = FieldNames.Find(Value->AsString());
+        if (!Found)
+        {
+            OutError = FString::Printf(TEXT("Unknown field '%s'"), *Value->AsString());
+            return EMCPAssetField::None;
+        }
+        Fields |= *Found;
+    }
+    return Fields == EMCPAssetField::None ? EMCPAssetField::Default : Fields;
+}
 
-    TArray<FString> AssetPaths = UEditorAssetLibrary::ListAssets(DirectoryPath, bRecursive, false);
+static TSharedPtr<FJsonObject> AssetDataToProjectedJson(const FAssetData& AssetData, EMCPAssetField Fields)
+{
+    TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+#if ENGINE_MAJOR_VERSION >= 5
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::Path))        AssetObj->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::Class))       AssetObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.GetAssetName().ToString());
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::ClassPath))   AssetObj->SetStringField(TEXT("class_path"), AssetData.AssetClassPath.ToString());
+#else
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::Path))        AssetObj->SetStringField(TEXT("path"), AssetData.ObjectPath.ToString());
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::Class))       AssetObj->SetStringField(TEXT("class"), AssetData.AssetClass.ToString());
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::ClassPath))   AssetObj->SetStringField(TEXT("class_path"), AssetData.AssetClass.ToString());
+#endif
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::Name))        AssetObj->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::Package))     AssetObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::PackagePath)) AssetObj->SetStringField(TEXT("package_path"), AssetData.PackagePath.ToString());
 
-    TArray<TSharedPtr<FJsonValue>> AssetArray;
-    for (const FString& AssetPath : AssetPaths)
+    if (EnumHasAnyFlags(Fields, EMCPAssetField::Tags))
     {
-        // Apply class filter if specified
-        if (!ClassFilter.IsEmpty())
+        TSharedPtr<FJsonObject> TagObj = MakeShared<FJsonObject>();
+        for (const auto& Tag : AssetData.TagsAndValues)
         {
-            FAssetData AssetData = UEditorAssetLibrary::FindAssetData(AssetPath);
-            if (AssetData.IsValid())
-            {
 #if ENGINE_MAJOR_VERSION >= 5
-                FString AssetClass = AssetData.AssetClassPath.GetAssetName().ToString();
+            TagObj->SetStringField(Tag.Key.ToString(), Tag.Value.AsString());
 #else
-                FString AssetClass = AssetData.AssetClass.ToString();
+            TagObj->SetStringField(Tag.Key.ToString(), Tag.Value);
 #endif
-                if (!AssetClass.Contains(ClassFilter))
-                {
-                    continue;
-                }
-            }
         }
+        AssetObj->SetObjectField(TEXT("tags"), TagObj);
+    }
+    return AssetObj;
+}
 
-        TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
-        AssetObj->SetStringField(TEXT("path"), AssetPath);
-
-        FAssetData AssetData = UEditorAssetLibrary::FindAssetData(AssetPath);
-        if (AssetData.IsValid())
-        {
-            AssetObj->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
+/** Add one class to the filter. Accepts a full path (/Script/Engine.StaticMesh) or a short name (StaticMesh). */
+static bool AddClassToFilter(FARFilter& Filter, const FString& ClassName, FString& OutError)
+{
 #if ENGINE_MAJOR_VERSION >= 5
-            AssetObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.GetAssetName().ToString());
+    FTopLevelAssetPath ClassPath;
+    if (ClassName.StartsWith(TEXT("/")))
+    {
+        ClassPath = FTopLevelAssetPath(ClassName);
+    }
+    else if (IsInGameThread())
+    {
+        ClassPath = UClass::TryConvertShortTypeNameToPathName<UClass>(ClassName, ELogVerbosity::NoLogging);
+    }
+    else
+    {
+        // A short name is an object-hash lookup, which races GC and package saves
+        // off the game thread; only that lookup goes there, the query stays here
+        TPromise<FTopLevelAssetPath> Promise;
+        TFuture<FTopLevelAssetPath> Future = Promise.GetFuture();
+        AsyncTask(ENamedThreads::GameThread, [ClassName, Promise = MoveTemp(Promise)]() mutable
+        {
+            Promise.SetValue(UClass::TryConvertShortTypeNameToPathName<UClass>(ClassName, ELogVerbosity::NoLogging));
+        });
+        ClassPath = Future.Get();
+    }
+    if (ClassPath.IsNull())
+    {
+        OutError = FString::Printf(TEXT("Unknown class '%s'"), *ClassName);
+        return false;
+    }
+    Filter.ClassPaths.Add(ClassPath);
 #else
-            AssetObj->SetStringField(TEXT("class"), AssetData.AssetClass.ToString());
+    Filter.ClassNames.Add(FName(*ClassName));
 #endif
-            AssetObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// list_assets
+// Params (all optional):
+//   path / package_paths : folder(s) to search (default "/Game/")
+//   recursive            : include sub-folders (default true)
+//   class_filter / classes : class name(s) or path(s); subclasses included
+//   recursive_classes    : include subclasses (default true)
+//   tags                 : { "TagName": "value" | null }  (null = tag present)
+//   fields               : ["path","name","class","class_path","package","package_path","tags"]
+//   limit / cursor       : paging, cursor is next_cursor from the previous page
+// Filtering happens inside the asset registry; once its initial scan is done the
+// command runs on the server thread and only a short class name is resolved on the
+// game thread.
+// ---------------------------------------------------------------------------
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleListAssets(const TSharedPtr<FJsonObject>& Params)
+{
+    FString FieldError;
+    const EMCPAssetField Fields = ParseAssetFields(Params, FieldError);
+    if (!FieldError.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FieldError);
+    }
+
+    FARFilter Filter;
+    Filter.bRecursivePaths = true;
+    Filter.bRecursiveClasses = true;
+    // Registry state only: in-memory enumeration requires the game thread, and every
+    // asset created or saved in this session is already reflected in the registry.
+    Filter.bIncludeOnlyOnDiskAssets = true;
+    Params->TryGetBoolField(TEXT("recursive"), Filter.bRecursivePaths);
+    Params->TryGetBoolField(TEXT("recursive_classes"), Filter.bRecursiveClasses);
+
+    TArray<FString> PackagePaths;
+    const TArray<TSharedPtr<FJsonValue>>* PathValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("package_paths"), PathValues))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *PathValues)
+        {
+            PackagePaths.Add(Value->AsString());
+        }
+    }
+    FString DirectoryPath;
+    if (Params->TryGetStringField(TEXT("path"), DirectoryPath) && !DirectoryPath.IsEmpty())
+    {
+        PackagePaths.Add(DirectoryPath);
+    }
+    if (PackagePaths.Num() == 0)
+    {
+        PackagePaths.Add(TEXT("/Game"));
+    }
+    for (FString& PackagePath : PackagePaths)
+    {
+        // Registry package paths never carry a trailing slash ("/Game", not "/Game/").
+        while (PackagePath.Len() > 1 && PackagePath.EndsWith(TEXT("/")))
+        {
+            PackagePath.LeftChopInline(1);
+        }
+        Filter.PackagePaths.Add(FName(*PackagePath));
+    }
+
+    TArray<FString> ClassNames;
+    FString ClassFilter;
+    if (Params->TryGetStringField(TEXT("class_filter"), ClassFilter) && !ClassFilter.IsEmpty())
+    {
+        ClassNames.Add(ClassFilter);
+    }
+    const TArray<TSharedPtr<FJsonValue>>* ClassValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("classes"), ClassValues))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ClassValues)
+        {
+            ClassNames.Add(Value->AsString());
+        }
+    }
+    for (const FString& ClassName : ClassNames)
+    {
+        FString ClassError;
+        if (!AddClassToFilter(Filter, ClassName, ClassError))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
+        }
+    }
+
+    const TSharedPtr<FJsonObject>* TagFilter = nullptr;
+    if (Params->TryGetObjectField(TEXT("tags"), TagFilter))
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Tag : (*TagFilter)->Values)
+        {
+            if (Tag.Value.IsValid() && !Tag.Value->IsNull())
+            {
+                Filter.TagsAndValues.Add(FName(*Tag.Key), Tag.Value->AsString());
+            }
+            else
+            {
+                Filter.TagsAndValues.Add(FName(*Tag.Key), TOptional<FString>());
+            }
+        }
+    }
+
+    int32 Limit = 0;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    if (Limit < 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Invalid limit %d"), Limit));
+    }
+
+    int32 Offset = 0;
+    FString Cursor;
+    if (Params->TryGetStringField(TEXT("cursor"), Cursor) && !Cursor.IsEmpty())
+    {
+        // Only ever a count we handed out: plain digits, no sign or fraction
+        if (Algo::AnyOf(Cursor, [](TCHAR Char) { return !FChar::IsDigit(Char); }))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Invalid cursor '%s'"), *Cursor));
+        }
+        Offset = static_cast<int32>(FMath::Min<int64>(FCString::Atoi64(*Cursor), MAX_int32));
+    }
+
+    TArray<FAssetData> Assets;
+    GetAssetRegistry().GetAssets(Filter, Assets);
+
+    // Registry order is arbitrary; sort so cursors address the same entries across pages.
+    Assets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        if (A.PackageName != B.PackageName)
+        {
+            return A.PackageName.LexicalLess(B.PackageName);
         }
+        return A.AssetName.LexicalLess(B.AssetName);
+    });
 
-        AssetArray.Add(MakeShared<FJsonValueObject>(AssetObj));
+    const int32 Total = Assets.Num();
+    const int32 First = FMath::Clamp(Offset, 0, Total);
+    const int32 Last = Limit > 0 ? FMath::Min(First + Limit, Total) : Total;
+
+    TArray<TSharedPtr<FJsonValue>> AssetArray;
+    AssetArray.Reserve(Last - First);
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        AssetArray.Add(MakeShared<FJsonValueObject>(AssetDataToProjectedJson(Assets[Index], Fields)));
     }
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetArrayField(TEXT("assets"), AssetArray);
     Result->SetNumberField(TEXT("count"), static_cast<double>(AssetArray.Num()));
+    Result->SetNumberField(TEXT("total_matched"), static_cast<double>(Total));
+    if (Last < Total)
+    {
+        Result->SetStringField(TEXT("next_cursor"), FString::FromInt(Last));
+    }
     return Result;
 }
 
+// ---------------------------------------------------------------------------
+// find_asset
+// Params: name (required), path (default "/Game/"), mode ("substring" | "prefix" | "fuzzy"),
+//         class (short class name), limit (default 50)
+// Served from FMCPAssetNameIndex; until its first build completes, falls back to
+// a substring scan of the registry.
+// ---------------------------------------------------------------------------
 TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleFindAsset(const TSharedPtr<FJsonObject>& Params)
 {
     FString AssetName;
@@ -141,27 +387,74 @@ TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleFindAsset(const TSharedPt
 
     FString SearchPath = TEXT("/Game/");
     Params->TryGetStringField(TEXT("path"), SearchPath);
+    if (!SearchPath.EndsWith(TEXT("/")))
+    {
+        SearchPath += TEXT("/");
+    }
 
-    TArray<FString> AssetPaths = UEditorAssetLibrary::ListAssets(SearchPath, true, false);
+    FString ModeName = TEXT("substring");
+    Params->TryGetStringField(TEXT("mode"), ModeName);
+    EMCPAssetMatchMode Mode;
+    if (ModeName == TEXT("substring"))   Mode = EMCPAssetMatchMode::Substring;
+    else if (ModeName == TEXT("prefix")) Mode = EMCPAssetMatchMode::Prefix;
+    else if (ModeName == TEXT("fuzzy"))  Mode = EMCPAssetMatchMode::Fuzzy;
+    else
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown mode '%s' (expected substring, prefix or fuzzy)"), *ModeName));
+    }
+
+    FString ClassName;
+    Params->TryGetStringField(TEXT("class"), ClassName);
+
+    int32 Limit = 50;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
 
     TArray<TSharedPtr<FJsonValue>> FoundArray;
-    for (const FString& AssetPath : AssetPaths)
+    const bool bIndexReady = NameIndex.IsValid() && NameIndex->IsReady();
+
+    if (bIndexReady)
     {
-        FString FileName = FPaths::GetBaseFilename(AssetPath);
-        if (FileName.Contains(AssetName, ESearchCase::IgnoreCase))
+        const TArray<FMCPAssetMatch> Matches = NameIndex->Query(
+            AssetName, Mode, Limit, SearchPath, ClassName.IsEmpty() ? NAME_None : FName(*ClassName));
+        for (const FMCPAssetMatch& Match : Matches)
         {
-            FAssetData AssetData = UEditorAssetLibrary::FindAssetData(AssetPath);
             TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
-            AssetObj->SetStringField(TEXT("path"), AssetPath);
-            if (AssetData.IsValid())
+            AssetObj->SetStringField(TEXT("path"), Match.ObjectPath);
+            AssetObj->SetStringField(TEXT("name"), Match.AssetName.ToString());
+            AssetObj->SetStringField(TEXT("class"), Match.ClassName.ToString());
+            AssetObj->SetStringField(TEXT("package"), Match.PackageName.ToString());
+            AssetObj->SetNumberField(TEXT("score"), Match.Score);
+            FoundArray.Add(MakeShared<FJsonValueObject>(AssetObj));
+        }
+    }
+    else
+    {
+        FARFilter Filter;
+        Filter.PackagePaths.Add(FName(*SearchPath.LeftChop(1)));
+        Filter.bRecursivePaths = true;
+        Filter.bIncludeOnlyOnDiskAssets = true;
+
+        TArray<FAssetData> Assets;
+        GetAssetRegistry().GetAssets(Filter, Assets);
+        for (const FAssetData& AssetData : Assets)
+        {
+            if (Limit > 0 && FoundArray.Num() >= Limit)
             {
-                AssetObj->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
-#if ENGINE_MAJOR_VERSION >= 5
-                AssetObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.GetAssetName().ToString());
-#else
-                AssetObj->SetStringField(TEXT("class"), AssetData.AssetClass.ToString());
-#endif
-                AssetObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
+                break;
+            }
+            const FString Name = AssetData.AssetName.ToString();
+            const bool bMatches = Mode == EMCPAssetMatchMode::Prefix
+                ? Name.StartsWith(AssetName, ESearchCase::IgnoreCase)
+                : Name.Contains(AssetName, ESearchCase::IgnoreCase);
+            if (!bMatches)
+            {
+                continue;
+            }
+            TSharedPtr<FJsonObject> AssetObj = AssetDataToProjectedJson(AssetData, EMCPAssetField::Default);
+            if (!ClassName.IsEmpty() && AssetObj->GetStringField(TEXT("class")) != ClassName)
+            {
+                continue;
             }
             FoundArray.Add(MakeShared<FJsonValueObject>(AssetObj));
         }
@@ -170,6 +463,243 @@ TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleFindAsset(const TSharedPt
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetArrayField(TEXT("assets"), FoundArray);
     Result->SetNumberField(TEXT("count"), static_cast<double>(FoundArray.Num()));
+    Result->SetBoolField(TEXT("index_ready"), bIndexReady);
+    return Result;
+}
+
+// ---------------------------------------------------------------------------
+// get_asset_dependencies / get_asset_referencers
+// Params: asset_path (package or object path), depth (default 1, 0 = unlimited),
+//         dependency_type ("all" | "hard" | "soft"), include_script (default false),
+//         max_nodes (default 10000)
+// Breadth-first closure over registry edges with a visited set, followed by a
+// DFS over the discovered subgraph to report cycles. Nothing is loaded.
+// ---------------------------------------------------------------------------
+
+/** Direct registry edges of one package in the requested direction. */
+static void GetPackageEdges(IAssetRegistry& AssetRegistry, FName PackageName, bool bReferencers,
+                            const FString& DependencyType, TArray<FName>& OutEdges)
+{
+#if ENGINE_MAJOR_VERSION >= 5
+    using namespace UE::AssetRegistry;
+    FDependencyQuery Query;
+    if (DependencyType == TEXT("hard"))
+    {
+        Query = FDependencyQuery(EDependencyQuery::Hard);
+    }
+    else if (DependencyType == TEXT("soft"))
+    {
+        Query = FDependencyQuery(EDependencyQuery::Soft);
+    }
+    if (bReferencers)
+    {
+        AssetRegistry.GetReferencers(PackageName, OutEdges, EDependencyCategory::Package, Query);
+    }
+    else
+    {
+        AssetRegistry.GetDependencies(PackageName, OutEdges, EDependencyCategory::Package, Query);
+    }
+#else
+    EAssetRegistryDependencyType::Type Type = EAssetRegistryDependencyType::Packages;
+    if (DependencyType == TEXT("hard"))      Type = EAssetRegistryDependencyType::Hard;
+    else if (DependencyType == TEXT("soft")) Type = EAssetRegistryDependencyType::Soft;
+    if (bReferencers)
+    {
+        AssetRegistry.GetReferencers(PackageName, OutEdges, Type);
+    }
+    else
+    {
+        AssetRegistry.GetDependencies(PackageName, OutEdges, Type);
+    }
+#endif
+}
+
+/** Cycles among the discovered nodes, found as back edges of an iterative DFS. */
+static TArray<TArray<FName>> FindCycles(const TMap<FName, TArray<FName>>& Edges, FName Root, int32 MaxCycles)
+{
+    enum class EColor : uint8 { White, Gray, Black };
+    TMap<FName, EColor> Colors;
+    TArray<TArray<FName>> Cycles;
+
+    struct FFrame { FName Node; int32 NextEdge; };
+    TArray<FFrame> Stack;
+    TArray<FName> Path;
+
+    Stack.Add({ Root, 0 });
+    Path.Add(Root);
+    Colors.Add(Root, EColor::Gray);
+
+    while (Stack.Num() > 0 && Cycles.Num() < MaxCycles)
+    {
+        FFrame& Frame = Stack.Last();
+        const TArray<FName>* Out = Edges.Find(Frame.Node);
+        if (!Out || Frame.NextEdge >= Out->Num())
+        {
+            Colors.Add(Frame.Node, EColor::Black);
+            Stack.Pop();
+            Path.Pop();
+            continue;
+        }
+
+        const FName Next = (*Out)[Frame.NextEdge++];
+        const EColor Color = Colors.FindRef(Next);
+        if (Color == EColor::Gray)
+        {
+            const int32 Start = Path.Find(Next);
+            TArray<FName> Cycle(Path.GetData() + Start, Path.Num() - Start);
+            Cycle.Add(Next);
+            Cycles.Add(MoveTemp(Cycle));
+        }
+        else if (Color == EColor::White && Edges.Contains(Next))
+        {
+            Colors.Add(Next, EColor::Gray);
+            Stack.Add({ Next, 0 });
+            Path.Add(Next);
+        }
+    }
+    return Cycles;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleGetAssetDependencies(const TSharedPtr<FJsonObject>& Params)
+{
+    return QueryDependencyGraph(Params, /*bReferencers=*/false);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleGetAssetReferencers(const TSharedPtr<FJsonObject>& Params)
+{
+    return QueryDependencyGraph(Params, /*bReferencers=*/true);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::QueryDependencyGraph(const TSharedPtr<FJsonObject>& Params, bool bReferencers)
+{
+    FString AssetPath;
+    if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath) || AssetPath.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'asset_path' parameter"));
+    }
+    const FName RootPackage(*FPackageName::ObjectPathToPackageName(AssetPath));
+
+    int32 MaxDepth = 1;
+    int32 MaxNodes = 10000;
+    bool bIncludeScript = false;
+    FString DependencyType = TEXT("all");
+    Params->TryGetNumberField(TEXT("depth"), MaxDepth);
+    Params->TryGetNumberField(TEXT("max_nodes"), MaxNodes);
+    Params->TryGetBoolField(TEXT("include_script"), bIncludeScript);
+    Params->TryGetStringField(TEXT("dependency_type"), DependencyType);
+    if (DependencyType != TEXT("all") && DependencyType != TEXT("hard") && DependencyType != TEXT("soft"))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown dependency_type '%s' (expected all, hard or soft)"), *DependencyType));
+    }
+
+    const FString CacheKey = FString::Printf(TEXT("%d|%s|%d|%d|%d|%s"), bReferencers ? 1 : 0,
+        *RootPackage.ToString(), MaxDepth, MaxNodes, bIncludeScript ? 1 : 0, *DependencyType);
+    const uint64 Revision = NameIndex.IsValid() ? NameIndex->GetRevision() : 0;
+    if (NameIndex.IsValid())
+    {
+        FScopeLock CacheLock(&GraphCacheLock);
+        if (GraphCacheRevision != Revision)
+        {
+            GraphCache.Reset();
+            GraphCacheRevision = Revision;
+        }
+        if (const TSharedPtr<FJsonObject>* Cached = GraphCache.Find(CacheKey))
+        {
+            TSharedPtr<FJsonObject> Copy = MakeShared<FJsonObject>(**Cached);
+            Copy->SetBoolField(TEXT("cached"), true);
+            return Copy;
+        }
+    }
+
+    IAssetRegistry& AssetRegistry = GetAssetRegistry();
+
+    struct FVisit { int32 Depth; FName Parent; };
+    TMap<FName, FVisit> Visited;
+    TMap<FName, TArray<FName>> Edges;       // adjacency of expanded nodes, for cycle detection
+    TArray<FName> Order;                    // discovery order (BFS), excludes the root
+    TArray<FName> Frontier = { RootPackage };
+    Visited.Add(RootPackage, { 0, NAME_None });
+    bool bTruncated = false;
+
+    TArray<FName> Direct;
+    for (int32 Depth = 1; Frontier.Num() > 0 && (MaxDepth <= 0 || Depth <= MaxDepth) && !bTruncated; ++Depth)
+    {
+        TArray<FName> NextFrontier;
+        for (const FName Package : Frontier)
+        {
+            Direct.Reset();
+            GetPackageEdges(AssetRegistry, Package, bReferencers, DependencyType, Direct);
+
+            TArray<FName>& Out = Edges.FindOrAdd(Package);
+            for (const FName Next : Direct)
+            {
+                if (!bIncludeScript && Next.ToString().StartsWith(TEXT("/Script/")))
+                {
+                    continue;
+                }
+                Out.Add(Next);
+                if (Visited.Contains(Next))
+                {
+                    continue;
+                }
+                if (Order.Num() >= MaxNodes)
+                {
+                    bTruncated = true;
+                    continue;
+                }
+                Visited.Add(Next, { Depth, Package });
+                Order.Add(Next);
+                NextFrontier.Add(Next);
+            }
+        }
+        Frontier = MoveTemp(NextFrontier);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> NodeArray;
+    NodeArray.Reserve(Order.Num());
+    for (const FName Package : Order)
+    {
+        const FVisit& Visit = Visited[Package];
+        TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("package"), Package.ToString());
+        NodeObj->SetNumberField(TEXT("depth"), Visit.Depth);
+        NodeObj->SetStringField(TEXT("via"), Visit.Parent.ToString());
+        NodeArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> CycleArray;
+    for (const TArray<FName>& Cycle : FindCycles(Edges, RootPackage, 20))
+    {
+        TArray<TSharedPtr<FJsonValue>> CycleNodes;
+        for (const FName Package : Cycle)
+        {
+            CycleNodes.Add(MakeShared<FJsonValueString>(Package.ToString()));
+        }
+        CycleArray.Add(MakeShared<FJsonValueArray>(CycleNodes));
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("root"), RootPackage.ToString());
+    Result->SetStringField(TEXT("direction"), bReferencers ? TEXT("referencers") : TEXT("dependencies"));
+    Result->SetArrayField(TEXT("nodes"), NodeArray);
+    Result->SetNumberField(TEXT("count"), NodeArray.Num());
+    Result->SetArrayField(TEXT("cycles"), CycleArray);
+    Result->SetBoolField(TEXT("truncated"), bTruncated);
+    Result->SetNumberField(TEXT("registry_revision"), static_cast<double>(Revision));
+
+    if (NameIndex.IsValid())
+    {
+        FScopeLock CacheLock(&GraphCacheLock);
+        if (GraphCacheRevision == Revision)
+        {
+            if (GraphCache.Num() >= 256)
+            {
+                GraphCache.Reset();
+            }
+            GraphCache.Add(CacheKey, Result);
+        }
+    }
     return Result;
 }
 
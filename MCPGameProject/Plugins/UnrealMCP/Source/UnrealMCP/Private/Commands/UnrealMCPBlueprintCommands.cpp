@@ -1,5 +1,8 @@
 #include "Commands/UnrealMCPBlueprintCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "MCPClassResolver.h"
+#include "MCPBlueprintExporter.h"
+#include "MCPPropertyPath.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -65,6 +68,8 @@ void FUnrealMCPBlueprintCommands::RegisterCommands(FMCPCommandRegistry& Registry
         [this](const TSharedPtr<FJsonObject>& P) { return HandleListBlueprints(P); });
     Registry.RegisterCommand(TEXT("get_blueprint_compile_errors"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleGetBlueprintCompileErrors(P); });
+    Registry.RegisterCommand(TEXT("export_blueprint"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleExportBlueprint(P); });
 
     // Collision commands
     Registry.RegisterCommand(TEXT("set_component_collision_profile"),
@@ -206,40 +211,15 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
-    // Create the component - dynamically find the component class by name
-    UClass* ComponentClass = nullptr;
-
-    // Try to find the class with exact name first
-    ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentType);
-    
-    // If not found, try with "Component" suffix
-    if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
+    // Resolve the component class; "StaticMesh", "StaticMeshComponent" and "UStaticMeshComponent" all work
+    UClass* ComponentClass = FMCPClassResolver::Get().Resolve(ComponentType, UActorComponent::StaticClass());
+    if (!ComponentClass)
     {
-        FString ComponentTypeWithSuffix = ComponentType + TEXT("Component");
-        ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithSuffix);
-    }
-    
-    // If still not found, try with "U" prefix
-    if (!ComponentClass && !ComponentType.StartsWith(TEXT("U")))
-    {
-        FString ComponentTypeWithPrefix = TEXT("U") + ComponentType;
-        ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithPrefix);
-        
-        // Try with both prefix and suffix
-        if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
-        {
-            FString ComponentTypeWithBoth = TEXT("U") + ComponentType + TEXT("Component");
-            ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithBoth);
-        }
-    }
-    
-    // Verify that the class is a valid component type
-    if (!ComponentClass || !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown component type: %s"), *ComponentType));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown component type: %s (%s)"),
+            *ComponentType, *FMCPClassResolver::Get().GetLastError()));
     }
 
     // Add the component to the blueprint
@@ -332,7 +312,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
     if (!Blueprint)
     {
         UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Blueprint not found: %s"), *BlueprintName);
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
     else
     {
@@ -787,7 +767,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPhysicsProperties(
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Find the component
@@ -857,7 +837,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprint(cons
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Compile the blueprint
@@ -888,7 +868,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSpawnBlueprintActor(c
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get transform parameters
@@ -934,8 +914,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetBlueprintProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
     }
 
+    // Either property_name + property_value, or properties: {"path": value, ...}
     FString PropertyName;
-    if (!Params->TryGetStringField(TEXT("property_name"), PropertyName))
+    const TSharedPtr<FJsonObject>* Properties = nullptr;
+    const bool bMultiple = Params->TryGetObjectField(TEXT("properties"), Properties);
+    if (!bMultiple && !Params->TryGetStringField(TEXT("property_name"), PropertyName))
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_name' parameter"));
     }
@@ -944,7 +927,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetBlueprintProperty(
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get the default object
@@ -954,6 +937,27 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetBlueprintProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get default object"));
     }
 
+    if (bMultiple)
+    {
+        TArray<FString> Errors;
+        const int32 NumSet = FMCPPropertyPath::Get().SetProperties(DefaultObject, **Properties, Errors);
+        if (NumSet > 0)
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        }
+
+        TArray<TSharedPtr<FJsonValue>> ErrorValues;
+        for (const FString& Error : Errors)
+        {
+            ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+        }
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetNumberField(TEXT("set"), NumSet);
+        ResultObj->SetArrayField(TEXT("errors"), ErrorValues);
+        ResultObj->SetBoolField(TEXT("success"), Errors.Num() == 0);
+        return ResultObj;
+    }
+
     // Set the property value
     if (Params->HasField(TEXT("property_value")))
     {
@@ -998,7 +1002,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetStaticMeshProperti
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Find the component
@@ -1065,7 +1069,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPawnProperties(con
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get the default object
@@ -1194,7 +1198,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintVariables
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     TArray<TSharedPtr<FJsonValue>> VarArray;
@@ -1229,7 +1233,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintFunctions
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     TArray<TSharedPtr<FJsonValue>> FuncArray;
@@ -1272,7 +1276,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintComponent
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     TArray<TSharedPtr<FJsonValue>> CompArray;
@@ -1306,6 +1310,56 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintComponent
     return Result;
 }
 
+// ---------------------------------------------------------------------------
+// export_blueprint
+// Params: blueprint_name, if_hash? (hash of the client's cached export)
+// Returns { unchanged: true, hash } when if_hash still matches, otherwise
+// { unchanged: false, hash, blueprint: <canonical export> }.
+// ---------------------------------------------------------------------------
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleExportBlueprint(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    FString IfHash;
+    Params->TryGetStringField(TEXT("if_hash"), IfHash);
+
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
+    }
+
+    FMCPBlueprintExporter& Exporter = FMCPBlueprintExporter::Get();
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+
+    // Nothing owned by the blueprint changed since the client's copy was exported
+    if (!IfHash.IsEmpty() && Exporter.GetCleanHash(Blueprint) == IfHash)
+    {
+        Result->SetBoolField(TEXT("unchanged"), true);
+        Result->SetStringField(TEXT("hash"), IfHash);
+        return Result;
+    }
+
+    FString Hash;
+    bool bFromCache = false;
+    TSharedPtr<FJsonObject> Export = Exporter.Export(Blueprint, Hash, bFromCache);
+
+    // Edited and edited back, or touched without a structural change
+    const bool bUnchanged = !IfHash.IsEmpty() && Hash == IfHash;
+    Result->SetBoolField(TEXT("unchanged"), bUnchanged);
+    Result->SetStringField(TEXT("hash"), Hash);
+    if (!bUnchanged)
+    {
+        Result->SetObjectField(TEXT("blueprint"), Export);
+    }
+    return Result;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleListBlueprints(const TSharedPtr<FJsonObject>& Params)
 {
     FString SearchPath = TEXT("/Game/");
@@ -1351,7 +1405,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintCompileEr
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Compile the blueprint to get current status
@@ -1414,7 +1468,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentCollision
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     if (!Blueprint->SimpleConstructionScript)
@@ -1471,7 +1525,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentCollision
     if (!Blueprint || !Blueprint->SimpleConstructionScript)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
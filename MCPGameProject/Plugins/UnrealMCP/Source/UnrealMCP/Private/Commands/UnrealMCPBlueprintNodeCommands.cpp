@@ -1,14 +1,18 @@
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "MCPClassResolver.h"
+#include "MCPBlueprintNodeIndex.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraph/EdGraphPin.h"
 #include "K2Node_Event.h"
+#include "K2Node_CustomEvent.h"
 #include "K2Node_CallFunction.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
+#include "K2Node_Variable.h"
 #include "K2Node_InputAction.h"
 #include "K2Node_Self.h"
 #include "K2Node_IfThenElse.h"
@@ -23,6 +27,7 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "EdGraphSchema_K2.h"
+#include "ScopedTransaction.h"
 
 // Declare the log category
 DEFINE_LOG_CATEGORY_STATIC(LogUnrealMCP, Log, All);
@@ -49,6 +54,8 @@ void FUnrealMCPBlueprintNodeCommands::RegisterCommands(FMCPCommandRegistry& Regi
         [this](const TSharedPtr<FJsonObject>& P) { return HandleAddBlueprintSelfReference(P); });
     Registry.RegisterCommand(TEXT("find_blueprint_nodes"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleFindBlueprintNodes(P); });
+    Registry.RegisterCommand(TEXT("query_blueprint_nodes"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleQueryBlueprintNodes(P); });
 
     // New node types
     Registry.RegisterCommand(TEXT("add_blueprint_get_variable_node"),
@@ -67,6 +74,8 @@ void FUnrealMCPBlueprintNodeCommands::RegisterCommands(FMCPCommandRegistry& Regi
         [this](const TSharedPtr<FJsonObject>& P) { return HandleAddBlueprintPrintStringNode(P); });
     Registry.RegisterCommand(TEXT("add_blueprint_custom_function"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleAddBlueprintCustomFunction(P); });
+    Registry.RegisterCommand(TEXT("build_blueprint_graph"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleBuildBlueprintGraph(P); });
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintNodes(const TSharedPtr<FJsonObject>& Params)
@@ -106,38 +115,27 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintN
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
-    // Get the event graph
-    UEdGraph* EventGraph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get event graph"));
-    }
-
-    // Find the nodes
-    UEdGraphNode* SourceNode = nullptr;
-    UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
+    // Find the nodes in any graph of the blueprint through the GUID index
+    UEdGraphNode* SourceNode = FMCPBlueprintNodeIndex::Get().FindNode(Blueprint, SourceNodeId);
+    UEdGraphNode* TargetNode = FMCPBlueprintNodeIndex::Get().FindNode(Blueprint, TargetNodeId);
+    if (!SourceNode || !TargetNode)
     {
-        if (Node->NodeGuid.ToString() == SourceNodeId)
-        {
-            SourceNode = Node;
-        }
-        else if (Node->NodeGuid.ToString() == TargetNodeId)
-        {
-            TargetNode = Node;
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s node not found: %s"),
+            SourceNode ? TEXT("Target") : TEXT("Source"), SourceNode ? *TargetNodeId : *SourceNodeId));
     }
 
-    if (!SourceNode || !TargetNode)
+    UEdGraph* Graph = SourceNode->GetGraph();
+    if (TargetNode->GetGraph() != Graph)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Source or target node not found"));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Nodes are in different graphs (%s and %s)"), *Graph->GetName(), *TargetNode->GetGraph()->GetName()));
     }
 
     // Connect the nodes
-    if (FUnrealMCPCommonUtils::ConnectGraphNodes(EventGraph, SourceNode, SourcePinName, TargetNode, TargetPinName))
+    if (FUnrealMCPCommonUtils::ConnectGraphNodes(Graph, SourceNode, SourcePinName, TargetNode, TargetPinName))
     {
         // Mark the blueprint as modified
         FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
@@ -177,7 +175,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetSe
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get the event graph
@@ -247,7 +245,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintEvent
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get the event graph
@@ -302,7 +300,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get the event graph
@@ -323,55 +321,14 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     // Check if we have a target class specified
     if (!Target.IsEmpty())
     {
-        // Try to find the target class
-        UClass* TargetClass = nullptr;
-        
-        // First try without a prefix
-        TargetClass = FindObject<UClass>(ANY_PACKAGE, *Target);
-        UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-               *Target, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        
-        // If not found, try with U prefix (common convention for UE classes)
-        if (!TargetClass && !Target.StartsWith(TEXT("U")))
-        {
-            FString TargetWithPrefix = FString(TEXT("U")) + Target;
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, *TargetWithPrefix);
-            UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-                   *TargetWithPrefix, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        }
-        
-        // If still not found, try with common component names
-        if (!TargetClass)
-        {
-            // Try some common component class names
-            TArray<FString> PossibleClassNames;
-            PossibleClassNames.Add(FString(TEXT("U")) + Target + TEXT("Component"));
-            PossibleClassNames.Add(Target + TEXT("Component"));
-            
-            for (const FString& ClassName : PossibleClassNames)
-            {
-                TargetClass = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-                if (TargetClass)
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Found class using alternative name '%s'"), *ClassName);
-                    break;
-                }
-            }
-        }
-        
-        // Special case handling for common classes like UGameplayStatics
-        if (!TargetClass && Target == TEXT("UGameplayStatics"))
+        // Resolve the target class by name ("GameplayStatics", "UGameplayStatics", "/Script/Engine.GameplayStatics")
+        UClass* TargetClass = FMCPClassResolver::Get().Resolve(Target);
+        if (!TargetClass && FMCPClassResolver::Get().WasAmbiguous())
         {
-            // For UGameplayStatics, use a direct reference to known class
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, TEXT("UGameplayStatics"));
-            if (!TargetClass)
-            {
-                // Try loading it from its known package
-                TargetClass = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.GameplayStatics"));
-                UE_LOG(LogTemp, Display, TEXT("Explicitly loading GameplayStatics: %s"), 
-                       TargetClass ? TEXT("Success") : TEXT("Failed"));
-            }
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FMCPClassResolver::Get().GetLastError());
         }
+        UE_LOG(LogTemp, Display, TEXT("Resolved target class '%s': %s"),
+               *Target, TargetClass ? *TargetClass->GetPathName() : TEXT("Not found"));
         
         // If we found a target class, look for the function there
         if (TargetClass)
@@ -504,32 +461,13 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
                         // Handle class reference parameters (e.g., ActorClass in GetActorOfClass)
                         if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Class)
                         {
-                            // For class references, we require the exact class name with proper prefix
-                            // - Actor classes must start with 'A' (e.g., ACameraActor)
-                            // - Non-actor classes must start with 'U' (e.g., UObject)
+                            // Class references accept a short name (with or without the A/U prefix) or a path
                             const FString& ClassName = StringVal;
-                            
-                            // TODO: This likely won't work in UE5.5+, so don't rely on it.
-                            UClass* Class = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-
-                            if (!Class)
-                            {
-                                Class = LoadObject<UClass>(nullptr, *ClassName);
-                                UE_LOG(LogUnrealMCP, Display, TEXT("FindObject<UClass> failed. Assuming soft path  path: %s"), *ClassName);
-                            }
-                            
-                            // If not found, try with Engine module path
-                            if (!Class)
-                            {
-                                FString EngineClassName = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
-                                Class = LoadObject<UClass>(nullptr, *EngineClassName);
-                                UE_LOG(LogUnrealMCP, Display, TEXT("Trying Engine module path: %s"), *EngineClassName);
-                            }
-                            
+                            UClass* Class = FMCPClassResolver::Get().Resolve(ClassName);
                             if (!Class)
                             {
-                                UE_LOG(LogUnrealMCP, Error, TEXT("Failed to find class '%s'. Make sure to use the exact class name with proper prefix (A for actors, U for non-actors)"), *ClassName);
-                                return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to find class '%s'"), *ClassName));
+                                UE_LOG(LogUnrealMCP, Error, TEXT("Failed to find class '%s': %s"), *ClassName, *FMCPClassResolver::Get().GetLastError());
+                                return FUnrealMCPCommonUtils::CreateErrorResponse(FMCPClassResolver::Get().GetLastError());
                             }
 
                             const UEdGraphSchema_K2* K2Schema = Cast<const UEdGraphSchema_K2>(EventGraph->GetSchema());
@@ -709,7 +647,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintVaria
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Create variable based on type
@@ -800,7 +738,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInput
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get the event graph
@@ -845,7 +783,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfR
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get the event graph
@@ -889,7 +827,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNode
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get the event graph
@@ -930,6 +868,270 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNode
     return ResultObj;
 }
 
+// ---------------------------------------------------------------------------
+// query_blueprint_nodes
+// Params: blueprint_name, graph_name?, graph_type? ("event"|"function"|"macro"|"delegate"|"subgraph"),
+//         node_class?, title?, function?, variable?, pin_type?, connected? (bool),
+//         connected_to? (node GUID), include_pins? (default false), limit? (default 200)
+// ---------------------------------------------------------------------------
+
+static bool NodeClassMatches(const UEdGraphNode* Node, const FString& ClassName)
+{
+    for (const UClass* Class = Node->GetClass(); Class; Class = Class->GetSuperClass())
+    {
+        const FString Name = Class->GetName();
+        if (Name == ClassName || (TEXT("U") + Name) == ClassName)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static FName GetReferencedFunctionName(const UEdGraphNode* Node)
+{
+    if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+    {
+        return CallNode->FunctionReference.GetMemberName();
+    }
+    if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+    {
+        return EventNode->CustomFunctionName.IsNone() ? EventNode->EventReference.GetMemberName() : EventNode->CustomFunctionName;
+    }
+    if (const UK2Node_FunctionEntry* EntryNode = Cast<UK2Node_FunctionEntry>(Node))
+    {
+        return EntryNode->FunctionReference.GetMemberName();
+    }
+    return NAME_None;
+}
+
+static FName GetReferencedVariableName(const UEdGraphNode* Node)
+{
+    const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node);
+    return VariableNode ? VariableNode->GetVarName() : NAME_None;
+}
+
+static bool PinTypeMatches(const UEdGraphPin* Pin, const FString& PinType)
+{
+    if (Pin->PinType.PinCategory.ToString() == PinType || Pin->PinType.PinSubCategory.ToString() == PinType)
+    {
+        return true;
+    }
+    const UObject* SubCategoryObject = Pin->PinType.PinSubCategoryObject.Get();
+    return SubCategoryObject && SubCategoryObject->GetName() == PinType;
+}
+
+static TSharedPtr<FJsonObject> PinToJson(const UEdGraphPin* Pin)
+{
+    TSharedPtr<FJsonObject> PinObj = MakeShared<FJsonObject>();
+    PinObj->SetStringField(TEXT("name"), Pin->PinName.ToString());
+    PinObj->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("input") : TEXT("output"));
+    PinObj->SetStringField(TEXT("category"), Pin->PinType.PinCategory.ToString());
+    if (!Pin->PinType.PinSubCategory.IsNone())
+    {
+        PinObj->SetStringField(TEXT("sub_category"), Pin->PinType.PinSubCategory.ToString());
+    }
+    if (const UObject* SubCategoryObject = Pin->PinType.PinSubCategoryObject.Get())
+    {
+        PinObj->SetStringField(TEXT("sub_category_object"), SubCategoryObject->GetName());
+    }
+    if (Pin->PinType.IsContainer())
+    {
+        PinObj->SetStringField(TEXT("container"), Pin->PinType.IsArray() ? TEXT("array") : Pin->PinType.IsSet() ? TEXT("set") : TEXT("map"));
+    }
+    if (!Pin->DefaultValue.IsEmpty())
+    {
+        PinObj->SetStringField(TEXT("default_value"), Pin->DefaultValue);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Links;
+    for (const UEdGraphPin* Linked : Pin->LinkedTo)
+    {
+        if (Linked && Linked->GetOwningNodeUnchecked())
+        {
+            TSharedPtr<FJsonObject> LinkObj = MakeShared<FJsonObject>();
+            LinkObj->SetStringField(TEXT("node_id"), Linked->GetOwningNode()->NodeGuid.ToString());
+            LinkObj->SetStringField(TEXT("pin"), Linked->PinName.ToString());
+            Links.Add(MakeShared<FJsonValueObject>(LinkObj));
+        }
+    }
+    PinObj->SetArrayField(TEXT("linked_to"), Links);
+    return PinObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleQueryBlueprintNodes(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
+    }
+
+    FString GraphName, GraphType, NodeClass, Title, FunctionName, VariableName, PinType, ConnectedToId;
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+    Params->TryGetStringField(TEXT("graph_type"), GraphType);
+    Params->TryGetStringField(TEXT("node_class"), NodeClass);
+    Params->TryGetStringField(TEXT("title"), Title);
+    Params->TryGetStringField(TEXT("function"), FunctionName);
+    Params->TryGetStringField(TEXT("variable"), VariableName);
+    Params->TryGetStringField(TEXT("pin_type"), PinType);
+    Params->TryGetStringField(TEXT("connected_to"), ConnectedToId);
+
+    bool bFilterConnected = false;
+    bool bConnected = false;
+    if (Params->HasTypedField<EJson::Boolean>(TEXT("connected")))
+    {
+        bFilterConnected = true;
+        bConnected = Params->GetBoolField(TEXT("connected"));
+    }
+
+    bool bIncludePins = false;
+    Params->TryGetBoolField(TEXT("include_pins"), bIncludePins);
+
+    int32 Limit = 200;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Max(1, Limit);
+
+    const FName FunctionFName = FunctionName.IsEmpty() ? NAME_None : FName(*FunctionName);
+    const FName VariableFName = VariableName.IsEmpty() ? NAME_None : FName(*VariableName);
+
+    const UEdGraphNode* ConnectedToNode = nullptr;
+    if (!ConnectedToId.IsEmpty())
+    {
+        ConnectedToNode = FMCPBlueprintNodeIndex::Get().FindNode(Blueprint, ConnectedToId);
+        if (!ConnectedToNode)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Node not found: %s"), *ConnectedToId));
+        }
+    }
+
+    TArray<UEdGraph*> Graphs;
+    FMCPBlueprintNodeIndex::GetAllGraphs(Blueprint, Graphs);
+
+    TArray<TSharedPtr<FJsonValue>> NodesArray;
+    TArray<TSharedPtr<FJsonValue>> GraphsSearched;
+    int32 TotalMatched = 0;
+
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!GraphName.IsEmpty() && Graph->GetName() != GraphName)
+        {
+            continue;
+        }
+        const FString ThisGraphType = FMCPBlueprintNodeIndex::GetGraphType(Blueprint, Graph);
+        if (!GraphType.IsEmpty() && ThisGraphType != GraphType)
+        {
+            continue;
+        }
+        GraphsSearched.Add(MakeShared<FJsonValueString>(Graph->GetName()));
+
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+            if (!NodeClass.IsEmpty() && !NodeClassMatches(Node, NodeClass))
+            {
+                continue;
+            }
+            if (!FunctionFName.IsNone() && GetReferencedFunctionName(Node) != FunctionFName)
+            {
+                continue;
+            }
+            if (!VariableFName.IsNone() && GetReferencedVariableName(Node) != VariableFName)
+            {
+                continue;
+            }
+
+            bool bHasPinType = PinType.IsEmpty();
+            bool bHasLinks = false;
+            bool bLinksToTarget = ConnectedToNode == nullptr;
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                bHasPinType = bHasPinType || PinTypeMatches(Pin, PinType);
+                bHasLinks = bHasLinks || Pin->LinkedTo.Num() > 0;
+                if (!bLinksToTarget)
+                {
+                    for (const UEdGraphPin* Linked : Pin->LinkedTo)
+                    {
+                        if (Linked && Linked->GetOwningNodeUnchecked() == ConnectedToNode)
+                        {
+                            bLinksToTarget = true;
+                            break;
+                        }
+                    }
+                }
+            }
+            if (!bHasPinType || !bLinksToTarget || (bFilterConnected && bHasLinks != bConnected))
+            {
+                continue;
+            }
+
+            // Titles are built on demand by most nodes, so test them last
+            const FString NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+            if (!Title.IsEmpty() && !NodeTitle.Contains(Title))
+            {
+                continue;
+            }
+
+            ++TotalMatched;
+            if (NodesArray.Num() >= Limit)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetStringField(TEXT("node_id"), Node->NodeGuid.ToString());
+            NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+            NodeObj->SetStringField(TEXT("title"), NodeTitle);
+            NodeObj->SetStringField(TEXT("graph"), Graph->GetName());
+            NodeObj->SetStringField(TEXT("graph_type"), ThisGraphType);
+            NodeObj->SetNumberField(TEXT("x"), Node->NodePosX);
+            NodeObj->SetNumberField(TEXT("y"), Node->NodePosY);
+
+            const FName ReferencedFunction = GetReferencedFunctionName(Node);
+            if (!ReferencedFunction.IsNone())
+            {
+                NodeObj->SetStringField(TEXT("function"), ReferencedFunction.ToString());
+            }
+            const FName ReferencedVariable = GetReferencedVariableName(Node);
+            if (!ReferencedVariable.IsNone())
+            {
+                NodeObj->SetStringField(TEXT("variable"), ReferencedVariable.ToString());
+            }
+            NodeObj->SetBoolField(TEXT("connected"), bHasLinks);
+
+            if (bIncludePins)
+            {
+                TArray<TSharedPtr<FJsonValue>> PinsArray;
+                for (const UEdGraphPin* Pin : Node->Pins)
+                {
+                    if (!Pin->bHidden)
+                    {
+                        PinsArray.Add(MakeShared<FJsonValueObject>(PinToJson(Pin)));
+                    }
+                }
+                NodeObj->SetArrayField(TEXT("pins"), PinsArray);
+            }
+            NodesArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("nodes"), NodesArray);
+    ResultObj->SetNumberField(TEXT("total_matched"), TotalMatched);
+    ResultObj->SetBoolField(TEXT("truncated"), TotalMatched > NodesArray.Num());
+    ResultObj->SetArrayField(TEXT("graphs_searched"), GraphsSearched);
+    return ResultObj;
+}
+
 // ---------------------------------------------------------------------------
 // Helper: resolve graph from params (defaults to event graph)
 // ---------------------------------------------------------------------------
@@ -987,7 +1189,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetVa
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     UEdGraph* Graph = GetTargetGraph(Blueprint, Params);
@@ -1033,7 +1235,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSetVa
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     UEdGraph* Graph = GetTargetGraph(Blueprint, Params);
@@ -1073,7 +1275,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintBranc
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     UEdGraph* Graph = GetTargetGraph(Blueprint, Params);
@@ -1132,7 +1334,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSeque
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     UEdGraph* Graph = GetTargetGraph(Blueprint, Params);
@@ -1187,20 +1389,14 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintCastN
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Find the target class
-    UClass* TargetClass = FindObject<UClass>(ANY_PACKAGE, *TargetClassName);
-    if (!TargetClass)
-    {
-        // Try loading with engine path
-        TargetClass = LoadObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *TargetClassName));
-    }
+    UClass* TargetClass = FMCPClassResolver::Get().Resolve(TargetClassName);
     if (!TargetClass)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Class '%s' not found"), *TargetClassName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FMCPClassResolver::Get().GetLastError());
     }
 
     UEdGraph* Graph = GetTargetGraph(Blueprint, Params);
@@ -1226,6 +1422,34 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintCastN
     return Result;
 }
 
+// ---------------------------------------------------------------------------
+// Helper: KismetMathLibrary function name for an operation and operand type
+// Convention: Float -> "Add_FloatFloat", "Multiply_FloatFloat" etc.
+//             Int   -> "Add_IntInt"
+//             Vector -> "Add_VectorVector"
+// ---------------------------------------------------------------------------
+static FString BuildMathFunctionName(const FString& Operation, const FString& MathType)
+{
+    FString FuncName;
+    FString TypeSuffix = MathType == TEXT("Int") ? TEXT("Int") : (MathType == TEXT("Vector") ? TEXT("Vector") : TEXT("Float"));
+    FString TypeSuffix2 = TypeSuffix;
+
+    if (Operation == TEXT("Add"))       FuncName = FString::Printf(TEXT("Add_%s%s"), *TypeSuffix, *TypeSuffix2);
+    else if (Operation == TEXT("Subtract")) FuncName = FString::Printf(TEXT("Subtract_%s%s"), *TypeSuffix, *TypeSuffix2);
+    else if (Operation == TEXT("Multiply")) FuncName = FString::Printf(TEXT("Multiply_%s%s"), *TypeSuffix, *TypeSuffix2);
+    else if (Operation == TEXT("Divide"))   FuncName = FString::Printf(TEXT("Divide_%s%s"), *TypeSuffix, *TypeSuffix2);
+    else if (Operation == TEXT("Clamp"))    FuncName = FString::Printf(TEXT("Clamp%s"), *TypeSuffix);
+    else if (Operation == TEXT("Abs"))      FuncName = FString::Printf(TEXT("Abs_%s"), *TypeSuffix);
+    else if (Operation == TEXT("Max"))      FuncName = FString::Printf(TEXT("Max%s"), *TypeSuffix);
+    else if (Operation == TEXT("Min"))      FuncName = FString::Printf(TEXT("Min%s"), *TypeSuffix);
+    else if (Operation == TEXT("Lerp"))     FuncName = FString::Printf(TEXT("Lerp_%s"), *TypeSuffix);
+    else if (Operation == TEXT("Greater"))  FuncName = FString::Printf(TEXT("Greater_%s%s"), *TypeSuffix, *TypeSuffix2);
+    else if (Operation == TEXT("Less"))     FuncName = FString::Printf(TEXT("Less_%s%s"), *TypeSuffix, *TypeSuffix2);
+    else if (Operation == TEXT("Equal"))    FuncName = FString::Printf(TEXT("EqualEqual_%s%s"), *TypeSuffix, *TypeSuffix2);
+    else                                    FuncName = Operation; // Allow direct function name
+    return FuncName;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintMathNode(const TSharedPtr<FJsonObject>& Params)
 {
     FString BlueprintName;
@@ -1256,7 +1480,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintMathN
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     UEdGraph* Graph = GetTargetGraph(Blueprint, Params);
@@ -1265,27 +1489,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintMathN
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Target graph not found"));
     }
 
-    // Build the KismetMathLibrary function name
-    // Convention: Float -> "Add_FloatFloat", "Multiply_FloatFloat" etc.
-    //             Int   -> "Add_IntInt"
-    //             Vector -> "Add_VectorVector"
-    FString FuncName;
-    FString TypeSuffix = MathType == TEXT("Int") ? TEXT("Int") : (MathType == TEXT("Vector") ? TEXT("Vector") : TEXT("Float"));
-    FString TypeSuffix2 = TypeSuffix;
-
-    if (Operation == TEXT("Add"))       FuncName = FString::Printf(TEXT("Add_%s%s"), *TypeSuffix, *TypeSuffix2);
-    else if (Operation == TEXT("Subtract")) FuncName = FString::Printf(TEXT("Subtract_%s%s"), *TypeSuffix, *TypeSuffix2);
-    else if (Operation == TEXT("Multiply")) FuncName = FString::Printf(TEXT("Multiply_%s%s"), *TypeSuffix, *TypeSuffix2);
-    else if (Operation == TEXT("Divide"))   FuncName = FString::Printf(TEXT("Divide_%s%s"), *TypeSuffix, *TypeSuffix2);
-    else if (Operation == TEXT("Clamp"))    FuncName = FString::Printf(TEXT("Clamp%s"), *TypeSuffix);
-    else if (Operation == TEXT("Abs"))      FuncName = FString::Printf(TEXT("Abs_%s"), *TypeSuffix);
-    else if (Operation == TEXT("Max"))      FuncName = FString::Printf(TEXT("Max%s"), *TypeSuffix);
-    else if (Operation == TEXT("Min"))      FuncName = FString::Printf(TEXT("Min%s"), *TypeSuffix);
-    else if (Operation == TEXT("Lerp"))     FuncName = FString::Printf(TEXT("Lerp_%s"), *TypeSuffix);
-    else if (Operation == TEXT("Greater"))  FuncName = FString::Printf(TEXT("Greater_%s%s"), *TypeSuffix, *TypeSuffix2);
-    else if (Operation == TEXT("Less"))     FuncName = FString::Printf(TEXT("Less_%s%s"), *TypeSuffix, *TypeSuffix2);
-    else if (Operation == TEXT("Equal"))    FuncName = FString::Printf(TEXT("EqualEqual_%s%s"), *TypeSuffix, *TypeSuffix2);
-    else                                    FuncName = Operation; // Allow direct function name
+    const FString FuncName = BuildMathFunctionName(Operation, MathType);
 
     UClass* MathLibClass = UKismetMathLibrary::StaticClass();
     UFunction* MathFunc = MathLibClass->FindFunctionByName(*FuncName);
@@ -1341,7 +1545,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintPrint
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     UEdGraph* Graph = GetTargetGraph(Blueprint, Params);
@@ -1395,7 +1599,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintCusto
     if (!Blueprint)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Check if function graph already exists
@@ -1431,4 +1635,722 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintCusto
     Result->SetStringField(TEXT("graph_name"), FunctionName);
     Result->SetBoolField(TEXT("already_existed"), false);
     return Result;
-}
\ No newline at end of file
+}
+// ---------------------------------------------------------------------------
+// build_blueprint_graph
+// Params: blueprint_name, graph_name? (default event graph), compile? (default true),
+//         origin? [x, y] (default: below the existing nodes),
+//         nodes: [{ id, type, position? [x, y], pins? { PinName: default }, ...type fields }],
+//         edges: [{ from, from_pin?, to, to_pin? }]
+// Node types and their fields:
+//   event (event_name), custom_event (event_name), function (function, target?),
+//   get_variable / set_variable (variable), branch, sequence (output_count?),
+//   cast (target_class), math (operation, math_type?), print_string (message?),
+//   self, component (component_name), input_action (action_name)
+// Edge endpoints name a local node id, or the GUID of a node already in the blueprint.
+// An omitted pin means the exec pin ("then" on the source, "execute" on the target).
+// Everything is created in one transaction; on any error all new nodes are removed.
+// ---------------------------------------------------------------------------
+
+namespace
+{
+    const int32 BuildLayoutColumnWidth = 400;
+    const int32 BuildLayoutRowHeight = 200;
+}
+
+template <typename NodeType>
+static NodeType* SpawnGraphNode(UEdGraph* Graph, const FVector2D& Position, TFunctionRef<void(NodeType*)> Init)
+{
+    NodeType* Node = NewObject<NodeType>(Graph);
+    Init(Node);
+    Node->NodePosX = static_cast<int32>(Position.X);
+    Node->NodePosY = static_cast<int32>(Position.Y);
+    Graph->AddNode(Node, true);
+    Node->CreateNewGuid();
+    Node->PostPlacedNewNode();
+    Node->AllocateDefaultPins();
+    return Node;
+}
+
+static UFunction* FindFunctionForSpec(UBlueprint* Blueprint, const FString& Target, const FString& FunctionName, FString& OutError)
+{
+    TArray<UClass*, TInlineAllocator<5>> SearchClasses;
+    if (!Target.IsEmpty())
+    {
+        UClass* TargetClass = FMCPClassResolver::Get().Resolve(Target);
+        if (!TargetClass)
+        {
+            OutError = FMCPClassResolver::Get().GetLastError();
+            return nullptr;
+        }
+        SearchClasses.Add(TargetClass);
+    }
+    else
+    {
+        // The skeleton class sees functions added since the last compile
+        if (Blueprint->SkeletonGeneratedClass)
+        {
+            SearchClasses.Add(Blueprint->SkeletonGeneratedClass);
+        }
+        if (Blueprint->GeneratedClass)
+        {
+            SearchClasses.Add(Blueprint->GeneratedClass);
+        }
+        SearchClasses.Add(UKismetSystemLibrary::StaticClass());
+        SearchClasses.Add(UKismetMathLibrary::StaticClass());
+        SearchClasses.Add(UGameplayStatics::StaticClass());
+    }
+
+    for (UClass* Class : SearchClasses)
+    {
+        if (UFunction* Function = Class->FindFunctionByName(*FunctionName))
+        {
+            return Function;
+        }
+        for (TFieldIterator<UFunction> FuncIt(Class); FuncIt; ++FuncIt)
+        {
+            if (FuncIt->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
+            {
+                return *FuncIt;
+            }
+        }
+    }
+
+    OutError = FString::Printf(TEXT("Function '%s' not found in %s"), *FunctionName,
+        Target.IsEmpty() ? TEXT("the blueprint or the system, math and gameplay libraries") : *Target);
+    return nullptr;
+}
+
+static UEdGraphNode* CreateNodeFromSpec(UBlueprint* Blueprint, UEdGraph* Graph, const TSharedPtr<FJsonObject>& Spec,
+                                        const FVector2D& Position, FString& OutError)
+{
+    FString Type;
+    Spec->TryGetStringField(TEXT("type"), Type);
+
+    auto RequireField = [&Spec, &OutError, &Type](const TCHAR* Field, FString& OutValue)
+    {
+        if (!Spec->TryGetStringField(Field, OutValue) || OutValue.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("'%s' node needs '%s'"), *Type, Field);
+            return false;
+        }
+        return true;
+    };
+
+    if (Type == TEXT("event"))
+    {
+        FString EventName;
+        if (!RequireField(TEXT("event_name"), EventName))
+        {
+            return nullptr;
+        }
+        UK2Node_Event* Node = FUnrealMCPCommonUtils::CreateEventNode(Graph, EventName, Position);
+        if (!Node)
+        {
+            OutError = FString::Printf(TEXT("No event named '%s' on %s"), *EventName, *Blueprint->GetName());
+        }
+        return Node;
+    }
+    if (Type == TEXT("custom_event"))
+    {
+        FString EventName;
+        if (!RequireField(TEXT("event_name"), EventName))
+        {
+            return nullptr;
+        }
+        return SpawnGraphNode<UK2Node_CustomEvent>(Graph, Position, [&EventName](UK2Node_CustomEvent* Node)
+        {
+            Node->CustomFunctionName = FName(*EventName);
+        });
+    }
+    if (Type == TEXT("function"))
+    {
+        FString FunctionName, Target;
+        if (!RequireField(TEXT("function"), FunctionName))
+        {
+            return nullptr;
+        }
+        Spec->TryGetStringField(TEXT("target"), Target);
+        UFunction* Function = FindFunctionForSpec(Blueprint, Target, FunctionName, OutError);
+        return Function ? FUnrealMCPCommonUtils::CreateFunctionCallNode(Graph, Function, Position) : nullptr;
+    }
+    if (Type == TEXT("get_variable") || Type == TEXT("set_variable"))
+    {
+        FString VariableName;
+        if (!RequireField(TEXT("variable"), VariableName))
+        {
+            return nullptr;
+        }
+        UEdGraphNode* Node = Type == TEXT("get_variable")
+            ? static_cast<UEdGraphNode*>(FUnrealMCPCommonUtils::CreateVariableGetNode(Graph, Blueprint, VariableName, Position))
+            : static_cast<UEdGraphNode*>(FUnrealMCPCommonUtils::CreateVariableSetNode(Graph, Blueprint, VariableName, Position));
+        if (!Node)
+        {
+            OutError = FString::Printf(TEXT("Variable '%s' not found on %s (compile after adding variables)"), *VariableName, *Blueprint->GetName());
+        }
+        return Node;
+    }
+    if (Type == TEXT("branch"))
+    {
+        return SpawnGraphNode<UK2Node_IfThenElse>(Graph, Position, [](UK2Node_IfThenElse*) {});
+    }
+    if (Type == TEXT("sequence"))
+    {
+        int32 OutputCount = 2;
+        Spec->TryGetNumberField(TEXT("output_count"), OutputCount);
+        UK2Node_ExecutionSequence* Node = SpawnGraphNode<UK2Node_ExecutionSequence>(Graph, Position, [](UK2Node_ExecutionSequence*) {});
+        for (int32 i = 2; i < FMath::Clamp(OutputCount, 2, 8); ++i)
+        {
+            Node->AddInputPin();
+        }
+        return Node;
+    }
+    if (Type == TEXT("cast"))
+    {
+        FString TargetClassName;
+        if (!RequireField(TEXT("target_class"), TargetClassName))
+        {
+            return nullptr;
+        }
+        UClass* TargetClass = FMCPClassResolver::Get().Resolve(TargetClassName);
+        if (!TargetClass)
+        {
+            OutError = FMCPClassResolver::Get().GetLastError();
+            return nullptr;
+        }
+        return SpawnGraphNode<UK2Node_DynamicCast>(Graph, Position, [TargetClass](UK2Node_DynamicCast* Node)
+        {
+            Node->TargetType = TargetClass;
+        });
+    }
+    if (Type == TEXT("math"))
+    {
+        FString Operation;
+        if (!RequireField(TEXT("operation"), Operation))
+        {
+            return nullptr;
+        }
+        FString MathType = TEXT("Float");
+        Spec->TryGetStringField(TEXT("math_type"), MathType);
+        const FString FuncName = BuildMathFunctionName(Operation, MathType);
+        UFunction* MathFunc = UKismetMathLibrary::StaticClass()->FindFunctionByName(*FuncName);
+        if (!MathFunc)
+        {
+            OutError = FString::Printf(TEXT("Math function '%s' not found in KismetMathLibrary"), *FuncName);
+            return nullptr;
+        }
+        return FUnrealMCPCommonUtils::CreateFunctionCallNode(Graph, MathFunc, Position);
+    }
+    if (Type == TEXT("print_string"))
+    {
+        UFunction* PrintFunc = UKismetSystemLibrary::StaticClass()->FindFunctionByName(TEXT("PrintString"));
+        UK2Node_CallFunction* Node = FUnrealMCPCommonUtils::CreateFunctionCallNode(Graph, PrintFunc, Position);
+        FString Message;
+        if (Node && Spec->TryGetStringField(TEXT("message"), Message))
+        {
+            if (UEdGraphPin* InStringPin = Node->FindPin(TEXT("InString"), EGPD_Input))
+            {
+                InStringPin->DefaultValue = Message;
+            }
+        }
+        return Node;
+    }
+    if (Type == TEXT("self"))
+    {
+        return FUnrealMCPCommonUtils::CreateSelfReferenceNode(Graph, Position);
+    }
+    if (Type == TEXT("component"))
+    {
+        FString ComponentName;
+        if (!RequireField(TEXT("component_name"), ComponentName))
+        {
+            return nullptr;
+        }
+        UK2Node_VariableGet* Node = SpawnGraphNode<UK2Node_VariableGet>(Graph, Position, [&ComponentName](UK2Node_VariableGet* GetNode)
+        {
+            GetNode->VariableReference.SetSelfMember(FName(*ComponentName));
+        });
+        Node->ReconstructNode();
+        return Node;
+    }
+    if (Type == TEXT("input_action"))
+    {
+        FString ActionName;
+        if (!RequireField(TEXT("action_name"), ActionName))
+        {
+            return nullptr;
+        }
+        return FUnrealMCPCommonUtils::CreateInputActionNode(Graph, ActionName, Position);
+    }
+
+    OutError = FString::Printf(TEXT("Unknown node type '%s'"), *Type);
+    return nullptr;
+}
+
+/** Pin lookup without FindPin's per-pin logging; matches the pin name, then the display name. */
+static UEdGraphPin* FindBuildPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction)
+{
+    if (PinName.IsEmpty())
+    {
+        // Default to the exec pin on that side
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin->Direction == Direction && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec && !Pin->bHidden)
+            {
+                return Pin;
+            }
+        }
+        return nullptr;
+    }
+
+    for (UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin->Direction == Direction && Pin->PinName.ToString() == PinName)
+        {
+            return Pin;
+        }
+    }
+    for (UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin->Direction == Direction && Pin->GetDisplayName().ToString() == PinName)
+        {
+            return Pin;
+        }
+    }
+    return nullptr;
+}
+
+static bool SetBuildPinDefault(const UEdGraphSchema_K2* Schema, UEdGraphPin* Pin, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+{
+    const FName Category = Pin->PinType.PinCategory;
+    const bool bIntegralPin = Category == UEdGraphSchema_K2::PC_Int
+        || Category == UEdGraphSchema_K2::PC_Int64
+        || Category == UEdGraphSchema_K2::PC_Byte;
+
+    FString StringValue;
+    if (Value->Type == EJson::Boolean)
+    {
+        StringValue = Value->AsBool() ? TEXT("true") : TEXT("false");
+    }
+    else if (Value->Type == EJson::Number && bIntegralPin)
+    {
+        // SanitizeFloat would give "5.0", which integer pins reject
+        const double Number = Value->AsNumber();
+        if (Number != FMath::RoundToDouble(Number))
+        {
+            OutError = FString::Printf(TEXT("%s pin needs a whole number, got %s"), *Category.ToString(), *FString::SanitizeFloat(Number));
+            return false;
+        }
+        StringValue = FString::Printf(TEXT("%lld"), static_cast<int64>(Number));
+    }
+    else if (Value->Type == EJson::Number)
+    {
+        StringValue = FString::SanitizeFloat(Value->AsNumber());
+    }
+    else
+    {
+        StringValue = Value->AsString();
+    }
+
+    if (Category == UEdGraphSchema_K2::PC_Class || Category == UEdGraphSchema_K2::PC_SoftClass
+        || Category == UEdGraphSchema_K2::PC_Object || Category == UEdGraphSchema_K2::PC_SoftObject)
+    {
+        UObject* Object = nullptr;
+        if (Category == UEdGraphSchema_K2::PC_Class || Category == UEdGraphSchema_K2::PC_SoftClass)
+        {
+            Object = FMCPClassResolver::Get().Resolve(StringValue);
+            if (!Object)
+            {
+                OutError = FMCPClassResolver::Get().GetLastError();
+                return false;
+            }
+        }
+        else
+        {
+            Object = LoadObject<UObject>(nullptr, *StringValue);
+            if (!Object)
+            {
+                OutError = FString::Printf(TEXT("Object not found: %s"), *StringValue);
+                return false;
+            }
+        }
+
+        OutError = Schema->IsPinDefaultValid(Pin, FString(), Object, FText::GetEmpty());
+        if (!OutError.IsEmpty())
+        {
+            return false;
+        }
+        Schema->TrySetDefaultObject(*Pin, Object);
+        return true;
+    }
+
+    // TrySetDefaultValue does not report rejected values; they would only surface at compile
+    const FText TextValue = Category == UEdGraphSchema_K2::PC_Text ? FText::FromString(StringValue) : FText::GetEmpty();
+    OutError = Schema->IsPinDefaultValid(Pin, StringValue, nullptr, TextValue);
+    if (!OutError.IsEmpty())
+    {
+        return false;
+    }
+    Schema->TrySetDefaultValue(*Pin, StringValue);
+    return true;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleBuildBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* NodeSpecs = nullptr;
+    if (!Params->TryGetArrayField(TEXT("nodes"), NodeSpecs) || NodeSpecs->Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'nodes' parameter"));
+    }
+    const TArray<TSharedPtr<FJsonValue>>* EdgeSpecs = nullptr;
+    Params->TryGetArrayField(TEXT("edges"), EdgeSpecs);
+
+    bool bCompile = true;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
+    }
+
+    UEdGraph* Graph = GetTargetGraph(Blueprint, Params);
+    if (!Graph)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Target graph not found"));
+    }
+    const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+    // Validate the specification before touching the graph
+    TArray<TSharedPtr<FJsonObject>> Specs;
+    TMap<FString, int32> LocalIndex;
+    for (const TSharedPtr<FJsonValue>& Value : *NodeSpecs)
+    {
+        const TSharedPtr<FJsonObject>* SpecObj = nullptr;
+        FString LocalId;
+        if (!Value->TryGetObject(SpecObj) || !(*SpecObj)->TryGetStringField(TEXT("id"), LocalId) || LocalId.IsEmpty())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("nodes[%d] needs an 'id'"), Specs.Num()));
+        }
+        if (LocalIndex.Contains(LocalId))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Duplicate node id '%s'"), *LocalId));
+        }
+        LocalIndex.Add(LocalId, Specs.Num());
+        Specs.Add(*SpecObj);
+    }
+
+    struct FEdgeSpec
+    {
+        FString From, FromPin, To, ToPin;
+    };
+    TArray<FEdgeSpec> Edges;
+    if (EdgeSpecs)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *EdgeSpecs)
+        {
+            const TSharedPtr<FJsonObject>* EdgeObj = nullptr;
+            FEdgeSpec Edge;
+            if (!Value->TryGetObject(EdgeObj)
+                || !(*EdgeObj)->TryGetStringField(TEXT("from"), Edge.From)
+                || !(*EdgeObj)->TryGetStringField(TEXT("to"), Edge.To))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("edges[%d] needs 'from' and 'to'"), Edges.Num()));
+            }
+            (*EdgeObj)->TryGetStringField(TEXT("from_pin"), Edge.FromPin);
+            (*EdgeObj)->TryGetStringField(TEXT("to_pin"), Edge.ToPin);
+            Edges.Add(MoveTemp(Edge));
+        }
+    }
+
+    // Layered layout: each node sits one column right of the furthest node feeding it
+    TArray<int32> Column;
+    Column.Init(0, Specs.Num());
+    {
+        TArray<TArray<int32>> Successors;
+        Successors.SetNum(Specs.Num());
+        TArray<int32> InDegree;
+        InDegree.Init(0, Specs.Num());
+        for (const FEdgeSpec& Edge : Edges)
+        {
+            const int32* FromIndex = LocalIndex.Find(Edge.From);
+            const int32* ToIndex = LocalIndex.Find(Edge.To);
+            if (FromIndex && ToIndex && *FromIndex != *ToIndex)
+            {
+                Successors[*FromIndex].Add(*ToIndex);
+                ++InDegree[*ToIndex];
+            }
+        }
+
+        TArray<int32> Ready;
+        for (int32 i = 0; i < Specs.Num(); ++i)
+        {
+            if (InDegree[i] == 0)
+            {
+                Ready.Add(i);
+            }
+        }
+        int32 Visited = 0;
+        int32 MaxColumn = 0;
+        for (int32 Cursor = 0; Cursor < Ready.Num(); ++Cursor)
+        {
+            const int32 Index = Ready[Cursor];
+            ++Visited;
+            MaxColumn = FMath::Max(MaxColumn, Column[Index]);
+            for (int32 Next : Successors[Index])
+            {
+                Column[Next] = FMath::Max(Column[Next], Column[Index] + 1);
+                if (--InDegree[Next] == 0)
+                {
+                    Ready.Add(Next);
+                }
+            }
+        }
+        // Nodes on a cycle (loops wired back) go after everything else
+        if (Visited < Specs.Num())
+        {
+            for (int32 i = 0; i < Specs.Num(); ++i)
+            {
+                if (InDegree[i] > 0)
+                {
+                    Column[i] = MaxColumn + 1;
+                }
+            }
+        }
+    }
+
+    FVector2D Origin(0.f, 0.f);
+    if (Params->HasField(TEXT("origin")))
+    {
+        Origin = FUnrealMCPCommonUtils::GetVector2DFromJson(Params, TEXT("origin"));
+    }
+    else if (Graph->Nodes.Num() > 0)
+    {
+        int32 MaxY = TNumericLimits<int32>::Lowest();
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node)
+            {
+                MaxY = FMath::Max(MaxY, Node->NodePosY);
+            }
+        }
+        Origin.Y = MaxY + BuildLayoutRowHeight * 2;
+    }
+
+    FScopedTransaction Transaction(FText::FromString(TEXT("MCP Build Blueprint Graph")));
+    Blueprint->Modify();
+    Graph->Modify();
+
+    // Event nodes may resolve to ones already in the graph; only what this call added is rolled back
+    TSet<UEdGraphNode*> ExistingNodes;
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        ExistingNodes.Add(Node);
+    }
+    TArray<UEdGraphNode*> Nodes;
+    Nodes.Reserve(Specs.Num());
+
+    // Link lists of existing pins, saved before wiring. Cancelling the transaction only drops
+    // the undo record, so a failed call restores these itself: TryCreateConnection may have
+    // wired existing nodes together or broken their other links (single-link exec outputs,
+    // CONNECT_RESPONSE_BREAK_OTHERS_*). Pins are kept by id since wiring can reconstruct nodes.
+    struct FPinRef
+    {
+        UEdGraphNode* Node = nullptr;
+        FGuid PinId;
+    };
+    TArray<TPair<FPinRef, TArray<FPinRef>>> SavedLinks;
+    TSet<UEdGraphPin*> SavedPins;
+    auto SaveLinks = [&](UEdGraphPin* Pin)
+    {
+        if (SavedPins.Contains(Pin) || !ExistingNodes.Contains(Pin->GetOwningNode()))
+        {
+            return;
+        }
+        SavedPins.Add(Pin);
+        TArray<FPinRef> Links;
+        for (UEdGraphPin* Linked : Pin->LinkedTo)
+        {
+            Links.Add({ Linked->GetOwningNode(), Linked->PinId });
+        }
+        SavedLinks.Add({ { Pin->GetOwningNode(), Pin->PinId }, MoveTemp(Links) });
+    };
+
+    auto Fail = [&](const FString& Message)
+    {
+        TArray<UEdGraphNode*> Added;
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!ExistingNodes.Contains(Node))
+            {
+                Added.Add(Node);
+            }
+        }
+        for (UEdGraphNode* Node : Added)
+        {
+            FBlueprintEditorUtils::RemoveNode(Blueprint, Node, true);
+        }
+
+        TSet<UEdGraphNode*> RestoredNodes;
+        for (const TPair<FPinRef, TArray<FPinRef>>& Saved : SavedLinks)
+        {
+            UEdGraphPin* Pin = Saved.Key.Node->FindPinById(Saved.Key.PinId);
+            if (!Pin)
+            {
+                continue;
+            }
+            Pin->LinkedTo.Reset();
+            for (const FPinRef& Link : Saved.Value)
+            {
+                if (UEdGraphPin* Linked = Link.Node->FindPinById(Link.PinId))
+                {
+                    Pin->LinkedTo.Add(Linked);
+                }
+            }
+            RestoredNodes.Add(Saved.Key.Node);
+        }
+        for (UEdGraphNode* Node : RestoredNodes)
+        {
+            Node->NodeConnectionListChanged();
+        }
+
+        Transaction.Cancel();
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Message);
+    };
+
+    // Create every node
+    TMap<int32, int32> RowsPerColumn;
+    for (int32 i = 0; i < Specs.Num(); ++i)
+    {
+        const TSharedPtr<FJsonObject>& Spec = Specs[i];
+        FVector2D Position;
+        if (Spec->HasField(TEXT("position")))
+        {
+            Position = FUnrealMCPCommonUtils::GetVector2DFromJson(Spec, TEXT("position"));
+        }
+        else
+        {
+            int32& Row = RowsPerColumn.FindOrAdd(Column[i]);
+            Position = Origin + FVector2D(Column[i] * BuildLayoutColumnWidth, Row * BuildLayoutRowHeight);
+            ++Row;
+        }
+
+        FString Error;
+        UEdGraphNode* Node = CreateNodeFromSpec(Blueprint, Graph, Spec, Position, Error);
+        if (!Node)
+        {
+            FString LocalId;
+            Spec->TryGetStringField(TEXT("id"), LocalId);
+            return Fail(FString::Printf(TEXT("Node '%s': %s"), *LocalId, Error.IsEmpty() ? TEXT("creation failed") : *Error));
+        }
+        Nodes.Add(Node);
+
+        const TSharedPtr<FJsonObject>* PinDefaults = nullptr;
+        if (Spec->TryGetObjectField(TEXT("pins"), PinDefaults))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& PinDefault : (*PinDefaults)->Values)
+            {
+                UEdGraphPin* Pin = FindBuildPin(Node, PinDefault.Key, EGPD_Input);
+                if (!Pin)
+                {
+                    return Fail(FString::Printf(TEXT("Node '%s' has no input pin '%s'"), *Spec->GetStringField(TEXT("id")), *PinDefault.Key));
+                }
+                if (!SetBuildPinDefault(Schema, Pin, PinDefault.Value, Error))
+                {
+                    return Fail(FString::Printf(TEXT("Node '%s' pin '%s': %s"), *Spec->GetStringField(TEXT("id")), *PinDefault.Key, *Error));
+                }
+            }
+        }
+    }
+
+    // Wire every edge
+    auto ResolveEndpoint = [&](const FString& Id) -> UEdGraphNode*
+    {
+        if (const int32* Index = LocalIndex.Find(Id))
+        {
+            return Nodes[*Index];
+        }
+        UEdGraphNode* Existing = FMCPBlueprintNodeIndex::Get().FindNode(Blueprint, Id);
+        return Existing && Existing->GetGraph() == Graph ? Existing : nullptr;
+    };
+
+    // First pass: resolve every endpoint and pin before anything is wired, and save the
+    // links of the existing pins involved (and of the pins they link to, whose lists change
+    // when a link is broken)
+    for (const FEdgeSpec& Edge : Edges)
+    {
+        UEdGraphNode* FromNode = ResolveEndpoint(Edge.From);
+        UEdGraphNode* ToNode = ResolveEndpoint(Edge.To);
+        if (!FromNode || !ToNode)
+        {
+            return Fail(FString::Printf(TEXT("Edge %s -> %s: unknown node '%s'"), *Edge.From, *Edge.To, FromNode ? *Edge.To : *Edge.From));
+        }
+
+        UEdGraphPin* FromPin = FindBuildPin(FromNode, Edge.FromPin, EGPD_Output);
+        UEdGraphPin* ToPin = FindBuildPin(ToNode, Edge.ToPin, EGPD_Input);
+        if (!FromPin || !ToPin)
+        {
+            return Fail(FString::Printf(TEXT("Edge %s.%s -> %s.%s: pin not found on '%s'"),
+                *Edge.From, *Edge.FromPin, *Edge.To, *Edge.ToPin, FromPin ? *Edge.To : *Edge.From));
+        }
+
+        for (UEdGraphPin* Pin : { FromPin, ToPin })
+        {
+            SaveLinks(Pin);
+            for (UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                SaveLinks(Linked);
+            }
+        }
+    }
+
+    for (const FEdgeSpec& Edge : Edges)
+    {
+        // Resolved again: wiring an earlier edge may have reconstructed a node's pins
+        UEdGraphNode* FromNode = ResolveEndpoint(Edge.From);
+        UEdGraphNode* ToNode = ResolveEndpoint(Edge.To);
+        UEdGraphPin* FromPin = FindBuildPin(FromNode, Edge.FromPin, EGPD_Output);
+        UEdGraphPin* ToPin = FindBuildPin(ToNode, Edge.ToPin, EGPD_Input);
+        if (!FromPin || !ToPin)
+        {
+            return Fail(FString::Printf(TEXT("Edge %s.%s -> %s.%s: pin not found on '%s'"),
+                *Edge.From, *Edge.FromPin, *Edge.To, *Edge.ToPin, FromPin ? *Edge.To : *Edge.From));
+        }
+
+        const FPinConnectionResponse Response = Schema->CanCreateConnection(FromPin, ToPin);
+        if (Response.Response == CONNECT_RESPONSE_DISALLOW || !Schema->TryCreateConnection(FromPin, ToPin))
+        {
+            return Fail(FString::Printf(TEXT("Edge %s.%s -> %s.%s: %s"), *Edge.From, *FromPin->PinName.ToString(),
+                *Edge.To, *ToPin->PinName.ToString(), *Response.Message.ToString()));
+        }
+    }
+
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+
+    TSharedPtr<FJsonObject> NodeMap = MakeShared<FJsonObject>();
+    for (const TPair<FString, int32>& Pair : LocalIndex)
+    {
+        NodeMap->SetStringField(Pair.Key, Nodes[Pair.Value]->NodeGuid.ToString());
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("graph"), Graph->GetName());
+    Result->SetObjectField(TEXT("nodes"), NodeMap);
+    Result->SetNumberField(TEXT("edges_connected"), Edges.Num());
+
+    if (bCompile)
+    {
+        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        Result->SetBoolField(TEXT("compiled"), Blueprint->Status != BS_Error);
+        Result->SetStringField(TEXT("compile_status"), Blueprint->Status == BS_Error ? TEXT("error")
+            : Blueprint->Status == BS_UpToDateWithWarnings ? TEXT("warnings") : TEXT("ok"));
+    }
+    return Result;
+}
@@ -1,4 +1,6 @@
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "MCPBlueprintResolver.h"
+#include "MCPPropertyPath.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
@@ -149,6 +151,54 @@ FRotator FUnrealMCPCommonUtils::GetRotatorFromJson(const TSharedPtr<FJsonObject>
     return Result;
 }
 
+bool FUnrealMCPCommonUtils::GetPackedTransformsFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName,
+                                                        TArray<double>& OutValues, int32& OutStride, FString& OutError)
+{
+    const TArray<TSharedPtr<FJsonValue>>* JsonArray = nullptr;
+    if (!JsonObject->TryGetArrayField(FieldName, JsonArray))
+    {
+        OutError = FString::Printf(TEXT("Missing '%s' parameter"), *FieldName);
+        return false;
+    }
+
+    OutStride = 9;
+    JsonObject->TryGetNumberField(TEXT("stride"), OutStride);
+    if (OutStride != 3 && OutStride != 6 && OutStride != 9)
+    {
+        OutError = FString::Printf(TEXT("Invalid stride %d (expected 3, 6 or 9)"), OutStride);
+        return false;
+    }
+    if (JsonArray->Num() % OutStride != 0)
+    {
+        OutError = FString::Printf(TEXT("'%s' length %d is not a multiple of stride %d"),
+                                   *FieldName, JsonArray->Num(), OutStride);
+        return false;
+    }
+
+    OutValues.Reset(JsonArray->Num());
+    for (const TSharedPtr<FJsonValue>& Value : *JsonArray)
+    {
+        OutValues.Add(Value->AsNumber());
+    }
+    return true;
+}
+
+FTransform FUnrealMCPCommonUtils::UnpackTransform(const TArray<double>& Values, int32 Stride, int32 Index, const FTransform& Base)
+{
+    const double* V = Values.GetData() + Index * Stride;
+    FTransform Result = Base;
+    Result.SetLocation(FVector(V[0], V[1], V[2]));
+    if (Stride >= 6)
+    {
+        Result.SetRotation(FQuat(FRotator(V[3], V[4], V[5])));
+    }
+    if (Stride >= 9)
+    {
+        Result.SetScale3D(FVector(V[6], V[7], V[8]));
+    }
+    return Result;
+}
+
 // Blueprint Utilities
 UBlueprint* FUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintName)
 {
@@ -156,13 +206,16 @@ UBlueprint* FUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintName)
 }
 
 UBlueprint* FUnrealMCPCommonUtils::FindBlueprintByName(const FString& BlueprintName,
-                                                         const FString& AssetPath)
+                                                         const FString& AssetPath,
+                                                         const FString& DefaultFolder)
 {
-    // Use the provided path if given; otherwise fall back to the default location.
-    FString ResolvedPath = AssetPath.IsEmpty()
-        ? (TEXT("/Game/Blueprints/") + BlueprintName)
-        : AssetPath;
-    return LoadObject<UBlueprint>(nullptr, *ResolvedPath);
+    return FMCPBlueprintResolver::Get().Resolve(AssetPath.IsEmpty() ? BlueprintName : AssetPath, DefaultFolder);
+}
+
+FString FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(const FString& BlueprintName)
+{
+    const FString& Error = FMCPBlueprintResolver::Get().GetLastError();
+    return Error.IsEmpty() ? FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName) : Error;
 }
 
 UEdGraph* FUnrealMCPCommonUtils::FindOrCreateEventGraph(UBlueprint* Blueprint)
@@ -526,192 +579,15 @@ bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& Pr
         return false;
     }
 
-    FProperty* Property = Object->GetClass()->FindPropertyByName(*PropertyName);
-    if (!Property)
-    {
-        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
-        return false;
-    }
-
-    void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(Object);
-    
-    // Handle different property types
-    if (Property->IsA<FBoolProperty>())
+    // PropertyName may be a path ("BodyInstance.MassInKgOverride", "Tags[2]"); see FMCPPropertyPath
+    TArray<TPair<FString, TSharedPtr<FJsonValue>>> Values;
+    Values.Emplace(PropertyName, Value);
+    TArray<FString> Errors;
+    if (FMCPPropertyPath::Get().SetProperties(Object, Values, Errors) == 1)
     {
-        ((FBoolProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsBool());
         return true;
     }
-    else if (Property->IsA<FIntProperty>())
-    {
-        int32 IntValue = static_cast<int32>(Value->AsNumber());
-        FIntProperty* IntProperty = CastField<FIntProperty>(Property);
-        if (IntProperty)
-        {
-            IntProperty->SetPropertyValue_InContainer(Object, IntValue);
-            return true;
-        }
-    }
-    else if (Property->IsA<FFloatProperty>())
-    {
-        ((FFloatProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
-        return true;
-    }
-    else if (Property->IsA<FStrProperty>())
-    {
-        ((FStrProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsString());
-        return true;
-    }
-    else if (Property->IsA<FByteProperty>())
-    {
-        FByteProperty* ByteProp = CastField<FByteProperty>(Property);
-        UEnum* EnumDef = ByteProp ? ByteProp->GetIntPropertyEnum() : nullptr;
-        
-        // If this is a TEnumAsByte property (has associated enum)
-        if (EnumDef)
-        {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
-            {
-                uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-                ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %d"), 
-                      *PropertyName, ByteValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    uint8 ByteValue = FCString::Atoi(*EnumValueName);
-                    ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
-                          *PropertyName, *EnumValueName, ByteValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names (e.g., "Player0" or "EAutoReceiveInput::Player0")
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    ByteProp->SetPropertyValue(PropertyAddr, static_cast<uint8>(EnumValue));
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
-                }
-            }
-        }
-        else
-        {
-            // Regular byte property
-            uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-            ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-            return true;
-        }
-    }
-    else if (Property->IsA<FEnumProperty>())
-    {
-        FEnumProperty* EnumProp = CastField<FEnumProperty>(Property);
-        UEnum* EnumDef = EnumProp ? EnumProp->GetEnum() : nullptr;
-        FNumericProperty* UnderlyingNumericProp = EnumProp ? EnumProp->GetUnderlyingProperty() : nullptr;
-        
-        if (EnumDef && UnderlyingNumericProp)
-        {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
-            {
-                int64 EnumValue = static_cast<int64>(Value->AsNumber());
-                UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %lld"), 
-                      *PropertyName, EnumValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    int64 EnumValue = FCString::Atoi64(*EnumValueName);
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
-                }
-            }
-        }
-    }
-    
-    OutErrorMessage = FString::Printf(TEXT("Unsupported property type: %s for property %s"), 
-                                    *Property->GetClass()->GetName(), *PropertyName);
+
+    OutErrorMessage = Errors.Num() > 0 ? Errors[0] : FString::Printf(TEXT("Could not set %s"), *PropertyName);
     return false;
-} 
\ No newline at end of file
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPDiagnosticsCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "MCPSourceFiles.h"
 
 // Editor / Viewport
 #include "Editor.h"
@@ -19,6 +20,8 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/DateTime.h"
+#include "Misc/ScopeLock.h"
+#include "Algo/AnyOf.h"
 
 // Module management (for LiveCoding status)
 #include "Modules/ModuleManager.h"
@@ -45,9 +48,14 @@ void FUnrealMCPDiagnosticsCommands::RegisterCommands(FMCPCommandRegistry& Regist
 
     // Source file access
     Registry.RegisterCommand(TEXT("get_source_file"),
-        [this](const TSharedPtr<FJsonObject>& P) { return HandleGetSourceFile(P); });
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleGetSourceFile(P); },
+        []() { return true; });
+    Registry.RegisterCommand(TEXT("search_source"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleSearchSource(P); },
+        []() { return true; });
     Registry.RegisterCommand(TEXT("modify_source_file"),
-        [this](const TSharedPtr<FJsonObject>& P) { return HandleModifySourceFile(P); });
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleModifySourceFile(P); },
+        []() { return true; });
 
     // Engine / project path
     Registry.RegisterCommand(TEXT("get_engine_path"),
@@ -304,6 +312,27 @@ TSharedPtr<FJsonObject> FUnrealMCPDiagnosticsCommands::HandleGetLiveCodingStatus
 // Source file access
 // ---------------------------------------------------------------------------
 
+/** JSON number to an int64 within [Min, Max]; out-of-range or NaN input never reaches the cast. */
+static int64 ClampNumber(double Value, int64 Min, int64 Max)
+{
+    if (!(Value > static_cast<double>(Min)))
+    {
+        return Min;
+    }
+    return Value < static_cast<double>(Max) ? static_cast<int64>(Value) : Max;
+}
+
+// get_source_file
+// Params: path (string, required; relative paths resolve against the project dir)
+//         start_line / end_line / max_lines (int, 1-based, inclusive) - line range
+//         offset / length (int, bytes) - byte range, snapped to UTF-8 boundaries
+//         if_hash (string) - content hash the client already has
+// Returns: path, hash (SHA-1 of the file), mtime, size (bytes) and content.
+//          Line ranges add start_line, end_line, total_lines, has_more; byte
+//          ranges add offset, length, next_offset, has_more. When if_hash
+//          matches, not_modified is true and content is omitted.
+// The file is memory-mapped, so a range only copies the lines it returns.
+// Runs on the server thread.
 TSharedPtr<FJsonObject> FUnrealMCPDiagnosticsCommands::HandleGetSourceFile(
     const TSharedPtr<FJsonObject>& Params)
 {
@@ -313,35 +342,271 @@ TSharedPtr<FJsonObject> FUnrealMCPDiagnosticsCommands::HandleGetSourceFile(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'path' parameter"));
     }
 
-    // Resolve relative to project dir if not absolute
-    FString AbsolutePath = RelativePath;
-    if (FPaths::IsRelative(RelativePath))
-    {
-        AbsolutePath = FPaths::ConvertRelativePathToFull(
-            FPaths::ProjectDir() / RelativePath);
-    }
-
-    if (!FPaths::FileExists(AbsolutePath))
+    const FString AbsolutePath = FMCPSourceFiles::ResolvePath(RelativePath);
+    const FDateTime ModTime = IFileManager::Get().GetTimeStamp(*AbsolutePath);
+    if (ModTime == FDateTime::MinValue())
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(
             FString::Printf(TEXT("File not found: %s"), *AbsolutePath));
     }
 
-    FString FileContent;
-    if (!FFileHelper::LoadFileToString(FileContent, *AbsolutePath))
+    FMCPFileView View;
+    FString Error;
+    if (!View.Open(AbsolutePath, Error))
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to read file: %s"), *AbsolutePath));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
     }
 
+    const uint8* Data = View.GetData();
+    const int64 Size = View.GetSize();
+    const FString Hash = FMCPSourceFiles::HashBytes(Data, Size);
+
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
     ResultObj->SetStringField(TEXT("path"), AbsolutePath);
-    ResultObj->SetStringField(TEXT("content"), FileContent);
-    ResultObj->SetNumberField(TEXT("size"), FileContent.Len());
+    ResultObj->SetStringField(TEXT("hash"), Hash);
+    ResultObj->SetStringField(TEXT("mtime"), ModTime.ToIso8601());
+    ResultObj->SetNumberField(TEXT("size"), static_cast<double>(Size));
+
+    FString IfHash;
+    const bool bNotModified = Params->TryGetStringField(TEXT("if_hash"), IfHash) && IfHash.Equals(Hash, ESearchCase::IgnoreCase);
+    ResultObj->SetBoolField(TEXT("not_modified"), bNotModified);
+    if (bNotModified)
+    {
+        return ResultObj;
+    }
+
+    const int64 TextStart = View.GetTextStart();
+    double Number = 0.0;
+
+    if (Params->HasField(TEXT("offset")) || Params->HasField(TEXT("length")))
+    {
+        int64 RangeStart = Params->TryGetNumberField(TEXT("offset"), Number) ? ClampNumber(Number, 0, Size) : 0;
+        RangeStart = FMath::Max(RangeStart, TextStart);
+        int64 RangeEnd = Size;
+        if (Params->TryGetNumberField(TEXT("length"), Number) && Number > 0.0)
+        {
+            RangeEnd = RangeStart + ClampNumber(Number, 0, Size - RangeStart);
+        }
+
+        // Never split a multi-byte character: start on a lead byte, stop before the next one
+        while (RangeStart < Size && FMCPSourceFiles::IsUtf8Continuation(Data[RangeStart]))
+        {
+            ++RangeStart;
+        }
+        RangeEnd = FMath::Max(RangeEnd, RangeStart);
+        while (RangeEnd < Size && RangeEnd > RangeStart && FMCPSourceFiles::IsUtf8Continuation(Data[RangeEnd]))
+        {
+            --RangeEnd;
+        }
+        // A length shorter than the character at offset would snap to nothing and a paging
+        // client would never advance; return that whole character instead
+        if (RangeEnd == RangeStart && RangeStart < Size)
+        {
+            ++RangeEnd;
+            while (RangeEnd < Size && FMCPSourceFiles::IsUtf8Continuation(Data[RangeEnd]))
+            {
+                ++RangeEnd;
+            }
+        }
+
+        ResultObj->SetStringField(TEXT("content"), FMCPSourceFiles::Utf8ToString(Data + RangeStart, RangeEnd - RangeStart));
+        ResultObj->SetNumberField(TEXT("offset"), static_cast<double>(RangeStart));
+        ResultObj->SetNumberField(TEXT("length"), static_cast<double>(RangeEnd - RangeStart));
+        ResultObj->SetNumberField(TEXT("next_offset"), static_cast<double>(RangeEnd));
+        ResultObj->SetBoolField(TEXT("has_more"), RangeEnd < Size);
+        return ResultObj;
+    }
+
+    if (Params->HasField(TEXT("start_line")) || Params->HasField(TEXT("end_line")) || Params->HasField(TEXT("max_lines")))
+    {
+        // A file of Size bytes has at most Size + 1 lines; larger requests mean "to the end"
+        const int64 MaxLine = Size + 1;
+        const int64 StartLine = Params->TryGetNumberField(TEXT("start_line"), Number) ? ClampNumber(Number, 1, MaxLine + 1) : 1;
+        int64 EndLine = MAX_int64;
+        if (Params->TryGetNumberField(TEXT("end_line"), Number))
+        {
+            EndLine = ClampNumber(Number, 0, MaxLine);
+        }
+        else if (Params->TryGetNumberField(TEXT("max_lines"), Number) && Number > 0.0)
+        {
+            EndLine = StartLine + ClampNumber(Number, 1, MaxLine) - 1;
+        }
+
+        // One pass over the mapped bytes: find where the range starts and ends
+        // and keep counting so the client learns total_lines
+        int64 Line = 1;
+        int64 RangeStart = StartLine == 1 ? TextStart : -1;
+        int64 RangeEnd = Size;
+        int64 Pos = TextStart;
+        while (Pos < Size)
+        {
+            const uint8* Newline = static_cast<const uint8*>(memchr(Data + Pos, '\n', Size - Pos));
+            if (!Newline)
+            {
+                break;
+            }
+            Pos = (Newline - Data) + 1;
+            ++Line;   // Line now starts at Pos
+            if (Line == StartLine)
+            {
+                RangeStart = Pos;
+            }
+            if (Line - 1 == EndLine)
+            {
+                RangeEnd = Pos;
+            }
+        }
+        const int64 TotalLines = (Size > TextStart && Data[Size - 1] != '\n') ? Line : Line - 1;
+        if (RangeStart < 0 || EndLine < StartLine)
+        {
+            RangeStart = RangeEnd = Size;
+        }
+
+        ResultObj->SetStringField(TEXT("content"), FMCPSourceFiles::Utf8ToString(Data + RangeStart, RangeEnd - RangeStart));
+        ResultObj->SetNumberField(TEXT("start_line"), static_cast<double>(StartLine));
+        ResultObj->SetNumberField(TEXT("end_line"), static_cast<double>(FMath::Min(EndLine, TotalLines)));
+        ResultObj->SetNumberField(TEXT("total_lines"), static_cast<double>(TotalLines));
+        ResultObj->SetBoolField(TEXT("has_more"), EndLine < TotalLines);
+        return ResultObj;
+    }
+
+    ResultObj->SetStringField(TEXT("content"), FMCPSourceFiles::Utf8ToString(Data + TextStart, Size - TextStart));
     return ResultObj;
 }
 
+static void ReadStringArray(const TSharedPtr<FJsonObject>& Params, const TCHAR* Field, TArray<FString>& OutValues)
+{
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (Params->TryGetArrayField(Field, Values))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            OutValues.Add(Value->AsString());
+        }
+    }
+}
+
+// search_source
+// Params: pattern (string, required), regex (bool, default false; ICU syntax),
+//         case_sensitive (bool, default true),
+//         include_plugins (bool, default false) - also search project plugins' Source/
+//         paths (array, optional) - directories to search instead, relative to the project dir
+//         include / exclude (arrays of wildcards, optional; "*.h", "Source/MyGame/Private/*")
+//         context_lines (int, default 0, max 20), max_results (int, default 200, max 5000),
+//         max_per_file (int, optional)
+// Returns: matches[] {file, line, column, text, before[], after[]}, match_count,
+//          files_searched, files_matched, truncated, elapsed_ms
+// Runs on the server thread.
+TSharedPtr<FJsonObject> FUnrealMCPDiagnosticsCommands::HandleSearchSource(
+    const TSharedPtr<FJsonObject>& Params)
+{
+    FMCPSourceSearchOptions Options;
+    if (!Params->TryGetStringField(TEXT("pattern"), Options.Pattern) || Options.Pattern.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
+    }
+    Params->TryGetBoolField(TEXT("regex"), Options.bRegex);
+    Params->TryGetBoolField(TEXT("case_sensitive"), Options.bCaseSensitive);
+    ReadStringArray(Params, TEXT("include"), Options.Include);
+    ReadStringArray(Params, TEXT("exclude"), Options.Exclude);
+
+    double Number = 0.0;
+    if (Params->TryGetNumberField(TEXT("context_lines"), Number))
+    {
+        Options.ContextLines = FMath::Clamp(static_cast<int32>(Number), 0, 20);
+    }
+    if (Params->TryGetNumberField(TEXT("max_results"), Number))
+    {
+        Options.MaxResults = FMath::Clamp(static_cast<int32>(Number), 1, 5000);
+    }
+    if (Params->TryGetNumberField(TEXT("max_per_file"), Number))
+    {
+        Options.MaxPerFile = FMath::Max(0, static_cast<int32>(Number));
+    }
+
+    TArray<FString> Paths;
+    ReadStringArray(Params, TEXT("paths"), Paths);
+    if (Paths.Num() > 0)
+    {
+        for (const FString& Path : Paths)
+        {
+            const FString Root = FMCPSourceFiles::ResolvePath(Path);
+            if (!FPaths::DirectoryExists(Root))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(
+                    FString::Printf(TEXT("Directory not found: %s"), *Root));
+            }
+            Options.Roots.Add(Root);
+        }
+    }
+    else
+    {
+        bool bIncludePlugins = false;
+        Params->TryGetBoolField(TEXT("include_plugins"), bIncludePlugins);
+        Options.Roots = FMCPSourceFiles::GetSourceRoots(bIncludePlugins);
+    }
+
+    const double Start = FPlatformTime::Seconds();
+    FMCPSourceSearchResult Result;
+    FMCPSourceFiles::Search(Options, Result);
+    const double ElapsedMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+    TArray<TSharedPtr<FJsonValue>> MatchValues;
+    MatchValues.Reserve(Result.Matches.Num());
+    for (const FMCPSourceMatch& Match : Result.Matches)
+    {
+        TSharedPtr<FJsonObject> MatchObj = MakeShared<FJsonObject>();
+        MatchObj->SetStringField(TEXT("file"), Match.File);
+        MatchObj->SetNumberField(TEXT("line"), static_cast<double>(Match.Line));
+        MatchObj->SetNumberField(TEXT("column"), Match.Column);
+        MatchObj->SetStringField(TEXT("text"), Match.Text);
+        if (Options.ContextLines > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> Before;
+            for (const FString& Line : Match.Before)
+            {
+                Before.Add(MakeShared<FJsonValueString>(Line));
+            }
+            TArray<TSharedPtr<FJsonValue>> After;
+            for (const FString& Line : Match.After)
+            {
+                After.Add(MakeShared<FJsonValueString>(Line));
+            }
+            MatchObj->SetArrayField(TEXT("before"), Before);
+            MatchObj->SetArrayField(TEXT("after"), After);
+        }
+        MatchValues.Add(MakeShared<FJsonValueObject>(MatchObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetArrayField(TEXT("matches"), MatchValues);
+    ResultObj->SetNumberField(TEXT("match_count"), Result.Matches.Num());
+    ResultObj->SetNumberField(TEXT("files_searched"), Result.FilesSearched);
+    ResultObj->SetNumberField(TEXT("files_matched"), Result.FilesMatched);
+    ResultObj->SetBoolField(TEXT("truncated"), Result.bTruncated);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), ElapsedMs);
+    return ResultObj;
+}
+
+// modify_source_file
+// Params: path (string, required) and exactly one of:
+//           content (string) - the whole new file
+//           patch (string) - unified diff against the current file
+//           edits (array of {start_line, end_line, text}) - line ranges (1-based, inclusive)
+//             replaced by text, all numbered against the current file; end_line =
+//             start_line - 1 inserts before start_line, an empty text deletes
+//           restore_hash (string) - put back a version from the backup store
+//         base_hash (string, optional) - refuse unless the file still has this hash
+//           (as returned by get_source_file); recommended with patch / edits
+// Returns: path, hash, previous_hash, unchanged, bytes_written, backup_path,
+//          hunks_applied (patch) / edits_applied (edits)
+// The file is replaced atomically (temporary file + rename) and only when the
+// content changes. The previous version is kept in Saved/MCPSourceBackups/
+// under its hash, so a version is stored once however often it is restored.
+// Runs on the server thread; concurrent calls from other connections are
+// serialised, so base_hash holds up against them.
 TSharedPtr<FJsonObject> FUnrealMCPDiagnosticsCommands::HandleModifySourceFile(
     const TSharedPtr<FJsonObject>& Params)
 {
@@ -352,47 +617,177 @@ TSharedPtr<FJsonObject> FUnrealMCPDiagnosticsCommands::HandleModifySourceFile(
     }
 
     FString NewContent;
-    if (!Params->TryGetStringField(TEXT("content"), NewContent))
+    FString Patch;
+    FString RestoreHash;
+    const TArray<TSharedPtr<FJsonValue>>* EditValues = nullptr;
+    const bool bHasContent = Params->TryGetStringField(TEXT("content"), NewContent);
+    const bool bHasPatch = Params->TryGetStringField(TEXT("patch"), Patch);
+    const bool bHasEdits = Params->TryGetArrayField(TEXT("edits"), EditValues);
+    const bool bHasRestore = Params->TryGetStringField(TEXT("restore_hash"), RestoreHash);
+    if (bHasContent + bHasPatch + bHasEdits + bHasRestore != 1)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'content' parameter"));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            TEXT("Provide exactly one of 'content', 'patch', 'edits' or 'restore_hash'"));
+    }
+    // The hash becomes a file name in the backup store; anything else (e.g. "../") must not reach the path
+    if (bHasRestore && (RestoreHash.Len() != 40
+        || Algo::AnyOf(RestoreHash, [](TCHAR Char) { return !FChar::IsHexDigit(Char); })))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("'restore_hash' must be a 40-character hex SHA1, got '%s'"), *RestoreHash));
     }
 
-    // Resolve path
-    FString AbsolutePath = RelativePath;
-    if (FPaths::IsRelative(RelativePath))
+    const FString AbsolutePath = FMCPSourceFiles::ResolvePath(RelativePath);
+
+    // Read, hash check, backup and write form one step against other connections
+    FScopeLock WriteLock(&SourceWriteLock);
+
+    // Raw bytes, not FMCPFileView: the hash and the backup must describe the file
+    // as it is on disk, and nothing may stay mapped while it is replaced
+    const bool bExists = FPaths::FileExists(AbsolutePath);
+    TArray<uint8> OldBytes;
+    if (bExists)
     {
-        AbsolutePath = FPaths::ConvertRelativePathToFull(
-            FPaths::ProjectDir() / RelativePath);
+        if (!FFileHelper::LoadFileToArray(OldBytes, *AbsolutePath))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to read file: %s"), *AbsolutePath));
+        }
+        // Edits are applied to and written as UTF-8; re-encoding a UTF-16 file behind
+        // the caller's back would rewrite every byte of it
+        if (FMCPSourceFiles::IsUtf16(OldBytes.GetData(), OldBytes.Num()))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+                TEXT("%s is UTF-16 encoded; modify_source_file only edits UTF-8 files. Convert it to UTF-8 first"),
+                *AbsolutePath));
+        }
     }
+    const FString PreviousHash = bExists ? FMCPSourceFiles::HashBytes(OldBytes.GetData(), OldBytes.Num()) : FString();
 
-    // Create backup of existing file
-    FString BackupPath;
-    if (FPaths::FileExists(AbsolutePath))
+    FString BaseHash;
+    if (Params->TryGetStringField(TEXT("base_hash"), BaseHash) && !BaseHash.Equals(PreviousHash, ESearchCase::IgnoreCase))
     {
-        FDateTime Now = FDateTime::Now();
-        FString Timestamp = FString::Printf(TEXT("%04d%02d%02d_%02d%02d%02d"),
-            Now.GetYear(), Now.GetMonth(), Now.GetDay(),
-            Now.GetHour(), Now.GetMinute(), Now.GetSecond());
-        BackupPath = AbsolutePath + TEXT(".bak.") + Timestamp;
+        TSharedPtr<FJsonObject> ErrorObj = FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("%s has changed since it was read (hash %s, expected %s); read it again and rebuild the edit"),
+            *AbsolutePath, bExists ? *PreviousHash : TEXT("none, the file does not exist"), *BaseHash));
+        ErrorObj->SetStringField(TEXT("current_hash"), PreviousHash);
+        return ErrorObj;
+    }
 
-        FString ExistingContent;
-        if (FFileHelper::LoadFileToString(ExistingContent, *AbsolutePath))
+    TArray<uint8> NewBytes;
+    int32 HunksApplied = 0;
+    if (bHasContent)
+    {
+        // Keep the byte order mark if the file had one
+        if (FMCPTextLines::Parse(OldBytes.GetData(), OldBytes.Num()).bBom)
         {
-            FFileHelper::SaveStringToFile(ExistingContent, *BackupPath);
+            NewBytes.Append({ 0xEF, 0xBB, 0xBF });
         }
+        const FTCHARToUTF8 Utf8(*NewContent);
+        NewBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
     }
-
-    // Write new content
-    if (!FFileHelper::SaveStringToFile(NewContent, *AbsolutePath))
+    else if (bHasRestore)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to write file: %s"), *AbsolutePath));
+        const FString BackupPath = FMCPSourceFiles::GetBackupPath(RestoreHash.ToLower());
+        if (!FFileHelper::LoadFileToArray(NewBytes, *BackupPath))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("No backup with hash %s"), *RestoreHash));
+        }
+    }
+    else
+    {
+        if (!bExists)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+                TEXT("File not found: %s ('patch' and 'edits' need an existing file; use 'content' to create one)"),
+                *AbsolutePath));
+        }
+
+        FMCPTextLines Text = FMCPTextLines::Parse(OldBytes.GetData(), OldBytes.Num());
+        FString Error;
+        if (bHasPatch)
+        {
+            if (!FMCPSourceFiles::ApplyUnifiedDiff(Text, Patch, HunksApplied, Error))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+            }
+        }
+        else
+        {
+            TArray<FMCPLineEdit> Edits;
+            for (const TSharedPtr<FJsonValue>& Value : *EditValues)
+            {
+                const TSharedPtr<FJsonObject>* EditObj = nullptr;
+                double StartLine = 0.0;
+                if (!Value->TryGetObject(EditObj) || !(*EditObj)->TryGetNumberField(TEXT("start_line"), StartLine))
+                {
+                    return FUnrealMCPCommonUtils::CreateErrorResponse(
+                        TEXT("Each edit needs 'start_line' (and optionally 'end_line', 'text')"));
+                }
+                FMCPLineEdit& Edit = Edits.AddDefaulted_GetRef();
+                Edit.StartLine = static_cast<int32>(StartLine);
+                double EndLine = StartLine;
+                (*EditObj)->TryGetNumberField(TEXT("end_line"), EndLine);
+                Edit.EndLine = static_cast<int32>(EndLine);
+                FString EditText;
+                (*EditObj)->TryGetStringField(TEXT("text"), EditText);
+                Edit.NewLines = FMCPTextLines::SplitLines(EditText);
+            }
+            if (!FMCPSourceFiles::ApplyLineEdits(Text, MoveTemp(Edits), Error))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+            }
+        }
+        NewBytes = Text.ToBytes();
     }
 
+    const FString NewHash = FMCPSourceFiles::HashBytes(NewBytes.GetData(), NewBytes.Num());
+
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
     ResultObj->SetStringField(TEXT("path"), AbsolutePath);
-    ResultObj->SetNumberField(TEXT("bytes_written"), NewContent.Len());
+    ResultObj->SetStringField(TEXT("hash"), NewHash);
+    if (bExists)
+    {
+        ResultObj->SetStringField(TEXT("previous_hash"), PreviousHash);
+    }
+    if (bHasPatch)
+    {
+        ResultObj->SetNumberField(TEXT("hunks_applied"), HunksApplied);
+    }
+    else if (bHasEdits)
+    {
+        ResultObj->SetNumberField(TEXT("edits_applied"), EditValues->Num());
+    }
+
+    if (bExists && NewHash == PreviousHash)
+    {
+        // Identical content: no write, no backup, no LiveCoding / file watcher churn
+        ResultObj->SetBoolField(TEXT("unchanged"), true);
+        ResultObj->SetNumberField(TEXT("bytes_written"), 0);
+        return ResultObj;
+    }
+
+    FString BackupPath;
+    if (bExists)
+    {
+        BackupPath = FMCPSourceFiles::StoreBackup(OldBytes.GetData(), OldBytes.Num(), PreviousHash);
+        if (BackupPath.IsEmpty())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to back up %s; the file was not modified"), *AbsolutePath));
+        }
+    }
+
+    FString Error;
+    if (!FMCPSourceFiles::WriteFileAtomically(AbsolutePath, NewBytes, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    ResultObj->SetBoolField(TEXT("unchanged"), false);
+    ResultObj->SetNumberField(TEXT("bytes_written"), NewBytes.Num());
     if (!BackupPath.IsEmpty())
     {
         ResultObj->SetStringField(TEXT("backup_path"), BackupPath);
@@ -1,5 +1,8 @@
 #include "Commands/UnrealMCPEditorCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "MCPClassResolver.h"
+#include "MCPPropertyPath.h"
+#include "MCPImageEncoder.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
 #include "LevelEditorViewport.h"
@@ -7,6 +10,10 @@
 #include "HighResScreenshot.h"
 #include "Engine/GameViewportClient.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Base64.h"
+#include "Misc/Paths.h"
+#include "Async/Async.h"
+#include "Algo/AnyOf.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Selection.h"
 #include "Kismet/GameplayStatics.h"
@@ -30,6 +37,10 @@
 #include "GameFramework/WorldSettings.h"
 #include "GameFramework/GameModeBase.h"
 #include "ActorEditorUtils.h"
+#include "EngineUtils.h"
+#include "Misc/PackageName.h"
+#include "ScopedTransaction.h"
+#include "AI/NavigationSystemBase.h"
 
 FUnrealMCPEditorCommands::FUnrealMCPEditorCommands()
 {
@@ -55,6 +66,17 @@ void FUnrealMCPEditorCommands::RegisterCommands(FMCPCommandRegistry& Registry)
         [this](const TSharedPtr<FJsonObject>& P) { return HandleDeleteActor(P); });
     Registry.RegisterCommand(TEXT("set_actor_transform"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleSetActorTransform(P); });
+    // Bulk variants: packed inputs, one transaction per call
+    Registry.RegisterCommand(TEXT("spawn_actors"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleSpawnActors(P); });
+    Registry.RegisterCommand(TEXT("set_actor_transforms"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleSetActorTransforms(P); });
+    Registry.RegisterCommand(TEXT("delete_actors"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleDeleteActors(P); });
+    Registry.RegisterCommand(TEXT("set_actors_properties"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleSetActorsProperties(P); });
+    Registry.RegisterCommand(TEXT("get_actors_properties"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleGetActorsProperties(P); });
     Registry.RegisterCommand(TEXT("get_actor_properties"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleGetActorProperties(P); });
     Registry.RegisterCommand(TEXT("set_actor_property"),
@@ -65,8 +87,10 @@ void FUnrealMCPEditorCommands::RegisterCommands(FMCPCommandRegistry& Registry)
     // Editor viewport commands
     Registry.RegisterCommand(TEXT("focus_viewport"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleFocusViewport(P); });
+    // take_screenshot marshals only its pixel read-back to the game thread and encodes on the caller's thread
     Registry.RegisterCommand(TEXT("take_screenshot"),
-        [this](const TSharedPtr<FJsonObject>& P) { return HandleTakeScreenshot(P); });
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleTakeScreenshot(P); },
+        []() { return true; });
 
     // Actor selection
     Registry.RegisterCommand(TEXT("select_actor"),
@@ -105,23 +129,375 @@ void FUnrealMCPEditorCommands::RegisterCommands(FMCPCommandRegistry& Registry)
         [this](const TSharedPtr<FJsonObject>& P) { return HandleSetWorldSettings(P); });
 }
 
+// ---------------------------------------------------------------------------
+// get_actors_in_level helpers (filtering, projection, columnar output)
+// ---------------------------------------------------------------------------
+
+/** Fields that get_actors_in_level can project. Default matches ActorToJson. */
+enum class EMCPActorField : uint32
+{
+    None     = 0,
+    Name     = 1 << 0,
+    Label    = 1 << 1,
+    Class    = 1 << 2,
+    Location = 1 << 3,
+    Rotation = 1 << 4,
+    Scale    = 1 << 5,
+    Tags     = 1 << 6,
+    Folder   = 1 << 7,
+    Level    = 1 << 8,
+    Default  = Name | Class | Location | Rotation | Scale,
+};
+ENUM_CLASS_FLAGS(EMCPActorField);
+
+static EMCPActorField ParseActorFields(const TSharedPtr<FJsonObject>& Params, FString& OutError)
+{
+    const TArray<TSharedPtr<FJsonValue>>* FieldArray = nullptr;
+    if (!Params->TryGetArrayField(TEXT("fields"), FieldArray))
+    {
+        return EMCPActorField::Default;
+    }
+
+    static const TMap<FString, EMCPActorField> FieldNames = {
+        { TEXT("name"),     EMCPActorField::Name },
+        { TEXT("label"),    EMCPActorField::Label },
+        { TEXT("class"),    EMCPActorField::Class },
+        { TEXT("location"), EMCPActorField::Location },
+        { TEXT("rotation"), EMCPActorField::Rotation },
+        { TEXT("scale"),    EMCPActorField::Scale },
+        { TEXT("tags"),     EMCPActorField::Tags },
+        { TEXT("folder"),   EMCPActorField::Folder },
+        { TEXT("level"),    EMCPActorField::Level },
+    };
+
+    EMCPActorField Fields = EMCPActorField::None;
+    for (const TSharedPtr<FJsonValue>& Value : *FieldArray)
+    {
+        const FString FieldName = Value->AsString();
+        if (FieldName == TEXT("transform"))
+        {
+            Fields |= EMCPActorField::Location | EMCPActorField::Rotation | EMCPActorField::Scale;
+            continue;
+        }
+        const EMCPActorField* Found = FieldNames.Find(FieldName);
+        if (!Found)
+        {
+            OutError = FString::Printf(TEXT("Unknown field '%s'"), *FieldName);
+            return EMCPActorField::None;
+        }
+        Fields |= *Found;
+    }
+    return Fields == EMCPActorField::None ? EMCPActorField::Default : Fields;
+}
+
+/** Server-side actor filter. Empty members do not constrain the result. */
+struct FMCPActorFilter
+{
+    FName ClassName;    // matches the actor class or any of its parents
+    FName Tag;
+    FString Folder;     // outliner folder and its subfolders
+    FString Level;      // level package name, full ("/Game/Maps/Main") or short ("Main")
+    FString NameGlob;   // wildcard ('*', '?') against object name or label
+
+    void Parse(const TSharedPtr<FJsonObject>& Params)
+    {
+        FString Value;
+        if (Params->TryGetStringField(TEXT("class"), Value) && !Value.IsEmpty()) ClassName = FName(*Value);
+        if (Params->TryGetStringField(TEXT("tag"), Value) && !Value.IsEmpty()) Tag = FName(*Value);
+        Params->TryGetStringField(TEXT("folder"), Folder);
+        Folder.RemoveFromEnd(TEXT("/"));
+        Params->TryGetStringField(TEXT("level"), Level);
+        Params->TryGetStringField(TEXT("name"), NameGlob);
+    }
+
+    bool Matches(const AActor* Actor) const
+    {
+        if (!ClassName.IsNone())
+        {
+            bool bClassMatch = false;
+            for (const UClass* Class = Actor->GetClass(); Class; Class = Class->GetSuperClass())
+            {
+                if (Class->GetFName() == ClassName)
+                {
+                    bClassMatch = true;
+                    break;
+                }
+            }
+            if (!bClassMatch) return false;
+        }
+        if (!Tag.IsNone() && !Actor->Tags.Contains(Tag))
+        {
+            return false;
+        }
+        if (!Folder.IsEmpty())
+        {
+            // Whole path segments only: "Props" takes "Props" and "Props/Rocks", not "PropsOld"
+            const FString ActorFolder = Actor->GetFolderPath().ToString();
+            if (!ActorFolder.StartsWith(Folder)
+                || (ActorFolder.Len() > Folder.Len() && ActorFolder[Folder.Len()] != TEXT('/')))
+            {
+                return false;
+            }
+        }
+        if (!Level.IsEmpty())
+        {
+            const ULevel* ActorLevel = Actor->GetLevel();
+            const FString PackageName = ActorLevel ? ActorLevel->GetOutermost()->GetName() : FString();
+            if (PackageName != Level && FPackageName::GetShortName(PackageName) != Level)
+            {
+                return false;
+            }
+        }
+        if (!NameGlob.IsEmpty()
+            && !Actor->GetName().MatchesWildcard(NameGlob)
+            && !Actor->GetActorLabel().MatchesWildcard(NameGlob))
+        {
+            return false;
+        }
+        return true;
+    }
+};
+
+static void AppendVectorValues(TArray<TSharedPtr<FJsonValue>>& Out, double X, double Y, double Z)
+{
+    Out.Add(MakeShared<FJsonValueNumber>(X));
+    Out.Add(MakeShared<FJsonValueNumber>(Y));
+    Out.Add(MakeShared<FJsonValueNumber>(Z));
+}
+
+static TSharedPtr<FJsonValue> ActorToProjectedJson(const AActor* Actor, EMCPActorField Fields)
+{
+    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Name))
+    {
+        ActorObject->SetStringField(TEXT("name"), Actor->GetName());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Label))
+    {
+        ActorObject->SetStringField(TEXT("label"), Actor->GetActorLabel());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Class))
+    {
+        ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Location))
+    {
+        const FVector Location = Actor->GetActorLocation();
+        TArray<TSharedPtr<FJsonValue>> Values;
+        AppendVectorValues(Values, Location.X, Location.Y, Location.Z);
+        ActorObject->SetArrayField(TEXT("location"), Values);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Rotation))
+    {
+        const FRotator Rotation = Actor->GetActorRotation();
+        TArray<TSharedPtr<FJsonValue>> Values;
+        AppendVectorValues(Values, Rotation.Pitch, Rotation.Yaw, Rotation.Roll);
+        ActorObject->SetArrayField(TEXT("rotation"), Values);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Scale))
+    {
+        const FVector Scale = Actor->GetActorScale3D();
+        TArray<TSharedPtr<FJsonValue>> Values;
+        AppendVectorValues(Values, Scale.X, Scale.Y, Scale.Z);
+        ActorObject->SetArrayField(TEXT("scale"), Values);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Tags))
+    {
+        TArray<TSharedPtr<FJsonValue>> TagArray;
+        for (const FName& Tag : Actor->Tags)
+        {
+            TagArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+        }
+        ActorObject->SetArrayField(TEXT("tags"), TagArray);
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Folder))
+    {
+        ActorObject->SetStringField(TEXT("folder"), Actor->GetFolderPath().ToString());
+    }
+    if (EnumHasAnyFlags(Fields, EMCPActorField::Level))
+    {
+        const ULevel* ActorLevel = Actor->GetLevel();
+        ActorObject->SetStringField(TEXT("level"), ActorLevel ? ActorLevel->GetOutermost()->GetName() : FString());
+    }
+    return MakeShared<FJsonValueObject>(ActorObject);
+}
+
+/** One JSON array per projected field; vectors are packed flat (x0,y0,z0,x1,...). */
+struct FMCPActorColumns
+{
+    TArray<TSharedPtr<FJsonValue>> Names, Labels, Classes, Locations, Rotations, Scales, Tags, Folders, Levels;
+
+    void Append(const AActor* Actor, EMCPActorField Fields)
+    {
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Name))
+        {
+            Names.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+        }
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Label))
+        {
+            Labels.Add(MakeShared<FJsonValueString>(Actor->GetActorLabel()));
+        }
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Class))
+        {
+            Classes.Add(MakeShared<FJsonValueString>(Actor->GetClass()->GetName()));
+        }
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Location))
+        {
+            const FVector Location = Actor->GetActorLocation();
+            AppendVectorValues(Locations, Location.X, Location.Y, Location.Z);
+        }
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Rotation))
+        {
+            const FRotator Rotation = Actor->GetActorRotation();
+            AppendVectorValues(Rotations, Rotation.Pitch, Rotation.Yaw, Rotation.Roll);
+        }
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Scale))
+        {
+            const FVector Scale = Actor->GetActorScale3D();
+            AppendVectorValues(Scales, Scale.X, Scale.Y, Scale.Z);
+        }
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Tags))
+        {
+            TArray<TSharedPtr<FJsonValue>> TagArray;
+            for (const FName& Tag : Actor->Tags)
+            {
+                TagArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+            }
+            Tags.Add(MakeShared<FJsonValueArray>(TagArray));
+        }
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Folder))
+        {
+            Folders.Add(MakeShared<FJsonValueString>(Actor->GetFolderPath().ToString()));
+        }
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Level))
+        {
+            const ULevel* ActorLevel = Actor->GetLevel();
+            Levels.Add(MakeShared<FJsonValueString>(ActorLevel ? ActorLevel->GetOutermost()->GetName() : FString()));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ToJson(EMCPActorField Fields) const
+    {
+        TSharedPtr<FJsonObject> Columns = MakeShared<FJsonObject>();
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Name))     Columns->SetArrayField(TEXT("name"), Names);
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Label))    Columns->SetArrayField(TEXT("label"), Labels);
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Class))    Columns->SetArrayField(TEXT("class"), Classes);
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Location)) Columns->SetArrayField(TEXT("location"), Locations);
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Rotation)) Columns->SetArrayField(TEXT("rotation"), Rotations);
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Scale))    Columns->SetArrayField(TEXT("scale"), Scales);
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Tags))     Columns->SetArrayField(TEXT("tags"), Tags);
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Folder))   Columns->SetArrayField(TEXT("folder"), Folders);
+        if (EnumHasAnyFlags(Fields, EMCPActorField::Level))    Columns->SetArrayField(TEXT("level"), Levels);
+        return Columns;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// get_actors_in_level
+// Params (all optional):
+//   class, tag, folder, level, name (glob)  — server-side filters
+//   fields  : ["name","label","class","location","rotation","scale","transform","tags","folder","level"]
+//   layout  : "rows" (default, one object per actor) | "columns" (one array per field)
+//   limit   : page size (0 / absent = no paging)
+//   cursor  : opaque value returned as next_cursor by the previous page
+// Without any params the response is identical to the legacy full listing.
+// ---------------------------------------------------------------------------
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
 {
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    FString FieldError;
+    const EMCPActorField Fields = ParseActorFields(Params, FieldError);
+    if (!FieldError.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FieldError);
+    }
+
+    FMCPActorFilter Filter;
+    Filter.Parse(Params);
+
+    FString Layout = TEXT("rows");
+    Params->TryGetStringField(TEXT("layout"), Layout);
+    const bool bColumns = Layout == TEXT("columns");
+    if (!bColumns && Layout != TEXT("rows"))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown layout '%s' (expected 'rows' or 'columns')"), *Layout));
+    }
+
+    int32 Limit = 0;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    if (Limit < 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Invalid limit %d"), Limit));
+    }
+
+    // The cursor is the number of matching actors already returned. Actor iteration order
+    // is stable while the world is unchanged; edits between pages may shift entries.
+    int32 Offset = 0;
+    FString Cursor;
+    if (Params->TryGetStringField(TEXT("cursor"), Cursor) && !Cursor.IsEmpty())
+    {
+        // Only ever a count we handed out: plain digits, no sign or fraction
+        if (Algo::AnyOf(Cursor, [](TCHAR Char) { return !FChar::IsDigit(Char); }))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Invalid cursor '%s'"), *Cursor));
+        }
+        Offset = static_cast<int32>(FMath::Min<int64>(FCString::Atoi64(*Cursor), MAX_int32));
+    }
+
     TArray<TSharedPtr<FJsonValue>> ActorArray;
-    for (AActor* Actor : AllActors)
+    FMCPActorColumns Columns;
+    int32 MatchIndex = 0;
+    int32 Returned = 0;
+
+    for (TActorIterator<AActor> It(World); It; ++It)
     {
-        if (Actor)
+        AActor* Actor = *It;
+        if (!Actor || !Filter.Matches(Actor))
+        {
+            continue;
+        }
+
+        const int32 Index = MatchIndex++;
+        if (Index < Offset || (Limit > 0 && Returned >= Limit))
+        {
+            continue;
+        }
+
+        if (bColumns)
+        {
+            Columns.Append(Actor, Fields);
+        }
+        else
         {
-            ActorArray.Add(FUnrealMCPCommonUtils::ActorToJson(Actor));
+            ActorArray.Add(ActorToProjectedJson(Actor, Fields));
         }
+        ++Returned;
     }
-    
+
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
-    
+    if (bColumns)
+    {
+        ResultObj->SetObjectField(TEXT("columns"), Columns.ToJson(Fields));
+    }
+    else
+    {
+        ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    }
+    ResultObj->SetNumberField(TEXT("count"), Returned);
+    ResultObj->SetNumberField(TEXT("total_matched"), MatchIndex);
+
+    const int32 NextOffset = Offset + Returned;
+    if (Limit > 0 && NextOffset < MatchIndex)
+    {
+        ResultObj->SetStringField(TEXT("next_cursor"), FString::FromInt(NextOffset));
+    }
+
     return ResultObj;
 }
 
@@ -151,6 +527,50 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFindActorsByName(const T
     return ResultObj;
 }
 
+// ---------------------------------------------------------------------------
+// Spawn helpers (shared by spawn_actor and spawn_actors)
+// ---------------------------------------------------------------------------
+
+/** Map a spawn_actor 'type' string (case-insensitive) to the actor class to spawn. */
+static UClass* ResolveSpawnActorClass(const FString& ActorType, FString& OutError)
+{
+    if (ActorType == TEXT("StaticMeshActor"))       return AStaticMeshActor::StaticClass();
+    if (ActorType == TEXT("PointLight"))            return APointLight::StaticClass();
+    if (ActorType == TEXT("SpotLight"))             return ASpotLight::StaticClass();
+    if (ActorType == TEXT("DirectionalLight"))      return ADirectionalLight::StaticClass();
+    if (ActorType == TEXT("CameraActor"))           return ACameraActor::StaticClass();
+    if (ActorType == TEXT("SkyLight"))              return ASkyLight::StaticClass();
+    if (ActorType == TEXT("ExponentialHeightFog"))  return AExponentialHeightFog::StaticClass();
+    if (ActorType == TEXT("SkyAtmosphere"))
+    {
+#if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+        return ASkyAtmosphere::StaticClass();
+#else
+        OutError = TEXT("SkyAtmosphere requires UE 4.26+");
+        return nullptr;
+#endif
+    }
+
+    OutError = FString::Printf(TEXT("Unknown actor type: %s"), *ActorType);
+    return nullptr;
+}
+
+static void PrepareSpawnedStaticMeshActor(AStaticMeshActor* SMActor, UStaticMesh* Mesh)
+{
+    UStaticMeshComponent* SMComp = SMActor ? SMActor->GetStaticMeshComponent() : nullptr;
+    if (!SMComp)
+    {
+        return;
+    }
+
+    // Must be Movable to allow programmatic transform changes in editor
+    SMComp->SetMobility(EComponentMobility::Movable);
+    if (Mesh)
+    {
+        SMComp->SetStaticMesh(Mesh);
+    }
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActor(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -205,67 +625,24 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActor(const TShared
         }
     }
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Name = *ActorName;
-
-    if (ActorType == TEXT("StaticMeshActor"))
+    FString ClassError;
+    UClass* ActorClass = ResolveSpawnActorClass(ActorType, ClassError);
+    if (!ActorClass)
     {
-        AStaticMeshActor* SMActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Location, Rotation, SpawnParams);
-        if (SMActor && SMActor->GetStaticMeshComponent())
-        {
-            UStaticMeshComponent* SMComp = SMActor->GetStaticMeshComponent();
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
+    }
 
-            // Must be Movable to allow programmatic transform changes in editor
-            SMComp->SetMobility(EComponentMobility::Movable);
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = *ActorName;
 
-            // Assign static mesh if provided (e.g. "/Engine/BasicShapes/Sphere.Sphere")
-            FString StaticMeshPath;
-            if (Params->TryGetStringField(TEXT("static_mesh"), StaticMeshPath))
-            {
-                UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *StaticMeshPath);
-                if (Mesh)
-                {
-                    SMComp->SetStaticMesh(Mesh);
-                }
-            }
-        }
-        NewActor = SMActor;
-    }
-    else if (ActorType == TEXT("PointLight"))
-    {
-        NewActor = World->SpawnActor<APointLight>(APointLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("SpotLight"))
-    {
-        NewActor = World->SpawnActor<ASpotLight>(ASpotLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("DirectionalLight"))
-    {
-        NewActor = World->SpawnActor<ADirectionalLight>(ADirectionalLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("CameraActor"))
+    NewActor = World->SpawnActor<AActor>(ActorClass, Location, Rotation, SpawnParams);
+    if (AStaticMeshActor* SMActor = Cast<AStaticMeshActor>(NewActor))
     {
-        NewActor = World->SpawnActor<ACameraActor>(ACameraActor::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("SkyLight"))
-    {
-        NewActor = World->SpawnActor<ASkyLight>(ASkyLight::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else if (ActorType == TEXT("SkyAtmosphere"))
-    {
-#if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
-        NewActor = World->SpawnActor<ASkyAtmosphere>(ASkyAtmosphere::StaticClass(), Location, Rotation, SpawnParams);
-#else
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("SkyAtmosphere requires UE 4.26+"));
-#endif
-    }
-    else if (ActorType == TEXT("ExponentialHeightFog"))
-    {
-        NewActor = World->SpawnActor<AExponentialHeightFog>(AExponentialHeightFog::StaticClass(), Location, Rotation, SpawnParams);
-    }
-    else
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown actor type: %s"), *ActorType));
+        // Assign static mesh if provided (e.g. "/Engine/BasicShapes/Sphere.Sphere")
+        FString StaticMeshPath;
+        Params->TryGetStringField(TEXT("static_mesh"), StaticMeshPath);
+        PrepareSpawnedStaticMeshActor(SMActor,
+            StaticMeshPath.IsEmpty() ? nullptr : LoadObject<UStaticMesh>(nullptr, *StaticMeshPath));
     }
 
     if (NewActor)
@@ -357,6 +734,10 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorTransform(const
     // Set the new transform
     TargetActor->SetActorTransform(NewTransform);
 
+    // Programmatic moves do not notify the editor; broadcast like a viewport drag would
+    // so listeners (including the world change journal) see the change.
+    GEngine->BroadcastOnActorMoved(TargetActor);
+
     // Return updated actor info
     return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
 }
@@ -389,6 +770,38 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorProperties(const
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
     }
 
+    // Reflection read: 'properties' (array of paths) or all_editable; otherwise the fixed summary
+    const TArray<TSharedPtr<FJsonValue>>* PathValues = nullptr;
+    const bool bHasPaths = Params->TryGetArrayField(TEXT("properties"), PathValues);
+    bool bAllEditable = false;
+    Params->TryGetBoolField(TEXT("all_editable"), bAllEditable);
+    if (bHasPaths || bAllEditable)
+    {
+        TArray<FString> Paths;
+        if (bHasPaths)
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *PathValues)
+            {
+                Paths.Add(Value->AsString());
+            }
+        }
+
+        TArray<FString> Errors;
+        TSharedPtr<FJsonObject> Values = FMCPPropertyPath::Get().ReadProperties(TargetActor, Paths, Errors);
+
+        TArray<TSharedPtr<FJsonValue>> ErrorValues;
+        for (const FString& Error : Errors)
+        {
+            ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+        }
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), TargetActor->GetName());
+        ResultObj->SetStringField(TEXT("class"), TargetActor->GetClass()->GetName());
+        ResultObj->SetObjectField(TEXT("values"), Values);
+        ResultObj->SetArrayField(TEXT("errors"), ErrorValues);
+        return ResultObj;
+    }
+
     // Always return detailed properties for this command
     return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
 }
@@ -421,6 +834,28 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const T
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
     }
 
+    // Several properties at once: {"path": value}, one PreEditChange/PostEditChange per object.
+    // Component properties are addressed as "ComponentName.Property".
+    const TSharedPtr<FJsonObject>* Properties = nullptr;
+    if (Params->TryGetObjectField(TEXT("properties"), Properties))
+    {
+        TArray<FString> Errors;
+        const int32 NumSet = FMCPPropertyPath::Get().SetProperties(TargetActor, **Properties, Errors);
+
+        TArray<TSharedPtr<FJsonValue>> ErrorValues;
+        for (const FString& Error : Errors)
+        {
+            ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+        }
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("actor"), ActorName);
+        ResultObj->SetNumberField(TEXT("set"), NumSet);
+        ResultObj->SetArrayField(TEXT("errors"), ErrorValues);
+        ResultObj->SetBoolField(TEXT("success"), Errors.Num() == 0);
+        ResultObj->SetObjectField(TEXT("actor_details"), FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true));
+        return ResultObj;
+    }
+
     // Get property name
     FString PropertyName;
     if (!Params->TryGetStringField(TEXT("property_name"), PropertyName))
@@ -475,6 +910,458 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const T
     }
 }
 
+// ---------------------------------------------------------------------------
+// Bulk actor commands
+// One world scan, one FScopedTransaction and one navigation rebuild per call.
+// Transforms are packed flat with a stride of 3 (location), 6 (+rotation) or
+// 9 (+scale): [x, y, z, pitch, yaw, roll, sx, sy, sz, ...].
+// Responses carry compact per-item status: "failed" lists only the indices
+// that did not succeed.
+// ---------------------------------------------------------------------------
+
+static void ReadNameArray(const TSharedPtr<FJsonObject>& Params, TArray<FString>& OutNames)
+{
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (Params->TryGetArrayField(TEXT("names"), Values))
+    {
+        OutNames.Reset(Values->Num());
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            OutNames.Add(Value->AsString());
+        }
+    }
+}
+
+/** Name and label lookup for every actor in World, built with a single iteration. */
+static TMap<FString, AActor*> BuildActorNameMap(UWorld* World)
+{
+    TMap<FString, AActor*> Map;
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AActor* Actor = *It;
+        if (!Actor)
+        {
+            continue;
+        }
+        Map.Add(Actor->GetName(), Actor);
+        Map.FindOrAdd(Actor->GetActorLabel(), Actor);   // object names win over labels
+    }
+    return Map;
+}
+
+static void AddItemFailure(TArray<TSharedPtr<FJsonValue>>& Failed, int32 Index, const FString& Error)
+{
+    TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+    Entry->SetNumberField(TEXT("index"), Index);
+    Entry->SetStringField(TEXT("error"), Error);
+    Failed.Add(MakeShared<FJsonValueObject>(Entry));
+}
+
+static TSharedPtr<FJsonObject> MakeBulkResult(int32 Total, const TArray<TSharedPtr<FJsonValue>>& Failed)
+{
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetNumberField(TEXT("count"), Total);
+    Result->SetNumberField(TEXT("succeeded"), Total - Failed.Num());
+    Result->SetArrayField(TEXT("failed"), Failed);
+    return Result;
+}
+
+// spawn_actors
+// Params: type (string), transforms (packed), stride (optional, default 9),
+//         names (array, optional) or name_prefix (string, optional),
+//         static_mesh (string, optional, StaticMeshActor only)
+// Returns: count, succeeded, failed[], names[] ("" for failed items)
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnActors(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ActorType;
+    if (!Params->TryGetStringField(TEXT("type"), ActorType))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'type' parameter"));
+    }
+
+    FString Error;
+    UClass* ActorClass = ResolveSpawnActorClass(ActorType, Error);
+    if (!ActorClass)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    TArray<double> Packed;
+    int32 Stride = 9;
+    if (!FUnrealMCPCommonUtils::GetPackedTransformsFromJson(Params, TEXT("transforms"), Packed, Stride, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    const int32 Count = Packed.Num() / Stride;
+
+    TArray<FString> Names;
+    ReadNameArray(Params, Names);
+    if (Names.Num() > 0 && Names.Num() != Count)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("'names' has %d entries but 'transforms' describes %d actors"), Names.Num(), Count));
+    }
+
+    FString NamePrefix;
+    Params->TryGetStringField(TEXT("name_prefix"), NamePrefix);
+
+    UStaticMesh* Mesh = nullptr;
+    FString StaticMeshPath;
+    if (Params->TryGetStringField(TEXT("static_mesh"), StaticMeshPath) && !StaticMeshPath.IsEmpty())
+    {
+        Mesh = LoadObject<UStaticMesh>(nullptr, *StaticMeshPath);
+        if (!Mesh)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Static mesh not found: %s"), *StaticMeshPath));
+        }
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    // Only needed to reject duplicates when the caller chose explicit names.
+    TSet<FString> ExistingNames;
+    if (Names.Num() > 0)
+    {
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            if (*It)
+            {
+                ExistingNames.Add(It->GetName());
+            }
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Failed;
+    TArray<TSharedPtr<FJsonValue>> SpawnedNames;
+    SpawnedNames.Reserve(Count);
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "SpawnActors", "MCP Spawn Actors"));
+        FNavigationLockContext NavLock(World, ENavigationLockReason::Unknown);
+        World->PersistentLevel->Modify();
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            FActorSpawnParameters SpawnParams;
+            if (Names.Num() > 0)
+            {
+                bool bAlreadyInSet = false;
+                ExistingNames.Add(Names[Index], &bAlreadyInSet);
+                if (bAlreadyInSet)
+                {
+                    AddItemFailure(Failed, Index, FString::Printf(TEXT("Actor with name '%s' already exists"), *Names[Index]));
+                    SpawnedNames.Add(MakeShared<FJsonValueString>(FString()));
+                    continue;
+                }
+                SpawnParams.Name = FName(*Names[Index]);
+            }
+            else if (!NamePrefix.IsEmpty())
+            {
+                SpawnParams.Name = MakeUniqueObjectName(World->PersistentLevel, ActorClass, FName(*NamePrefix));
+            }
+
+            const FTransform SpawnTransform = FUnrealMCPCommonUtils::UnpackTransform(Packed, Stride, Index, FTransform::Identity);
+            AActor* NewActor = World->SpawnActor<AActor>(ActorClass, SpawnTransform, SpawnParams);
+            if (!NewActor)
+            {
+                AddItemFailure(Failed, Index, TEXT("Failed to spawn actor"));
+                SpawnedNames.Add(MakeShared<FJsonValueString>(FString()));
+                continue;
+            }
+
+            if (AStaticMeshActor* SMActor = Cast<AStaticMeshActor>(NewActor))
+            {
+                PrepareSpawnedStaticMeshActor(SMActor, Mesh);
+            }
+            SpawnedNames.Add(MakeShared<FJsonValueString>(NewActor->GetName()));
+        }
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeBulkResult(Count, Failed);
+    Result->SetArrayField(TEXT("names"), SpawnedNames);
+    return Result;
+}
+
+// set_actor_transforms
+// Params: names (array), transforms (packed, one entry per name), stride (optional, default 9)
+// With stride 3/6 the actors keep their current rotation/scale.
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorTransforms(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<FString> Names;
+    ReadNameArray(Params, Names);
+    if (Names.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'names' parameter"));
+    }
+
+    TArray<double> Packed;
+    int32 Stride = 9;
+    FString Error;
+    if (!FUnrealMCPCommonUtils::GetPackedTransformsFromJson(Params, TEXT("transforms"), Packed, Stride, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    if (Packed.Num() / Stride != Names.Num())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("'names' has %d entries but 'transforms' describes %d actors"), Names.Num(), Packed.Num() / Stride));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    const TMap<FString, AActor*> ActorsByName = BuildActorNameMap(World);
+
+    TArray<TSharedPtr<FJsonValue>> Failed;
+    TArray<AActor*> MovedActors;
+    MovedActors.Reserve(Names.Num());
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "SetActorTransforms", "MCP Set Actor Transforms"));
+        FNavigationLockContext NavLock(World, ENavigationLockReason::Unknown);
+
+        for (int32 Index = 0; Index < Names.Num(); ++Index)
+        {
+            AActor* const* Found = ActorsByName.Find(Names[Index]);
+            if (!Found)
+            {
+                AddItemFailure(Failed, Index, FString::Printf(TEXT("Actor not found: %s"), *Names[Index]));
+                continue;
+            }
+
+            AActor* Actor = *Found;
+            Actor->Modify();
+            Actor->SetActorTransform(FUnrealMCPCommonUtils::UnpackTransform(Packed, Stride, Index, Actor->GetActorTransform()),
+                                     false, nullptr, ETeleportType::TeleportPhysics);
+            MovedActors.Add(Actor);
+        }
+    }
+
+    // Notify once the whole batch is in place (journal, outliner, viewport).
+    for (AActor* Actor : MovedActors)
+    {
+        GEngine->BroadcastOnActorMoved(Actor);
+    }
+    GEditor->RedrawLevelEditingViewports();
+
+    return MakeBulkResult(Names.Num(), Failed);
+}
+
+// delete_actors
+// Params: names (array of actor names or labels)
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleDeleteActors(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<FString> Names;
+    ReadNameArray(Params, Names);
+    if (Names.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'names' parameter"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    TMap<FString, AActor*> ActorsByName = BuildActorNameMap(World);
+
+    TArray<TSharedPtr<FJsonValue>> Failed;
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "DeleteActors", "MCP Delete Actors"));
+        FNavigationLockContext NavLock(World, ENavigationLockReason::Unknown);
+
+        for (int32 Index = 0; Index < Names.Num(); ++Index)
+        {
+            AActor* Actor = nullptr;
+            ActorsByName.RemoveAndCopyValue(Names[Index], Actor);
+            if (!Actor || !IsValid(Actor))
+            {
+                AddItemFailure(Failed, Index, FString::Printf(TEXT("Actor not found: %s"), *Names[Index]));
+                continue;
+            }
+            if (!World->EditorDestroyActor(Actor, /*bShouldModifyLevel=*/true))
+            {
+                AddItemFailure(Failed, Index, FString::Printf(TEXT("Failed to delete actor: %s"), *Names[Index]));
+            }
+        }
+    }
+    GEditor->RedrawLevelEditingViewports();
+
+    return MakeBulkResult(Names.Num(), Failed);
+}
+
+// set_actors_properties
+// Params: names (array of actor names or labels),
+//         properties (object, property path -> value, applied to every actor)
+// Each failed actor lists the paths it rejected, joined with "; ".
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorsProperties(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<FString> Names;
+    ReadNameArray(Params, Names);
+    if (Names.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'names' parameter"));
+    }
+
+    const TSharedPtr<FJsonObject>* Properties = nullptr;
+    if (!Params->TryGetObjectField(TEXT("properties"), Properties) || (*Properties)->Values.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'properties' parameter"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    const TMap<FString, AActor*> ActorsByName = BuildActorNameMap(World);
+
+    // Paths are compiled once per actor class; the rest of the actors only walk them
+    TArray<TPair<FString, TSharedPtr<FJsonValue>>> Values;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+    {
+        Values.Emplace(Pair.Key, Pair.Value);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Failed;
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "SetActorsProperties", "MCP Set Actor Properties"));
+
+        for (int32 Index = 0; Index < Names.Num(); ++Index)
+        {
+            AActor* Actor = ActorsByName.FindRef(Names[Index]);
+            if (!Actor || !IsValid(Actor))
+            {
+                AddItemFailure(Failed, Index, FString::Printf(TEXT("Actor not found: %s"), *Names[Index]));
+                continue;
+            }
+
+            TArray<FString> Errors;
+            FMCPPropertyPath::Get().SetProperties(Actor, Values, Errors);
+            if (Errors.Num() > 0)
+            {
+                AddItemFailure(Failed, Index, FString::Join(Errors, TEXT("; ")));
+            }
+        }
+    }
+    GEditor->RedrawLevelEditingViewports();
+
+    return MakeBulkResult(Names.Num(), Failed);
+}
+
+// get_actors_properties
+// Params: names (array of actor names or labels) or class (string, every actor
+//         of that class and its subclasses), properties (array of paths; omit
+//         for every editable property), limit (number, default 1000)
+// Returns: count, truncated, actors[{name, class, values, errors?}]
+// Actors of one class share the compiled paths / editable-property list, so
+// only the requested values are read and serialized.
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorsProperties(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<FString> Names;
+    ReadNameArray(Params, Names);
+    FString ClassName;
+    Params->TryGetStringField(TEXT("class"), ClassName);
+    if (Names.Num() == 0 && ClassName.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'names' or 'class' parameter"));
+    }
+
+    TArray<FString> Paths;
+    const TArray<TSharedPtr<FJsonValue>>* PathValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("properties"), PathValues))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *PathValues)
+        {
+            Paths.Add(Value->AsString());
+        }
+    }
+
+    double Limit = 1000.0;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    const int32 MaxActors = FMath::Max(1, static_cast<int32>(Limit));
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    TArray<AActor*> Actors;
+    TArray<TSharedPtr<FJsonValue>> Missing;
+    if (Names.Num() > 0)
+    {
+        const TMap<FString, AActor*> ActorsByName = BuildActorNameMap(World);
+        for (const FString& Name : Names)
+        {
+            AActor* Actor = ActorsByName.FindRef(Name);
+            if (Actor)
+            {
+                Actors.Add(Actor);
+            }
+            else
+            {
+                Missing.Add(MakeShared<FJsonValueString>(Name));
+            }
+        }
+    }
+    else
+    {
+        UClass* ActorClass = FMCPClassResolver::Get().Resolve(ClassName, AActor::StaticClass());
+        if (!ActorClass)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FMCPClassResolver::Get().GetLastError());
+        }
+        for (TActorIterator<AActor> It(World, ActorClass); It; ++It)
+        {
+            Actors.Add(*It);
+        }
+    }
+
+    const bool bTruncated = Actors.Num() > MaxActors;
+    const int32 Count = FMath::Min(Actors.Num(), MaxActors);
+
+    TArray<TSharedPtr<FJsonValue>> Entries;
+    Entries.Reserve(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        AActor* Actor = Actors[Index];
+        TArray<FString> Errors;
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("name"), Actor->GetName());
+        Entry->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+        Entry->SetObjectField(TEXT("values"), FMCPPropertyPath::Get().ReadProperties(Actor, Paths, Errors));
+        if (Errors.Num() > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> ErrorValues;
+            for (const FString& Error : Errors)
+            {
+                ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+            }
+            Entry->SetArrayField(TEXT("errors"), ErrorValues);
+        }
+        Entries.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetNumberField(TEXT("count"), Count);
+    Result->SetBoolField(TEXT("truncated"), bTruncated);
+    Result->SetArrayField(TEXT("actors"), Entries);
+    if (Missing.Num() > 0)
+    {
+        Result->SetArrayField(TEXT("not_found"), Missing);
+    }
+    return Result;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -496,33 +1383,26 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(cons
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Blueprint name is empty"));
     }
 
-    // Resolve asset path: caller may supply "asset_path" (full path) or
-    // "path" (directory prefix); otherwise fall back to the default location.
+    // Resolve asset: caller may supply "asset_path" (full path) or "path"
+    // (directory prefix); otherwise the short name is resolved project-wide.
     FString AssetPath;
     if (!Params->TryGetStringField(TEXT("asset_path"), AssetPath) || AssetPath.IsEmpty())
     {
         FString PathPrefix;
-        if (!Params->TryGetStringField(TEXT("path"), PathPrefix) || PathPrefix.IsEmpty())
+        if (Params->TryGetStringField(TEXT("path"), PathPrefix) && !PathPrefix.IsEmpty())
         {
-            PathPrefix = TEXT("/Game/Blueprints/");
-        }
-        if (!PathPrefix.EndsWith(TEXT("/")))
-        {
-            PathPrefix += TEXT("/");
+            if (!PathPrefix.EndsWith(TEXT("/")))
+            {
+                PathPrefix += TEXT("/");
+            }
+            AssetPath = PathPrefix + BlueprintName;
         }
-        AssetPath = PathPrefix + BlueprintName;
-    }
-
-    if (!FPackageName::DoesPackageExist(AssetPath))
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint '%s' not found at path '%s'"), *BlueprintName, *AssetPath));
     }
 
-    UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *AssetPath);
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprintByName(BlueprintName, AssetPath);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
     }
 
     // Get transform parameters
@@ -666,43 +1546,143 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleFocusViewport(const TSha
     return ResultObj;
 }
 
+/** Read back the active editor viewport. Game thread only; everything after the read-back is thread-safe. */
+static bool CaptureActiveViewport(FMCPImage& OutImage)
+{
+    check(IsInGameThread());
+    FMCPImageEncoder::LoadModules();
+
+    FViewport* Viewport = GEditor ? GEditor->GetActiveViewport() : nullptr;
+    if (!Viewport)
+    {
+        return false;
+    }
+
+    const FIntPoint Size = Viewport->GetSizeXY();
+    if (Size.X <= 0 || Size.Y <= 0)
+    {
+        return false;
+    }
+    OutImage.Width = Size.X;
+    OutImage.Height = Size.Y;
+    return Viewport->ReadPixels(OutImage.Pixels, FReadSurfaceDataFlags(), FIntRect(0, 0, Size.X, Size.Y));
+}
+
+// ---------------------------------------------------------------------------
+// take_screenshot
+// Params: filepath (string, optional), format ("png" | "jpeg", default: from
+//         the filepath extension, else png), quality (1-100, JPEG only,
+//         default 85), max_width / max_height (downscale bound, optional),
+//         inline (bool, default: true when no filepath is given)
+// Returns: width, height, format, mime_type, bytes, capture_ms, encode_ms,
+//          filepath (when written), data (base64, when inline)
+// Registered to run on the server thread: only the pixel read-back is
+// marshalled to the game thread; resize, compression, base64 and the file
+// write happen here, so frequent screenshots do not stall the editor.
+// ---------------------------------------------------------------------------
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleTakeScreenshot(const TSharedPtr<FJsonObject>& Params)
 {
-    // Get file path parameter
     FString FilePath;
-    if (!Params->TryGetStringField(TEXT("filepath"), FilePath))
+    Params->TryGetStringField(TEXT("filepath"), FilePath);
+
+    FMCPImageEncodeOptions Options;
+    FString FormatName;
+    if (Params->TryGetStringField(TEXT("format"), FormatName))
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'filepath' parameter"));
+        if (!FMCPImageEncoder::ParseFormat(FormatName, Options.Format))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Unknown image format '%s' (expected png or jpeg)"), *FormatName));
+        }
     }
-    
-    // Ensure the file path has a proper extension
-    if (!FilePath.EndsWith(TEXT(".png")))
+    else if (!FilePath.IsEmpty())
     {
-        FilePath += TEXT(".png");
+        FMCPImageEncoder::ParseFormat(FPaths::GetExtension(FilePath), Options.Format);
     }
 
-    // Get the active viewport
-    if (GEditor && GEditor->GetActiveViewport())
+    double Number = 0.0;
+    if (Params->TryGetNumberField(TEXT("quality"), Number))
     {
-        FViewport* Viewport = GEditor->GetActiveViewport();
-        TArray<FColor> Bitmap;
-        FIntRect ViewportRect(0, 0, Viewport->GetSizeXY().X, Viewport->GetSizeXY().Y);
-        
-        if (Viewport->ReadPixels(Bitmap, FReadSurfaceDataFlags(), ViewportRect))
+        Options.Quality = FMath::Clamp(static_cast<int32>(Number), 1, 100);
+    }
+    if (Params->TryGetNumberField(TEXT("max_width"), Number))
+    {
+        Options.MaxWidth = FMath::Max(0, static_cast<int32>(Number));
+    }
+    if (Params->TryGetNumberField(TEXT("max_height"), Number))
+    {
+        Options.MaxHeight = FMath::Max(0, static_cast<int32>(Number));
+    }
+
+    bool bInline = FilePath.IsEmpty();
+    Params->TryGetBoolField(TEXT("inline"), bInline);
+    if (FilePath.IsEmpty() && !bInline)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'filepath' parameter (or set 'inline')"));
+    }
+
+    // Ensure the file path has the extension of the chosen format
+    const TCHAR* Extension = FMCPImageEncoder::GetExtension(Options.Format);
+    if (!FilePath.IsEmpty() && !FilePath.EndsWith(Extension, ESearchCase::IgnoreCase)
+        && !(Options.Format == EMCPImageFormat::Jpeg && FilePath.EndsWith(TEXT(".jpeg"), ESearchCase::IgnoreCase)))
+    {
+        FilePath += Extension;
+    }
+
+    const double CaptureStart = FPlatformTime::Seconds();
+    TSharedRef<FMCPImage, ESPMode::ThreadSafe> Image = MakeShared<FMCPImage, ESPMode::ThreadSafe>();
+    bool bCaptured = false;
+    if (IsInGameThread())
+    {
+        // batch / commandlet callers already run on the game thread
+        bCaptured = CaptureActiveViewport(*Image);
+    }
+    else
+    {
+        TPromise<bool> Promise;
+        TFuture<bool> Future = Promise.GetFuture();
+        AsyncTask(ENamedThreads::GameThread, [Image, Promise = MoveTemp(Promise)]() mutable
         {
-            TArray<uint8> CompressedBitmap;
-            FImageUtils::CompressImageArray(Viewport->GetSizeXY().X, Viewport->GetSizeXY().Y, Bitmap, CompressedBitmap);
-            
-            if (FFileHelper::SaveArrayToFile(CompressedBitmap, *FilePath))
-            {
-                TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-                ResultObj->SetStringField(TEXT("filepath"), FilePath);
-                return ResultObj;
-            }
+            Promise.SetValue(CaptureActiveViewport(*Image));
+        });
+        bCaptured = Future.Get();
+    }
+    if (!bCaptured)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to take screenshot"));
+    }
+
+    const double EncodeStart = FPlatformTime::Seconds();
+    TArray<uint8> Encoded;
+    FString Error;
+    if (!FMCPImageEncoder::Encode(*Image, Options, Encoded, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    if (!FilePath.IsEmpty())
+    {
+        if (!FFileHelper::SaveArrayToFile(Encoded, *FilePath))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to write %s"), *FilePath));
         }
+        ResultObj->SetStringField(TEXT("filepath"), FilePath);
     }
-    
-    return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to take screenshot"));
+    if (bInline)
+    {
+        ResultObj->SetStringField(TEXT("data"), FBase64::Encode(Encoded));
+    }
+    const double End = FPlatformTime::Seconds();
+
+    ResultObj->SetNumberField(TEXT("width"), Image->Width);
+    ResultObj->SetNumberField(TEXT("height"), Image->Height);
+    ResultObj->SetStringField(TEXT("format"), Options.Format == EMCPImageFormat::Jpeg ? TEXT("jpeg") : TEXT("png"));
+    ResultObj->SetStringField(TEXT("mime_type"), FMCPImageEncoder::GetMimeType(Options.Format));
+    ResultObj->SetNumberField(TEXT("bytes"), Encoded.Num());
+    ResultObj->SetNumberField(TEXT("capture_ms"), FMath::RoundToInt((EncodeStart - CaptureStart) * 1000.0));
+    ResultObj->SetNumberField(TEXT("encode_ms"), FMath::RoundToInt((End - EncodeStart) * 1000.0));
+    return ResultObj;
 }
 
 // ---------------------------------------------------------------------------
@@ -1201,12 +2181,8 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetWorldSettings(const T
     {
         FString GameModeClass;
         Params->TryGetStringField(TEXT("game_mode"), GameModeClass);
-        UClass* GMClass = FindObject<UClass>(ANY_PACKAGE, *GameModeClass);
-        if (!GMClass)
-        {
-            GMClass = LoadObject<UClass>(nullptr, *GameModeClass);
-        }
-        if (GMClass && GMClass->IsChildOf(AGameModeBase::StaticClass()))
+        UClass* GMClass = FMCPClassResolver::Get().Resolve(GameModeClass, AGameModeBase::StaticClass());
+        if (GMClass)
         {
             WS->DefaultGameMode = GMClass;
             bModified = true;
@@ -1214,7 +2190,8 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetWorldSettings(const T
         else
         {
             return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("GameMode class '%s' not found or not a GameModeBase subclass"), *GameModeClass));
+                FString::Printf(TEXT("GameMode class '%s' not found or not a GameModeBase subclass (%s)"),
+                    *GameModeClass, *FMCPClassResolver::Get().GetLastError()));
         }
     }
 
@@ -0,0 +1,693 @@
+#include "Commands/UnrealMCPInstancingCommands.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+#include "AI/NavigationSystemBase.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/SplineComponent.h"
+#include "ScopedTransaction.h"
+#include "Math/RandomStream.h"
+#include "Algo/Unique.h"
+
+// Upper bound on instances generated by a single call, to catch runaway grid sizes.
+static constexpr int32 MaxInstancesPerCall = 1000000;
+
+// ---------------------------------------------------------------------------
+// Constructor & registration
+// ---------------------------------------------------------------------------
+
+FUnrealMCPInstancingCommands::FUnrealMCPInstancingCommands()
+{
+}
+
+void FUnrealMCPInstancingCommands::RegisterCommands(FMCPCommandRegistry& Registry)
+{
+    Registry.RegisterCommand(TEXT("scatter_instances"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleScatterInstances(P); });
+    Registry.RegisterCommand(TEXT("remove_instances"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleRemoveInstances(P); });
+    Registry.RegisterCommand(TEXT("consolidate_to_instances"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleConsolidateToInstances(P); });
+}
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+static AActor* FindActorByNameOrLabel(UWorld* World, const FString& Name)
+{
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AActor* Actor = *It;
+        if (Actor && (Actor->GetName() == Name || Actor->GetActorLabel() == Name))
+        {
+            return Actor;
+        }
+    }
+    return nullptr;
+}
+
+UHierarchicalInstancedStaticMeshComponent* FUnrealMCPInstancingCommands::FindInstanceComponent(
+    AActor* Actor, const UStaticMesh* Mesh) const
+{
+    TArray<UHierarchicalInstancedStaticMeshComponent*> Components;
+    Actor->GetComponents<UHierarchicalInstancedStaticMeshComponent>(Components);
+    for (UHierarchicalInstancedStaticMeshComponent* Component : Components)
+    {
+        if (!Mesh || Component->GetStaticMesh() == Mesh)
+        {
+            return Component;
+        }
+    }
+    return nullptr;
+}
+
+UHierarchicalInstancedStaticMeshComponent* FUnrealMCPInstancingCommands::AddInstanceComponent(
+    AActor* Actor, UStaticMesh* Mesh) const
+{
+    Actor->Modify();
+    const FName ComponentName = MakeUniqueObjectName(Actor, UHierarchicalInstancedStaticMeshComponent::StaticClass(),
+        TEXT("InstancedMesh"));
+    UHierarchicalInstancedStaticMeshComponent* Component =
+        NewObject<UHierarchicalInstancedStaticMeshComponent>(Actor, ComponentName, RF_Transactional);
+    Component->SetMobility(EComponentMobility::Static);
+    Component->SetStaticMesh(Mesh);
+    if (USceneComponent* Root = Actor->GetRootComponent())
+    {
+        Component->SetupAttachment(Root);
+    }
+    else
+    {
+        Actor->SetRootComponent(Component);
+    }
+    Actor->AddInstanceComponent(Component);
+    Component->RegisterComponent();
+    // Lets FMCPWorldChangeJournal (and with it the validation cache) see the new component.
+    Actor->PostEditChange();
+    return Component;
+}
+
+UHierarchicalInstancedStaticMeshComponent* FUnrealMCPInstancingCommands::CreateInstanceActor(
+    UWorld* World, const FString& ActorName, UStaticMesh* Mesh, ULevel* Level) const
+{
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = FName(*ActorName);
+    SpawnParams.OverrideLevel = Level;
+    AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    Actor->SetActorLabel(ActorName);
+    return AddInstanceComponent(Actor, Mesh);
+}
+
+bool FUnrealMCPInstancingCommands::GeneratePatternTransforms(UWorld* World, const TSharedPtr<FJsonObject>& Pattern,
+                                                             TArray<FTransform>& OutTransforms, FString& OutError) const
+{
+    FString Type;
+    if (!Pattern->TryGetStringField(TEXT("type"), Type))
+    {
+        OutError = TEXT("Pattern is missing 'type' (grid | random | spline)");
+        return false;
+    }
+
+    if (Type == TEXT("grid"))
+    {
+        // origin [x,y,z], count [nx,ny,nz], spacing [sx,sy,sz]
+        const FVector Origin = FUnrealMCPCommonUtils::GetVectorFromJson(Pattern, TEXT("origin"));
+        const FVector Spacing = FUnrealMCPCommonUtils::GetVectorFromJson(Pattern, TEXT("spacing"));
+        TArray<int32> Counts;
+        FUnrealMCPCommonUtils::GetIntArrayFromJson(Pattern, TEXT("count"), Counts);
+        while (Counts.Num() < 3)
+        {
+            Counts.Add(1);
+        }
+        const int64 Total = static_cast<int64>(FMath::Max(Counts[0], 0)) * FMath::Max(Counts[1], 0) * FMath::Max(Counts[2], 0);
+        if (Total <= 0 || Total > MaxInstancesPerCall)
+        {
+            OutError = FString::Printf(TEXT("Grid produces %lld instances (allowed 1..%d)"), Total, MaxInstancesPerCall);
+            return false;
+        }
+
+        OutTransforms.Reserve(OutTransforms.Num() + Total);
+        for (int32 Z = 0; Z < Counts[2]; ++Z)
+        {
+            for (int32 Y = 0; Y < Counts[1]; ++Y)
+            {
+                for (int32 X = 0; X < Counts[0]; ++X)
+                {
+                    OutTransforms.Add(FTransform(Origin + FVector(X, Y, Z) * Spacing));
+                }
+            }
+        }
+        return true;
+    }
+
+    if (Type == TEXT("random"))
+    {
+        // center [x,y,z], extent [x,y,z] (half size), count, seed, random_yaw, scale_range [min,max]
+        const FVector Center = FUnrealMCPCommonUtils::GetVectorFromJson(Pattern, TEXT("center"));
+        const FVector Extent = FUnrealMCPCommonUtils::GetVectorFromJson(Pattern, TEXT("extent"));
+        int32 Count = 0;
+        int32 Seed = 0;
+        bool bRandomYaw = true;
+        Pattern->TryGetNumberField(TEXT("count"), Count);
+        Pattern->TryGetNumberField(TEXT("seed"), Seed);
+        Pattern->TryGetBoolField(TEXT("random_yaw"), bRandomYaw);
+        TArray<float> ScaleRange;
+        FUnrealMCPCommonUtils::GetFloatArrayFromJson(Pattern, TEXT("scale_range"), ScaleRange);
+        const float MinScale = ScaleRange.Num() >= 1 ? ScaleRange[0] : 1.0f;
+        const float MaxScale = ScaleRange.Num() >= 2 ? ScaleRange[1] : MinScale;
+
+        if (Count <= 0 || Count > MaxInstancesPerCall)
+        {
+            OutError = FString::Printf(TEXT("Random pattern 'count' must be 1..%d"), MaxInstancesPerCall);
+            return false;
+        }
+
+        FRandomStream Stream(Seed);
+        OutTransforms.Reserve(OutTransforms.Num() + Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const FVector Location = Center + FVector(
+                Stream.FRandRange(-Extent.X, Extent.X),
+                Stream.FRandRange(-Extent.Y, Extent.Y),
+                Stream.FRandRange(-Extent.Z, Extent.Z));
+            const FRotator Rotation(0.0f, bRandomYaw ? Stream.FRandRange(0.0f, 360.0f) : 0.0f, 0.0f);
+            const float Scale = Stream.FRandRange(MinScale, MaxScale);
+            OutTransforms.Add(FTransform(Rotation, Location, FVector(Scale)));
+        }
+        return true;
+    }
+
+    if (Type == TEXT("spline"))
+    {
+        // spline_actor (name), count or spacing, align (default true)
+        FString SplineActorName;
+        if (!Pattern->TryGetStringField(TEXT("spline_actor"), SplineActorName))
+        {
+            OutError = TEXT("Spline pattern is missing 'spline_actor'");
+            return false;
+        }
+        AActor* SplineActor = FindActorByNameOrLabel(World, SplineActorName);
+        USplineComponent* Spline = SplineActor ? SplineActor->FindComponentByClass<USplineComponent>() : nullptr;
+        if (!Spline)
+        {
+            OutError = FString::Printf(TEXT("No SplineComponent found on actor '%s'"), *SplineActorName);
+            return false;
+        }
+
+        const float Length = Spline->GetSplineLength();
+        int32 Count = 0;
+        double Spacing = 0.0;
+        bool bAlign = true;
+        Pattern->TryGetNumberField(TEXT("count"), Count);
+        Pattern->TryGetNumberField(TEXT("spacing"), Spacing);
+        Pattern->TryGetBoolField(TEXT("align"), bAlign);
+        if (Count <= 0 && Spacing > 0.0)
+        {
+            Count = FMath::FloorToInt(Length / Spacing) + 1;
+        }
+        if (Count <= 0 || Count > MaxInstancesPerCall)
+        {
+            OutError = FString::Printf(TEXT("Spline pattern needs 'count' or 'spacing' giving 1..%d instances"), MaxInstancesPerCall);
+            return false;
+        }
+
+        OutTransforms.Reserve(OutTransforms.Num() + Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const float Distance = Count > 1 ? Length * Index / (Count - 1) : 0.0f;
+            const FVector Location = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+            const FRotator Rotation = bAlign
+                ? Spline->GetRotationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World)
+                : FRotator::ZeroRotator;
+            OutTransforms.Add(FTransform(Rotation, Location));
+        }
+        return true;
+    }
+
+    OutError = FString::Printf(TEXT("Unknown pattern type '%s' (expected grid | random | spline)"), *Type);
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// scatter_instances
+// ---------------------------------------------------------------------------
+
+TSharedPtr<FJsonObject> FUnrealMCPInstancingCommands::HandleScatterInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ActorName;
+    if (!Params->TryGetStringField(TEXT("actor_name"), ActorName) || ActorName.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    UStaticMesh* Mesh = nullptr;
+    FString StaticMeshPath;
+    if (Params->TryGetStringField(TEXT("static_mesh"), StaticMeshPath) && !StaticMeshPath.IsEmpty())
+    {
+        Mesh = LoadObject<UStaticMesh>(nullptr, *StaticMeshPath);
+        if (!Mesh)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Static mesh not found: %s"), *StaticMeshPath));
+        }
+    }
+
+    // Gather instance transforms (world space) before touching the level.
+    TArray<FTransform> Transforms;
+    FString Error;
+    const TSharedPtr<FJsonObject>* Pattern = nullptr;
+    if (Params->TryGetObjectField(TEXT("pattern"), Pattern))
+    {
+        if (!GeneratePatternTransforms(World, *Pattern, Transforms, Error))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+        }
+    }
+    else if (Params->HasField(TEXT("transforms")))
+    {
+        TArray<double> Packed;
+        int32 Stride = 9;
+        if (!FUnrealMCPCommonUtils::GetPackedTransformsFromJson(Params, TEXT("transforms"), Packed, Stride, Error))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+        }
+        const int32 Count = Packed.Num() / Stride;
+        if (Count > MaxInstancesPerCall)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Too many instances in one call (%d > %d)"), Count, MaxInstancesPerCall));
+        }
+        Transforms.Reserve(Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Transforms.Add(FUnrealMCPCommonUtils::UnpackTransform(Packed, Stride, Index, FTransform::Identity));
+        }
+    }
+    else
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide either 'transforms' or 'pattern'"));
+    }
+
+    bool bReplace = false;
+    Params->TryGetBoolField(TEXT("replace"), bReplace);
+
+    const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "ScatterInstances", "MCP Scatter Instances"));
+
+    bool bCreated = false;
+    bool bCreatedComponent = false;
+    UHierarchicalInstancedStaticMeshComponent* Component = nullptr;
+    if (AActor* Existing = FindActorByNameOrLabel(World, ActorName))
+    {
+        Component = FindInstanceComponent(Existing, Mesh);
+        if (!Component && !Mesh)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Actor '%s' has no HierarchicalInstancedStaticMeshComponent"), *ActorName));
+        }
+        if (!Component)
+        {
+            // A new mesh on an existing holder gets its own component; existing instances keep their mesh.
+            Component = AddInstanceComponent(Existing, Mesh);
+            bCreatedComponent = true;
+        }
+        Component->Modify();
+    }
+    else
+    {
+        if (!Mesh)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                TEXT("'static_mesh' is required when creating a new instance actor"));
+        }
+        World->PersistentLevel->Modify();
+        Component = CreateInstanceActor(World, ActorName, Mesh);
+        if (!Component)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to create instance actor '%s'"), *ActorName));
+        }
+        bCreated = true;
+    }
+
+    if (bReplace)
+    {
+        Component->ClearInstances();
+    }
+
+    // Add everything in one call and rebuild the cluster tree once at the end.
+    const int32 FirstIndex = Component->GetInstanceCount();
+    const bool bPrevAutoRebuild = Component->bAutoRebuildTreeOnInstanceChanges;
+    Component->bAutoRebuildTreeOnInstanceChanges = false;
+    Component->AddInstances(Transforms, /*bShouldReturnIndices=*/false, /*bWorldSpace=*/true);
+    Component->bAutoRebuildTreeOnInstanceChanges = bPrevAutoRebuild;
+    Component->BuildTreeIfOutdated(/*Async=*/true, /*ForceUpdate=*/true);
+    Component->PostEditChange();
+    Component->MarkPackageDirty();
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("actor_name"), Component->GetOwner()->GetName());
+    Result->SetStringField(TEXT("component_name"), Component->GetName());
+    Result->SetBoolField(TEXT("created"), bCreated);
+    Result->SetBoolField(TEXT("created_component"), bCreatedComponent);
+    Result->SetNumberField(TEXT("added"), Transforms.Num());
+    Result->SetNumberField(TEXT("first_index"), FirstIndex);
+    Result->SetNumberField(TEXT("instance_count"), Component->GetInstanceCount());
+    return Result;
+}
+
+// ---------------------------------------------------------------------------
+// remove_instances
+// ---------------------------------------------------------------------------
+
+TSharedPtr<FJsonObject> FUnrealMCPInstancingCommands::HandleRemoveInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ActorName;
+    if (!Params->TryGetStringField(TEXT("actor_name"), ActorName) || ActorName.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    AActor* Actor = FindActorByNameOrLabel(World, ActorName);
+    UHierarchicalInstancedStaticMeshComponent* Component = Actor ? FindInstanceComponent(Actor, nullptr) : nullptr;
+    if (!Component)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("No instance actor named '%s'"), *ActorName));
+    }
+
+    TArray<int32> Indices;
+    if (Params->HasField(TEXT("indices")))
+    {
+        FUnrealMCPCommonUtils::GetIntArrayFromJson(Params, TEXT("indices"), Indices);
+    }
+    else if (Params->HasField(TEXT("box_min")) && Params->HasField(TEXT("box_max")))
+    {
+        const FBox Box(FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("box_min")),
+                       FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("box_max")));
+        Indices = Component->GetInstancesOverlappingBox(Box, /*bBoxInWorldSpace=*/true);
+    }
+    else
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide either 'indices' or 'box_min' + 'box_max'"));
+    }
+
+    const int32 InstanceCount = Component->GetInstanceCount();
+    Indices.RemoveAll([InstanceCount](int32 Index) { return Index < 0 || Index >= InstanceCount; });
+    // A repeated index would remove whichever instance moved into that slot.
+    Indices.Sort();
+    Indices.SetNum(Algo::Unique(Indices));
+
+    if (Indices.Num() > 0)
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "RemoveInstances", "MCP Remove Instances"));
+        Component->Modify();
+        Component->RemoveInstances(Indices);
+        Component->PostEditChange();
+        Component->MarkPackageDirty();
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("actor_name"), Actor->GetName());
+    Result->SetNumberField(TEXT("removed"), Indices.Num());
+    Result->SetNumberField(TEXT("instance_count"), Component->GetInstanceCount());
+    return Result;
+}
+
+// ---------------------------------------------------------------------------
+// consolidate_to_instances
+// ---------------------------------------------------------------------------
+
+namespace
+{
+    /** Everything that must match for two StaticMeshActors to share one HISM. */
+    struct FConsolidationKey
+    {
+        /** Level owning the actors; the holder is spawned there. */
+        ULevel* Level = nullptr;
+        UStaticMesh* Mesh = nullptr;
+        TArray<UMaterialInterface*> Materials;
+        EComponentMobility::Type Mobility = EComponentMobility::Static;
+        FName CollisionProfile;
+        /** Sorted, deduplicated actor / component tags; instances cannot carry their own. */
+        TArray<FName> ActorTags;
+        TArray<FName> ComponentTags;
+
+        bool operator==(const FConsolidationKey& Other) const
+        {
+            return Level == Other.Level && Mesh == Other.Mesh && Materials == Other.Materials
+                && Mobility == Other.Mobility && CollisionProfile == Other.CollisionProfile
+                && ActorTags == Other.ActorTags && ComponentTags == Other.ComponentTags;
+        }
+
+        friend uint32 GetTypeHash(const FConsolidationKey& Key)
+        {
+            uint32 Hash = HashCombine(GetTypeHash(Key.Mesh), GetTypeHash(Key.CollisionProfile));
+            Hash = HashCombine(Hash, GetTypeHash(Key.Level));
+            Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Key.Mobility)));
+            for (const UMaterialInterface* Material : Key.Materials)
+            {
+                Hash = HashCombine(Hash, GetTypeHash(Material));
+            }
+            for (const FName& Tag : Key.ActorTags)
+            {
+                Hash = HashCombine(Hash, GetTypeHash(Tag));
+            }
+            for (const FName& Tag : Key.ComponentTags)
+            {
+                Hash = HashCombine(Hash, GetTypeHash(Tag));
+            }
+            return Hash;
+        }
+    };
+
+    TArray<FName> SortedTags(const TArray<FName>& Tags)
+    {
+        TArray<FName> Result = Tags;
+        Result.Sort(FNameLexicalLess());
+        Result.SetNum(Algo::Unique(Result));
+        return Result;
+    }
+
+    /**
+     * Build the grouping key for a plain StaticMeshActor. Returns false for actors that
+     * cannot be folded into instances without losing behaviour (subclasses, attachments,
+     * extra components, no mesh).
+     */
+    bool MakeConsolidationKey(AStaticMeshActor* Actor, FConsolidationKey& OutKey)
+    {
+        if (Actor->GetClass() != AStaticMeshActor::StaticClass())
+        {
+            return false;
+        }
+        UStaticMeshComponent* Component = Actor->GetStaticMeshComponent();
+        if (!Component || !Component->GetStaticMesh() || Actor->GetInstanceComponents().Num() > 0)
+        {
+            return false;
+        }
+        TArray<AActor*> Attached;
+        Actor->GetAttachedActors(Attached);
+        if (Attached.Num() > 0 || Actor->GetAttachParentActor())
+        {
+            return false;
+        }
+
+        OutKey.Level = Actor->GetLevel();
+        OutKey.Mesh = Component->GetStaticMesh();
+        OutKey.Materials = Component->OverrideMaterials;
+        // Trailing null overrides are equivalent to no override.
+        while (OutKey.Materials.Num() > 0 && OutKey.Materials.Last() == nullptr)
+        {
+            OutKey.Materials.Pop();
+        }
+        OutKey.Mobility = Component->Mobility;
+        OutKey.CollisionProfile = Component->GetCollisionProfileName();
+        OutKey.ActorTags = SortedTags(Actor->Tags);
+        OutKey.ComponentTags = SortedTags(Component->ComponentTags);
+        return true;
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPInstancingCommands::HandleConsolidateToInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    int32 MinGroupSize = 2;
+    bool bDryRun = false;
+    Params->TryGetNumberField(TEXT("min_group_size"), MinGroupSize);
+    Params->TryGetBoolField(TEXT("dry_run"), bDryRun);
+    MinGroupSize = FMath::Max(MinGroupSize, 1);
+
+    TSet<FString> OnlyNames;
+    const TArray<TSharedPtr<FJsonValue>>* NameValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("actor_names"), NameValues))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *NameValues)
+        {
+            OnlyNames.Add(Value->AsString());
+        }
+    }
+
+    // Group candidates. TMap keeps insertion order, so output is stable across runs.
+    TMap<FConsolidationKey, TArray<AStaticMeshActor*>> Groups;
+    int32 Skipped = 0;
+    for (TActorIterator<AStaticMeshActor> It(World); It; ++It)
+    {
+        AStaticMeshActor* Actor = *It;
+        if (OnlyNames.Num() > 0 && !OnlyNames.Contains(Actor->GetName()) && !OnlyNames.Contains(Actor->GetActorLabel()))
+        {
+            continue;
+        }
+        FConsolidationKey Key;
+        if (!MakeConsolidationKey(Actor, Key))
+        {
+            ++Skipped;
+            continue;
+        }
+        Groups.FindOrAdd(MoveTemp(Key)).Add(Actor);
+    }
+
+    int32 ActorsBefore = 0;
+    int32 ActorsAfter = 0;
+    int32 DrawCallsBefore = 0;
+    int32 DrawCallsAfter = 0;
+    TArray<TSharedPtr<FJsonValue>> GroupsJson;
+
+    TUniquePtr<FScopedTransaction> Transaction;
+    TUniquePtr<FNavigationLockContext> NavLock;
+    if (!bDryRun)
+    {
+        Transaction = MakeUnique<FScopedTransaction>(
+            NSLOCTEXT("UnrealMCP", "ConsolidateToInstances", "MCP Consolidate To Instances"));
+        NavLock = MakeUnique<FNavigationLockContext>(World, ENavigationLockReason::Unknown);
+    }
+    TSet<ULevel*> ModifiedLevels;
+
+    for (TPair<FConsolidationKey, TArray<AStaticMeshActor*>>& Group : Groups)
+    {
+        const FConsolidationKey& Key = Group.Key;
+        TArray<AStaticMeshActor*>& Actors = Group.Value;
+        if (Actors.Num() < MinGroupSize)
+        {
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> GroupJson = MakeShared<FJsonObject>();
+        GroupJson->SetStringField(TEXT("mesh"), Key.Mesh->GetPathName());
+        GroupJson->SetStringField(TEXT("level"), Key.Level->GetOutermost()->GetName());
+        GroupJson->SetStringField(TEXT("collision_profile"), Key.CollisionProfile.ToString());
+        GroupJson->SetNumberField(TEXT("instance_count"), Actors.Num());
+
+        if (!bDryRun)
+        {
+            if (!ModifiedLevels.Contains(Key.Level))
+            {
+                Key.Level->Modify();
+                ModifiedLevels.Add(Key.Level);
+            }
+            const FName HolderName = MakeUniqueObjectName(Key.Level, AActor::StaticClass(),
+                FName(*FString::Printf(TEXT("HISM_%s"), *Key.Mesh->GetName())));
+            UHierarchicalInstancedStaticMeshComponent* Component =
+                CreateInstanceActor(World, HolderName.ToString(), Key.Mesh, Key.Level);
+            if (!Component)
+            {
+                GroupJson->SetStringField(TEXT("error"), TEXT("Failed to spawn instance actor"));
+                GroupsJson.Add(MakeShared<FJsonValueObject>(GroupJson));
+                continue;
+            }
+
+            AActor* Holder = Component->GetOwner();
+            Component->SetMobility(Key.Mobility);
+            Component->SetCollisionProfileName(Key.CollisionProfile);
+            for (int32 Slot = 0; Slot < Key.Materials.Num(); ++Slot)
+            {
+                if (Key.Materials[Slot])
+                {
+                    Component->SetMaterial(Slot, Key.Materials[Slot]);
+                }
+            }
+            Holder->SetFolderPath(Actors[0]->GetFolderPath());
+            // Every actor in the group has these exact tags (they are part of the key).
+            Holder->Tags = Actors[0]->Tags;
+            Component->ComponentTags = Actors[0]->GetStaticMeshComponent()->ComponentTags;
+
+            TArray<FTransform> Transforms;
+            Transforms.Reserve(Actors.Num());
+            for (AStaticMeshActor* Actor : Actors)
+            {
+                Transforms.Add(Actor->GetActorTransform());
+            }
+
+            Component->bAutoRebuildTreeOnInstanceChanges = false;
+            Component->AddInstances(Transforms, /*bShouldReturnIndices=*/false, /*bWorldSpace=*/true);
+            Component->bAutoRebuildTreeOnInstanceChanges = true;
+            Component->BuildTreeIfOutdated(/*Async=*/true, /*ForceUpdate=*/true);
+            Component->PostEditChange();
+
+            for (AStaticMeshActor* Actor : Actors)
+            {
+                World->EditorDestroyActor(Actor, /*bShouldModifyLevel=*/true);
+            }
+            GroupJson->SetStringField(TEXT("actor_name"), Holder->GetName());
+        }
+
+        // Only groups that were (or in a dry run would be) consolidated count towards the totals.
+        // Draw calls are estimated from LOD0 sections: one per section per actor before,
+        // one per section per HISM after (ignoring cluster culling splits).
+        const int32 Sections = FMath::Max(Key.Mesh->GetNumSections(0), 1);
+        ActorsBefore += Actors.Num();
+        ActorsAfter += 1;
+        DrawCallsBefore += Sections * Actors.Num();
+        DrawCallsAfter += Sections;
+
+        GroupsJson.Add(MakeShared<FJsonValueObject>(GroupJson));
+    }
+
+    if (!bDryRun && ModifiedLevels.Num() > 0)
+    {
+        for (ULevel* Level : ModifiedLevels)
+        {
+            Level->MarkPackageDirty();
+        }
+        GEditor->RedrawLevelEditingViewports();
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("dry_run"), bDryRun);
+    Result->SetArrayField(TEXT("groups"), GroupsJson);
+    Result->SetNumberField(TEXT("skipped"), Skipped);
+    Result->SetNumberField(TEXT("actors_before"), ActorsBefore);
+    Result->SetNumberField(TEXT("actors_after"), ActorsAfter);
+    Result->SetNumberField(TEXT("draw_calls_before"), DrawCallsBefore);
+    Result->SetNumberField(TEXT("draw_calls_after"), DrawCallsAfter);
+    return Result;
+}
@@ -20,16 +20,527 @@
 #include "AssetRegistryModule.h"
 #endif
 #include "Kismet2/CompilerResultsLog.h"
+#include "UObject/UObjectGlobals.h"
+#include "MCPJobManager.h"
+#include "MCPWorldChangeJournal.h"
+#include "UObject/ObjectRedirector.h"
 #include "UnrealMCPCompat.h"
 
-FUnrealMCPTestCommands::FUnrealMCPTestCommands()
+// ---------------------------------------------------------------------------
+// Shared compile helpers
+// ---------------------------------------------------------------------------
+
+/** Compile Blueprint into ResultsLog; returns the status string and whether it counts as valid. */
+static FString CompileForValidation(UBlueprint* Blueprint, FCompilerResultsLog& ResultsLog, bool& bOutValid)
+{
+    ResultsLog.bSilentMode = true;  // suppress editor notifications
+    FKismetEditorUtilities::CompileBlueprint(Blueprint,
+        EBlueprintCompileOptions::SkipGarbageCollection, &ResultsLog);
+
+    switch (Blueprint->Status)
+    {
+        case EBlueprintStatus::BS_UpToDate:
+            bOutValid = true;  return TEXT("UpToDate");
+        case EBlueprintStatus::BS_UpToDateWithWarnings:
+            bOutValid = true;  return TEXT("UpToDateWithWarnings");
+        case EBlueprintStatus::BS_Dirty:
+            bOutValid = false; return TEXT("Dirty");
+        case EBlueprintStatus::BS_Error:
+            bOutValid = false; return TEXT("Error");
+        default:
+            bOutValid = false; return TEXT("Unknown");
+    }
+}
+
+/** Split compiler messages by severity; OutWarnings may be null when the caller drops them. */
+static void CollectCompilerMessages(const FCompilerResultsLog& ResultsLog,
+    TArray<TSharedPtr<FJsonValue>>& OutErrors, TArray<TSharedPtr<FJsonValue>>* OutWarnings)
+{
+    for (const TSharedRef<FTokenizedMessage>& Msg : ResultsLog.Messages)
+    {
+        switch (Msg->GetSeverity())
+        {
+            case EMessageSeverity::Error:
+            case EMessageSeverity::CriticalError:
+                OutErrors.Add(MakeShared<FJsonValueString>(Msg->ToText().ToString()));
+                break;
+            case EMessageSeverity::Warning:
+                if (OutWarnings)
+                    OutWarnings->Add(MakeShared<FJsonValueString>(Msg->ToText().ToString()));
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// validate_blueprints job
+// ---------------------------------------------------------------------------
+
+/**
+ * Loads and compiles a list of blueprints a few per frame. Each blueprint gets
+ * its own results log and timing so errors stream out as soon as it is done;
+ * garbage is collected between batches so a project-wide pass does not keep
+ * every loaded blueprint (and its dependencies) resident until the end.
+ */
+class FValidateBlueprintsJob : public FMCPJob
+{
+public:
+    FValidateBlueprintsJob(TArray<FSoftObjectPath>&& InPaths, int32 InBatchSize,
+                           bool bInIncludeWarnings, bool bInIncludePassing)
+        : Paths(MoveTemp(InPaths))
+        , BatchSize(FMath::Max(InBatchSize, 1))
+        , bIncludeWarnings(bInIncludeWarnings)
+        , bIncludePassing(bInIncludePassing)
+    {
+    }
+
+    virtual bool Step(double Deadline) override
+    {
+        if (Next >= Paths.Num())
+            return true;
+
+        // At least one blueprint per step, so even a budget shorter than one compile makes progress
+        do
+        {
+            ValidateOne(Paths[Next++]);
+
+            if (++InBatch >= BatchSize)
+            {
+                InBatch = 0;
+                if (bLoadedInBatch)
+                {
+                    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+                    bLoadedInBatch = false;
+                }
+                break;  // GC ate this frame's budget
+            }
+        }
+        while (Next < Paths.Num() && FPlatformTime::Seconds() < Deadline);
+
+        return Next >= Paths.Num();
+    }
+
+    virtual int32 GetCompleted() const override { return Next; }
+    virtual int32 GetTotal() const override { return Paths.Num(); }
+    virtual int32 GetNumResults() const override { return Results.Num(); }
+    virtual TSharedPtr<FJsonValue> GetResult(int32 Index) const override { return Results[Index]; }
+
+    virtual void WriteSummary(FJsonObject& OutSummary) const override
+    {
+        OutSummary.SetNumberField(TEXT("validated"), Next);
+        OutSummary.SetNumberField(TEXT("passed"), NumPassed);
+        OutSummary.SetNumberField(TEXT("with_warnings"), NumWithWarnings);
+        OutSummary.SetNumberField(TEXT("failed"), NumFailed);
+        OutSummary.SetNumberField(TEXT("load_failed"), NumLoadFailed);
+        OutSummary.SetNumberField(TEXT("total_compile_ms"), FMath::RoundToInt(TotalCompileMs));
+
+        TArray<TSharedPtr<FJsonValue>> SlowestArray;
+        for (const TPair<double, FString>& Entry : Slowest)
+        {
+            TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+            Obj->SetStringField(TEXT("path"), Entry.Value);
+            Obj->SetNumberField(TEXT("compile_ms"), FMath::RoundToInt(Entry.Key));
+            SlowestArray.Add(MakeShared<FJsonValueObject>(Obj));
+        }
+        OutSummary.SetArrayField(TEXT("slowest"), SlowestArray);
+    }
+
+private:
+    static constexpr int32 MaxSlowest = 10;
+
+    void ValidateOne(const FSoftObjectPath& Path)
+    {
+        const FString PathString = Path.ToString();
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("path"), PathString);
+
+        const double LoadStart = FPlatformTime::Seconds();
+        UBlueprint* Blueprint = Cast<UBlueprint>(Path.ResolveObject());
+        if (!Blueprint)
+        {
+            Blueprint = Cast<UBlueprint>(Path.TryLoad());
+            bLoadedInBatch = true;
+        }
+        const double LoadMs = (FPlatformTime::Seconds() - LoadStart) * 1000.0;
+
+        if (!Blueprint)
+        {
+            ++NumLoadFailed;
+            Entry->SetBoolField(TEXT("is_valid"), false);
+            Entry->SetStringField(TEXT("compile_status"), TEXT("LoadFailed"));
+            Results.Add(MakeShared<FJsonValueObject>(Entry));
+            return;
+        }
+
+        FCompilerResultsLog ResultsLog;
+        bool bIsValid = false;
+        const double CompileStart = FPlatformTime::Seconds();
+        const FString StatusStr = CompileForValidation(Blueprint, ResultsLog, bIsValid);
+        const double CompileMs = (FPlatformTime::Seconds() - CompileStart) * 1000.0;
+
+        TotalCompileMs += CompileMs;
+        RecordSlowest(CompileMs, PathString);
+
+        if (!bIsValid)
+            ++NumFailed;
+        else if (ResultsLog.NumWarnings > 0)
+            ++NumWithWarnings;
+        else
+            ++NumPassed;
+
+        if (bIsValid && ResultsLog.NumWarnings == 0 && !bIncludePassing)
+            return;
+
+        TArray<TSharedPtr<FJsonValue>> ErrorArray;
+        TArray<TSharedPtr<FJsonValue>> WarningArray;
+        CollectCompilerMessages(ResultsLog, ErrorArray, bIncludeWarnings ? &WarningArray : nullptr);
+
+        Entry->SetBoolField(TEXT("is_valid"), bIsValid);
+        Entry->SetStringField(TEXT("compile_status"), StatusStr);
+        Entry->SetNumberField(TEXT("error_count"), (double)ResultsLog.NumErrors);
+        Entry->SetNumberField(TEXT("warning_count"), (double)ResultsLog.NumWarnings);
+        Entry->SetArrayField(TEXT("errors"), ErrorArray);
+        if (bIncludeWarnings)
+            Entry->SetArrayField(TEXT("warnings"), WarningArray);
+        Entry->SetNumberField(TEXT("load_ms"), FMath::RoundToInt(LoadMs));
+        Entry->SetNumberField(TEXT("compile_ms"), FMath::RoundToInt(CompileMs));
+        Results.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+
+    /** Keep the MaxSlowest longest compiles, longest first. */
+    void RecordSlowest(double CompileMs, const FString& PathString)
+    {
+        if (Slowest.Num() == MaxSlowest && CompileMs <= Slowest.Last().Key)
+            return;
+
+        int32 InsertAt = Slowest.Num();
+        while (InsertAt > 0 && Slowest[InsertAt - 1].Key < CompileMs)
+            --InsertAt;
+        Slowest.Insert(TPair<double, FString>(CompileMs, PathString), InsertAt);
+        if (Slowest.Num() > MaxSlowest)
+            Slowest.Pop();
+    }
+
+    TArray<FSoftObjectPath> Paths;
+    int32 Next = 0;
+    int32 BatchSize;
+    int32 InBatch = 0;
+    bool bLoadedInBatch = false;
+    bool bIncludeWarnings;
+    bool bIncludePassing;
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    int32 NumPassed = 0;
+    int32 NumWithWarnings = 0;
+    int32 NumFailed = 0;
+    int32 NumLoadFailed = 0;
+    double TotalCompileMs = 0.0;
+    TArray<TPair<double, FString>> Slowest;
+};
+
+// ---------------------------------------------------------------------------
+// Level validation
+// ---------------------------------------------------------------------------
+
+/** Checks of one actor, plus what they depended on when they were run. */
+struct FMCPActorValidation
+{
+    /** FMCPWorldChangeJournal::GetActorRevision() at check time. */
+    uint64 Revision = 0;
+    /** Status of the actor class's blueprint at check time (MAX_uint8 for native classes). */
+    uint8 BlueprintStatus = MAX_uint8;
+    /** Last pass that saw this actor; entries not seen by a complete pass are dropped. */
+    uint32 LastPass = 0;
+    TArray<TSharedPtr<FJsonValue>> Issues;
+    /** Path of the actor's blueprint when it has compile errors. */
+    FString ErroredBlueprint;
+};
+
+static UBlueprint* GetActorBlueprint(const AActor* Actor)
+{
+    const UBlueprintGeneratedClass* BPGenClass = Cast<UBlueprintGeneratedClass>(Actor->GetClass());
+    return BPGenClass ? Cast<UBlueprint>(BPGenClass->ClassGeneratedBy) : nullptr;
+}
+
+static void AddActorIssue(FMCPActorValidation& Out, const FString& ActorName, const TCHAR* IssueType, const FString& Detail)
+{
+    TSharedPtr<FJsonObject> Issue = MakeShared<FJsonObject>();
+    Issue->SetStringField(TEXT("actor"), ActorName);
+    Issue->SetStringField(TEXT("issue_type"), IssueType);
+    Issue->SetStringField(TEXT("detail"), Detail);
+    Out.Issues.Add(MakeShared<FJsonValueObject>(Issue));
+}
+
+static void CheckActor(AActor* Actor, UBlueprint* BP, FMCPActorValidation& Out)
+{
+    Out.Issues.Reset();
+    Out.ErroredBlueprint.Reset();
+    const FString ActorName = Actor->GetActorLabel();
+
+    // ── 1. Check if actor's blueprint class has compile errors ──────────
+    if (BP)
+    {
+        if (BP->Status == EBlueprintStatus::BS_Error)
+        {
+            Out.ErroredBlueprint = BP->GetPathName();
+            AddActorIssue(Out, ActorName, TEXT("blueprint_error"),
+                FString::Printf(TEXT("Blueprint '%s' has compile errors"), *BP->GetName()));
+        }
+        else if (BP->Status == EBlueprintStatus::BS_Dirty)
+        {
+            AddActorIssue(Out, ActorName, TEXT("blueprint_dirty"),
+                FString::Printf(TEXT("Blueprint '%s' is dirty (not compiled)"), *BP->GetName()));
+        }
+    }
+
+    // ── 2. Check StaticMeshComponents for missing meshes ─────────────────
+    TArray<UStaticMeshComponent*> MeshComponents;
+    Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
+    for (const UStaticMeshComponent* MeshComp : MeshComponents)
+    {
+        if (MeshComp && !MeshComp->GetStaticMesh())
+        {
+            AddActorIssue(Out, ActorName, TEXT("missing_mesh"),
+                FString::Printf(TEXT("Component '%s' has no StaticMesh assigned"), *MeshComp->GetName()));
+        }
+    }
+
+    // ── 3. Check SkeletalMeshComponents for missing meshes ───────────────
+    TArray<USkeletalMeshComponent*> SkelMeshComponents;
+    Actor->GetComponents<USkeletalMeshComponent>(SkelMeshComponents);
+    for (const USkeletalMeshComponent* SkelComp : SkelMeshComponents)
+    {
+        if (!SkelComp) continue;
+#if ENGINE_MAJOR_VERSION >= 5
+        if (!SkelComp->GetSkeletalMeshAsset())
+#else
+        if (!SkelComp->SkeletalMesh)
+#endif
+        {
+            AddActorIssue(Out, ActorName, TEXT("missing_skeletal_mesh"),
+                FString::Printf(TEXT("Component '%s' has no SkeletalMesh assigned"), *SkelComp->GetName()));
+        }
+    }
+
+    // ── 4. Check for orphaned scene components (no parent, not root) ─────
+    TArray<USceneComponent*> SceneComponents;
+    Actor->GetComponents<USceneComponent>(SceneComponents);
+    for (const USceneComponent* SceneComp : SceneComponents)
+    {
+        if (SceneComp && SceneComp != Actor->GetRootComponent() && !SceneComp->GetAttachParent())
+        {
+            AddActorIssue(Out, ActorName, TEXT("orphaned_component"),
+                FString::Printf(TEXT("SceneComponent '%s' has no parent attachment"), *SceneComp->GetName()));
+        }
+    }
+}
+
+/**
+ * Per-actor validation results for the editor world, reused across
+ * run_level_validation calls. An entry is re-checked only when the change
+ * journal reports a newer revision for the actor (it or one of its components
+ * was edited, moved, or an undo happened) or its blueprint's compile status
+ * changed; everything else is answered from the cache.
+ */
+class FMCPLevelValidationCache
+{
+public:
+    explicit FMCPLevelValidationCache(TSharedPtr<FMCPWorldChangeJournal> InJournal)
+        : Journal(MoveTemp(InJournal))
+    {
+    }
+
+    /** Start a pass over World; bFull discards every cached result first. Returns the pass id. */
+    uint32 BeginPass(UWorld* World, bool bFull)
+    {
+        const FObjectKey NewWorldKey(World);
+        if (bFull || NewWorldKey != WorldKey)
+        {
+            Entries.Reset();
+            WorldKey = NewWorldKey;
+        }
+        return ++CurrentPass;
+    }
+
+    const FMCPActorValidation& Validate(AActor* Actor, uint32 Pass, bool& bOutRechecked)
+    {
+        UBlueprint* BP = GetActorBlueprint(Actor);
+        const uint8 BlueprintStatus = BP ? static_cast<uint8>(BP->Status) : MAX_uint8;
+        const uint64 Revision = Journal ? Journal->GetActorRevision(Actor) : 0;
+
+        FMCPActorValidation* Entry = Entries.Find(FObjectKey(Actor));
+        // Without a journal nothing tells us an actor changed, so nothing can be reused
+        bOutRechecked = !Entry || !Journal || Entry->Revision != Revision || Entry->BlueprintStatus != BlueprintStatus;
+        if (!Entry)
+            Entry = &Entries.Add(FObjectKey(Actor));
+
+        if (bOutRechecked)
+        {
+            Entry->Revision = Revision;
+            Entry->BlueprintStatus = BlueprintStatus;
+            CheckActor(Actor, BP, *Entry);
+        }
+        Entry->LastPass = FMath::Max(Entry->LastPass, Pass);
+        return *Entry;
+    }
+
+    /** After a complete pass: forget actors that pass (and any later one) did not see. */
+    void EndPass(uint32 Pass)
+    {
+        for (auto It = Entries.CreateIterator(); It; ++It)
+        {
+            if (It.Value().LastPass < Pass)
+                It.RemoveCurrent();
+        }
+    }
+
+private:
+    TSharedPtr<FMCPWorldChangeJournal> Journal;
+    FObjectKey WorldKey;
+    TMap<FObjectKey, FMCPActorValidation> Entries;
+    uint32 CurrentPass = 0;
+};
+
+/** Aggregated run_level_validation output. */
+struct FLevelValidationTotals
+{
+    int32 TotalActors = 0;
+    int32 Rechecked = 0;
+    int32 NumIssues = 0;
+    TArray<TSharedPtr<FJsonValue>> Issues;
+    TSet<FString> UncompiledBlueprints;
+
+    void Add(const FMCPActorValidation& Validation, bool bRechecked)
+    {
+        ++TotalActors;
+        Rechecked += bRechecked ? 1 : 0;
+        NumIssues += Validation.Issues.Num();
+        Issues.Append(Validation.Issues);
+        if (!Validation.ErroredBlueprint.IsEmpty())
+            UncompiledBlueprints.Add(Validation.ErroredBlueprint);
+    }
+
+    void Write(FJsonObject& Out) const
+    {
+        // ── 5. Redirectors left in the registry (moved assets never fixed up) ──
+        IAssetRegistry& AssetRegistry =
+            FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+        FARFilter Filter;
+#if ENGINE_MAJOR_VERSION >= 5
+        Filter.ClassPaths.Add(UObjectRedirector::StaticClass()->GetClassPathName());
+#else
+        Filter.ClassNames.Add(UObjectRedirector::StaticClass()->GetFName());
+#endif
+        TArray<FAssetData> Redirectors;
+        AssetRegistry.GetAssets(Filter, Redirectors);
+
+        TArray<TSharedPtr<FJsonValue>> BrokenAssetRefs;
+        for (const FAssetData& Asset : Redirectors)
+        {
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
+            BrokenAssetRefs.Add(MakeShared<FJsonValueString>(Asset.GetObjectPathString()));
+#else
+            BrokenAssetRefs.Add(MakeShared<FJsonValueString>(Asset.ObjectPath.ToString()));
+#endif
+        }
+
+        TArray<TSharedPtr<FJsonValue>> UncompiledArray;
+        for (const FString& Path : UncompiledBlueprints)
+            UncompiledArray.Add(MakeShared<FJsonValueString>(Path));
+
+        Out.SetNumberField(TEXT("total_actors"), TotalActors);
+        Out.SetNumberField(TEXT("rechecked_actors"), Rechecked);
+        Out.SetNumberField(TEXT("cached_actors"), TotalActors - Rechecked);
+        Out.SetNumberField(TEXT("actors_with_issues_count"), NumIssues);
+        Out.SetNumberField(TEXT("broken_asset_refs_count"), BrokenAssetRefs.Num());
+        Out.SetArrayField(TEXT("broken_asset_refs"), BrokenAssetRefs);
+        Out.SetNumberField(TEXT("uncompiled_blueprints_count"), UncompiledArray.Num());
+        Out.SetArrayField(TEXT("uncompiled_blueprints"), UncompiledArray);
+    }
+};
+
+/**
+ * run_level_validation spread across frames: validates a snapshot of the
+ * actor list through the shared cache and streams each actor's issues as
+ * results. The registry scan runs once, when the summary is written at the end.
+ */
+class FLevelValidationJob : public FMCPJob
+{
+public:
+    FLevelValidationJob(TSharedRef<FMCPLevelValidationCache> InCache, uint32 InPass,
+                        TArray<TWeakObjectPtr<AActor>>&& InActors)
+        : Cache(MoveTemp(InCache))
+        , Pass(InPass)
+        , Actors(MoveTemp(InActors))
+    {
+    }
+
+    virtual bool Step(double Deadline) override
+    {
+        while (Next < Actors.Num())
+        {
+            AActor* Actor = Actors[Next++].Get();
+            if (Actor && !Actor->IsPendingKillPending())
+            {
+                bool bRechecked = false;
+                Totals.Add(Cache->Validate(Actor, Pass, bRechecked), bRechecked);
+            }
+            if (FPlatformTime::Seconds() >= Deadline)
+                break;
+        }
+
+        if (Next < Actors.Num())
+            return false;
+
+        Cache->EndPass(Pass);
+        Summary = MakeShared<FJsonObject>();
+        Totals.Write(*Summary);
+        return true;
+    }
+
+    virtual int32 GetCompleted() const override { return Next; }
+    virtual int32 GetTotal() const override { return Actors.Num(); }
+    virtual int32 GetNumResults() const override { return Totals.Issues.Num(); }
+    virtual TSharedPtr<FJsonValue> GetResult(int32 Index) const override { return Totals.Issues[Index]; }
+
+    virtual void WriteSummary(FJsonObject& OutSummary) const override
+    {
+        if (Summary)
+        {
+            OutSummary.Values = Summary->Values;
+            return;
+        }
+        OutSummary.SetNumberField(TEXT("total_actors"), Totals.TotalActors);
+        OutSummary.SetNumberField(TEXT("rechecked_actors"), Totals.Rechecked);
+        OutSummary.SetNumberField(TEXT("actors_with_issues_count"), Totals.NumIssues);
+    }
+
+private:
+    TSharedRef<FMCPLevelValidationCache> Cache;
+    uint32 Pass;
+    TArray<TWeakObjectPtr<AActor>> Actors;
+    int32 Next = 0;
+    FLevelValidationTotals Totals;
+    TSharedPtr<FJsonObject> Summary;
+};
+
+FUnrealMCPTestCommands::FUnrealMCPTestCommands(TSharedPtr<FMCPJobManager> InJobManager,
+                                               TSharedPtr<FMCPWorldChangeJournal> InChangeJournal)
+    : JobManager(MoveTemp(InJobManager))
+    , LevelValidationCache(MakeShared<FMCPLevelValidationCache>(MoveTemp(InChangeJournal)))
 {
 }
 
+
 void FUnrealMCPTestCommands::RegisterCommands(FMCPCommandRegistry& Registry)
 {
     Registry.RegisterCommand(TEXT("validate_blueprint"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleValidateBlueprint(P); });
+    Registry.RegisterCommand(TEXT("validate_blueprints"),
+        [this](const TSharedPtr<FJsonObject>& P) { return HandleValidateBlueprints(P); });
     Registry.RegisterCommand(TEXT("run_level_validation"),
         [this](const TSharedPtr<FJsonObject>& P) { return HandleRunLevelValidation(P); });
 }
@@ -50,50 +561,17 @@ TSharedPtr<FJsonObject> FUnrealMCPTestCommands::HandleValidateBlueprint(const TS
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprintByName(BlueprintName, AssetPath);
     if (!Blueprint)
         return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName));
 
     // Compile with a results log to capture errors/warnings
     FCompilerResultsLog ResultsLog;
-    ResultsLog.bSilentMode = true;  // suppress editor notifications
-    FKismetEditorUtilities::CompileBlueprint(Blueprint,
-        EBlueprintCompileOptions::SkipGarbageCollection, &ResultsLog);
-
-    // Compile status string
-    FString StatusStr;
     bool bIsValid = false;
-    switch (Blueprint->Status)
-    {
-        case EBlueprintStatus::BS_UpToDate:
-            StatusStr = TEXT("UpToDate"); bIsValid = true; break;
-        case EBlueprintStatus::BS_UpToDateWithWarnings:
-            StatusStr = TEXT("UpToDateWithWarnings"); bIsValid = true; break;
-        case EBlueprintStatus::BS_Dirty:
-            StatusStr = TEXT("Dirty"); bIsValid = false; break;
-        case EBlueprintStatus::BS_Error:
-            StatusStr = TEXT("Error"); bIsValid = false; break;
-        default:
-            StatusStr = TEXT("Unknown"); bIsValid = false; break;
-    }
+    const FString StatusStr = CompileForValidation(Blueprint, ResultsLog, bIsValid);
 
     // Collect error / warning messages from the compiler log
     TArray<TSharedPtr<FJsonValue>> ErrorArray;
     TArray<TSharedPtr<FJsonValue>> WarningArray;
-    for (const TSharedRef<FTokenizedMessage>& Msg : ResultsLog.Messages)
-    {
-        FString Text = Msg->ToText().ToString();
-        switch (Msg->GetSeverity())
-        {
-            case EMessageSeverity::Error:
-            case EMessageSeverity::CriticalError:
-                ErrorArray.Add(MakeShared<FJsonValueString>(Text));
-                break;
-            case EMessageSeverity::Warning:
-                WarningArray.Add(MakeShared<FJsonValueString>(Text));
-                break;
-            default:
-                break;
-        }
-    }
+    CollectCompilerMessages(ResultsLog, ErrorArray, &WarningArray);
 
     // Count total nodes across all event graphs and function graphs
     int32 NodeCount = 0;
@@ -117,9 +595,91 @@ TSharedPtr<FJsonObject> FUnrealMCPTestCommands::HandleValidateBlueprint(const TS
     return Result;
 }
 
+// ---------------------------------------------------------------------------
+// validate_blueprints
+// Params: path (string, default "/Game"), recursive (bool, default true),
+//         name_filter (string, optional substring), batch_size (number, default 50;
+//         GC runs between batches), budget_ms (number, default 20; game-thread
+//         time per frame), include_warnings (bool, default true),
+//         include_passing (bool, default true)
+// Returns a job_id at once; poll get_job_status for per-blueprint results.
+// ---------------------------------------------------------------------------
+TSharedPtr<FJsonObject> FUnrealMCPTestCommands::HandleValidateBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    if (!JobManager)
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Job manager not available"));
+
+    FString PackagePath = TEXT("/Game");
+    Params->TryGetStringField(TEXT("path"), PackagePath);
+    while (PackagePath.Len() > 1 && PackagePath.EndsWith(TEXT("/")))
+        PackagePath.LeftChopInline(1);
+
+    FString NameFilter;
+    Params->TryGetStringField(TEXT("name_filter"), NameFilter);
+
+    double BatchSize = 50.0;
+    Params->TryGetNumberField(TEXT("batch_size"), BatchSize);
+    double BudgetMs = 20.0;
+    Params->TryGetNumberField(TEXT("budget_ms"), BudgetMs);
+    bool bIncludeWarnings = true;
+    Params->TryGetBoolField(TEXT("include_warnings"), bIncludeWarnings);
+    bool bIncludePassing = true;
+    Params->TryGetBoolField(TEXT("include_passing"), bIncludePassing);
+
+    IAssetRegistry& AssetRegistry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+    FARFilter Filter;
+#if ENGINE_MAJOR_VERSION >= 5
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+#else
+    Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
+#endif
+    Filter.bRecursiveClasses = true;
+    Filter.bRecursivePaths = true;
+    Params->TryGetBoolField(TEXT("recursive"), Filter.bRecursivePaths);
+    Filter.PackagePaths.Add(FName(*PackagePath));
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(Filter, Assets);
+
+    TArray<FSoftObjectPath> Paths;
+    Paths.Reserve(Assets.Num());
+    for (const FAssetData& Asset : Assets)
+    {
+        if (!NameFilter.IsEmpty() && !Asset.AssetName.ToString().Contains(NameFilter))
+            continue;
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
+        Paths.Add(FSoftObjectPath(Asset.GetObjectPathString()));
+#else
+        Paths.Add(FSoftObjectPath(Asset.ObjectPath.ToString()));
+#endif
+    }
+    // Package order keeps blueprints of one folder (and their shared dependencies) in the same batch
+    Paths.Sort([](const FSoftObjectPath& A, const FSoftObjectPath& B) { return A.ToString() < B.ToString(); });
+
+    const int32 Total = Paths.Num();
+    const FString JobId = JobManager->Submit(TEXT("validate_blueprints"),
+        MakeShared<FValidateBlueprintsJob>(MoveTemp(Paths), static_cast<int32>(BatchSize),
+            bIncludeWarnings, bIncludePassing),
+        BudgetMs);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("job_id"), JobId);
+    Result->SetStringField(TEXT("path"), PackagePath);
+    Result->SetNumberField(TEXT("total"), Total);
+    // Still scanning: blueprints the registry has not discovered yet are not in this run
+    Result->SetBoolField(TEXT("registry_partial"), AssetRegistry.IsLoadingAssets());
+    return Result;
+}
+
 // ---------------------------------------------------------------------------
 // run_level_validation
-// Scans all actors in the current editor world for common issues.
+// Params: full (bool, default false: re-check every actor, ignoring the cache),
+//         budget_ms (number, optional: run as a background job using this much
+//         game-thread time per frame; poll get_job_status)
+// Actors whose journal revision and blueprint status are unchanged since the
+// last run reuse their cached result.
 // ---------------------------------------------------------------------------
 TSharedPtr<FJsonObject> FUnrealMCPTestCommands::HandleRunLevelValidation(const TSharedPtr<FJsonObject>& Params)
 {
@@ -130,145 +690,45 @@ TSharedPtr<FJsonObject> FUnrealMCPTestCommands::HandleRunLevelValidation(const T
     if (!World)
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world available"));
 
-    IAssetRegistry& AssetRegistry =
-        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    bool bFull = false;
+    Params->TryGetBoolField(TEXT("full"), bFull);
+    double BudgetMs = 0.0;
+    Params->TryGetNumberField(TEXT("budget_ms"), BudgetMs);
 
-    TArray<TSharedPtr<FJsonValue>> ActorIssues;
-    TArray<TSharedPtr<FJsonValue>> BrokenAssetRefs;
-    TArray<TSharedPtr<FJsonValue>> UncompiledBlueprints;
+    const uint32 Pass = LevelValidationCache->BeginPass(World, bFull);
 
-    int32 TotalActors = 0;
+    if (BudgetMs > 0.0 && JobManager)
+    {
+        // Snapshot the actor list; the job re-resolves each actor when it gets to it
+        TArray<TWeakObjectPtr<AActor>> Actors;
+        for (TActorIterator<AActor> It(World); It; ++It)
+            Actors.Add(*It);
 
+        const int32 Total = Actors.Num();
+        const FString JobId = JobManager->Submit(TEXT("run_level_validation"),
+            MakeShared<FLevelValidationJob>(LevelValidationCache.ToSharedRef(), Pass, MoveTemp(Actors)),
+            BudgetMs);
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("job_id"), JobId);
+        Result->SetNumberField(TEXT("total"), Total);
+        return Result;
+    }
+
+    FLevelValidationTotals Totals;
     for (TActorIterator<AActor> It(World); It; ++It)
     {
         AActor* Actor = *It;
         if (!Actor || Actor->IsPendingKillPending())
             continue;
 
-        ++TotalActors;
-        const FString ActorName = Actor->GetActorLabel();
-
-        // ── 1. Check if actor's blueprint class has compile errors ──────────
-        UClass* ActorClass = Actor->GetClass();
-        if (UBlueprintGeneratedClass* BPGenClass = Cast<UBlueprintGeneratedClass>(ActorClass))
-        {
-            UBlueprint* BP = Cast<UBlueprint>(BPGenClass->ClassGeneratedBy);
-            if (BP)
-            {
-                if (BP->Status == EBlueprintStatus::BS_Error)
-                {
-                    // Add to uncompiled/errored blueprints list (deduplicated by path)
-                    FString BPPath = BP->GetPathName();
-                    bool bAlreadyListed = false;
-                    for (const TSharedPtr<FJsonValue>& V : UncompiledBlueprints)
-                        if (V->AsString() == BPPath) { bAlreadyListed = true; break; }
-                    if (!bAlreadyListed)
-                        UncompiledBlueprints.Add(MakeShared<FJsonValueString>(BPPath));
-
-                    TSharedPtr<FJsonObject> Issue = MakeShared<FJsonObject>();
-                    Issue->SetStringField(TEXT("actor"), ActorName);
-                    Issue->SetStringField(TEXT("issue_type"), TEXT("blueprint_error"));
-                    Issue->SetStringField(TEXT("detail"),
-                        FString::Printf(TEXT("Blueprint '%s' has compile errors"), *BP->GetName()));
-                    ActorIssues.Add(MakeShared<FJsonValueObject>(Issue));
-                }
-                else if (BP->Status == EBlueprintStatus::BS_Dirty)
-                {
-                    TSharedPtr<FJsonObject> Issue = MakeShared<FJsonObject>();
-                    Issue->SetStringField(TEXT("actor"), ActorName);
-                    Issue->SetStringField(TEXT("issue_type"), TEXT("blueprint_dirty"));
-                    Issue->SetStringField(TEXT("detail"),
-                        FString::Printf(TEXT("Blueprint '%s' is dirty (not compiled)"), *BP->GetName()));
-                    ActorIssues.Add(MakeShared<FJsonValueObject>(Issue));
-                }
-            }
-        }
-
-        // ── 2. Check StaticMeshComponents for missing meshes ─────────────────
-        TArray<UStaticMeshComponent*> MeshComponents;
-        Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
-        for (const UStaticMeshComponent* MeshComp : MeshComponents)
-        {
-            if (!MeshComp) continue;
-            const UStaticMesh* Mesh = MeshComp->GetStaticMesh();
-            if (!Mesh)
-            {
-                TSharedPtr<FJsonObject> Issue = MakeShared<FJsonObject>();
-                Issue->SetStringField(TEXT("actor"), ActorName);
-                Issue->SetStringField(TEXT("issue_type"), TEXT("missing_mesh"));
-                Issue->SetStringField(TEXT("detail"),
-                    FString::Printf(TEXT("Component '%s' has no StaticMesh assigned"),
-                        *MeshComp->GetName()));
-                ActorIssues.Add(MakeShared<FJsonValueObject>(Issue));
-            }
-        }
-
-        // ── 3. Check SkeletalMeshComponents for missing meshes ───────────────
-        TArray<USkeletalMeshComponent*> SkelMeshComponents;
-        Actor->GetComponents<USkeletalMeshComponent>(SkelMeshComponents);
-        for (const USkeletalMeshComponent* SkelComp : SkelMeshComponents)
-        {
-            if (!SkelComp) continue;
-#if ENGINE_MAJOR_VERSION >= 5
-            if (!SkelComp->GetSkeletalMeshAsset())
-#else
-            if (!SkelComp->SkeletalMesh)
-#endif
-            {
-                TSharedPtr<FJsonObject> Issue = MakeShared<FJsonObject>();
-                Issue->SetStringField(TEXT("actor"), ActorName);
-                Issue->SetStringField(TEXT("issue_type"), TEXT("missing_skeletal_mesh"));
-                Issue->SetStringField(TEXT("detail"),
-                    FString::Printf(TEXT("Component '%s' has no SkeletalMesh assigned"),
-                        *SkelComp->GetName()));
-                ActorIssues.Add(MakeShared<FJsonValueObject>(Issue));
-            }
-        }
-
-        // ── 4. Check for orphaned scene components (no parent, not root) ─────
-        TArray<USceneComponent*> SceneComponents;
-        Actor->GetComponents<USceneComponent>(SceneComponents);
-        for (const USceneComponent* SceneComp : SceneComponents)
-        {
-            if (!SceneComp) continue;
-            if (SceneComp == Actor->GetRootComponent()) continue;
-            if (!SceneComp->GetAttachParent())
-            {
-                TSharedPtr<FJsonObject> Issue = MakeShared<FJsonObject>();
-                Issue->SetStringField(TEXT("actor"), ActorName);
-                Issue->SetStringField(TEXT("issue_type"), TEXT("orphaned_component"));
-                Issue->SetStringField(TEXT("detail"),
-                    FString::Printf(TEXT("SceneComponent '%s' has no parent attachment"),
-                        *SceneComp->GetName()));
-                ActorIssues.Add(MakeShared<FJsonValueObject>(Issue));
-            }
-        }
-    }
-
-    // ── 5. Scan asset registry for broken redirectors ─────────────────────────
-    TArray<FAssetData> AllAssets;
-    AssetRegistry.GetAllAssets(AllAssets, /*bSkipARFilteredAssets=*/true);
-    for (const FAssetData& Asset : AllAssets)
-    {
-        if (Asset.IsRedirector())
-        {
-            // A redirector that still exists means the target may have moved but the
-            // redirector was never fixed up — flag it for the caller.
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-            BrokenAssetRefs.Add(MakeShared<FJsonValueString>(Asset.GetObjectPathString()));
-#else
-            BrokenAssetRefs.Add(MakeShared<FJsonValueString>(Asset.ObjectPath.ToString()));
-#endif
-        }
+        bool bRechecked = false;
+        Totals.Add(LevelValidationCache->Validate(Actor, Pass, bRechecked), bRechecked);
     }
+    LevelValidationCache->EndPass(Pass);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetNumberField(TEXT("total_actors"), TotalActors);
-    Result->SetNumberField(TEXT("actors_with_issues_count"), ActorIssues.Num());
-    Result->SetArrayField(TEXT("actors_with_issues"), ActorIssues);
-    Result->SetNumberField(TEXT("broken_asset_refs_count"), BrokenAssetRefs.Num());
-    Result->SetArrayField(TEXT("broken_asset_refs"), BrokenAssetRefs);
-    Result->SetNumberField(TEXT("uncompiled_blueprints_count"), UncompiledBlueprints.Num());
-    Result->SetArrayField(TEXT("uncompiled_blueprints"), UncompiledBlueprints);
+    Totals.Write(*Result);
+    Result->SetArrayField(TEXT("actors_with_issues"), Totals.Issues);
     return Result;
 }
@@ -72,6 +72,38 @@ void FUnrealMCPUMGCommands::RegisterCommands(FMCPCommandRegistry& Registry)
 		[this](const TSharedPtr<FJsonObject>& P) { return HandleGetWidgetTree(P); });
 }
 
+// ---------------------------------------------------------------------------
+// Helper: resolve a WidgetBlueprint. An explicit "path" directory keeps the
+// <path>/<name> lookup; otherwise the name is resolved project-wide, with
+// /Game/Widgets/ (where create_umg_widget_blueprint puts them) preferred.
+// ---------------------------------------------------------------------------
+static UWidgetBlueprint* FindWidgetBlueprint(const TSharedPtr<FJsonObject>& Params, const FString& BlueprintName, FString& OutError)
+{
+	FString AssetPath;
+	FString WidgetDir;
+	if (Params->TryGetStringField(TEXT("path"), WidgetDir) && !WidgetDir.IsEmpty())
+	{
+		if (!WidgetDir.EndsWith(TEXT("/"))) { WidgetDir += TEXT("/"); }
+		AssetPath = WidgetDir + BlueprintName;
+	}
+
+	UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprintByName(BlueprintName, AssetPath, TEXT("/Game/Widgets/"));
+	if (!Blueprint)
+	{
+		OutError = AssetPath.IsEmpty()
+			? FUnrealMCPCommonUtils::DescribeBlueprintLookupFailure(BlueprintName)
+			: FString::Printf(TEXT("Widget Blueprint '%s' not found at '%s'"), *BlueprintName, *AssetPath);
+		return nullptr;
+	}
+
+	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Blueprint);
+	if (!WidgetBlueprint)
+	{
+		OutError = FString::Printf(TEXT("'%s' is not a Widget Blueprint"), *Blueprint->GetPathName());
+	}
+	return WidgetBlueprint;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCreateUMGWidgetBlueprint(const TSharedPtr<FJsonObject>& Params)
 {
 	// Get required parameters
@@ -165,18 +197,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddTextBlockToWidget(const
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'widget_name' parameter"));
 	}
 
-	// Resolve path: use caller-supplied "path" or fall back to default
-	FString WidgetPath;
-	if (!Params->TryGetStringField(TEXT("path"), WidgetPath) || WidgetPath.IsEmpty())
-	{
-		WidgetPath = TEXT("/Game/Widgets/");
-	}
-	if (!WidgetPath.EndsWith(TEXT("/"))) { WidgetPath += TEXT("/"); }
-	FString FullPath = WidgetPath + BlueprintName;
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	FString LookupError;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(Params, BlueprintName, LookupError);
 	if (!WidgetBlueprint)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Widget Blueprint '%s' not found at '%s'"), *BlueprintName, *FullPath));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(LookupError);
 	}
 
 	// Get optional parameters
@@ -234,18 +259,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddWidgetToViewport(const T
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
 	}
 
-	// Resolve path: use caller-supplied "path" or fall back to default
-	FString WidgetPath;
-	if (!Params->TryGetStringField(TEXT("path"), WidgetPath) || WidgetPath.IsEmpty())
-	{
-		WidgetPath = TEXT("/Game/Widgets/");
-	}
-	if (!WidgetPath.EndsWith(TEXT("/"))) { WidgetPath += TEXT("/"); }
-	FString FullPath = WidgetPath + BlueprintName;
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	FString LookupError;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(Params, BlueprintName, LookupError);
 	if (!WidgetBlueprint)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Widget Blueprint '%s' not found at '%s'"), *BlueprintName, *FullPath));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(LookupError);
 	}
 
 	// Get optional Z-order parameter
@@ -298,18 +316,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddButtonToWidget(const TSh
 		return Response;
 	}
 
-	// Resolve path: use caller-supplied "path" or fall back to default
-	FString WidgetDir;
-	if (!Params->TryGetStringField(TEXT("path"), WidgetDir) || WidgetDir.IsEmpty())
-	{
-		WidgetDir = TEXT("/Game/Widgets/");
-	}
-	if (!WidgetDir.EndsWith(TEXT("/"))) { WidgetDir += TEXT("/"); }
-	const FString BlueprintPath = FString::Printf(TEXT("%s%s.%s"), *WidgetDir, *BlueprintName, *BlueprintName);
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintPath));
+	FString LookupError;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(Params, BlueprintName, LookupError);
 	if (!WidgetBlueprint)
 	{
-		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to load Widget Blueprint: %s"), *BlueprintPath));
+		Response->SetStringField(TEXT("error"), LookupError);
 		return Response;
 	}
 
@@ -354,7 +365,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddButtonToWidget(const TSh
 
 	// Save the Widget Blueprint
 	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	UEditorAssetLibrary::SaveLoadedAsset(WidgetBlueprint, false);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("widget_name"), WidgetName);
@@ -387,20 +398,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBindWidgetEvent(const TShar
 		return Response;
 	}
 
-	// Resolve path: use caller-supplied "path" or fall back to default
-	FString WidgetDir;
-	if (!Params->TryGetStringField(TEXT("path"), WidgetDir) || WidgetDir.IsEmpty())
-	{
-		WidgetDir = TEXT("/Game/Widgets/");
-	}
-	if (!WidgetDir.EndsWith(TEXT("/"))) { WidgetDir += TEXT("/"); }
-
-	// Load the Widget Blueprint
-	const FString BlueprintPath = FString::Printf(TEXT("%s%s.%s"), *WidgetDir, *BlueprintName, *BlueprintName);
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintPath));
+	FString LookupError;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(Params, BlueprintName, LookupError);
 	if (!WidgetBlueprint)
 	{
-		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to load Widget Blueprint: %s"), *BlueprintPath));
+		Response->SetStringField(TEXT("error"), LookupError);
 		return Response;
 	}
 
@@ -484,7 +486,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBindWidgetEvent(const TShar
 
 	// Save the Widget Blueprint
 	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	UEditorAssetLibrary::SaveLoadedAsset(WidgetBlueprint, false);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("event_name"), EventName);
@@ -517,20 +519,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 		return Response;
 	}
 
-	// Resolve path: use caller-supplied "path" or fall back to default
-	FString WidgetDir;
-	if (!Params->TryGetStringField(TEXT("path"), WidgetDir) || WidgetDir.IsEmpty())
-	{
-		WidgetDir = TEXT("/Game/Widgets/");
-	}
-	if (!WidgetDir.EndsWith(TEXT("/"))) { WidgetDir += TEXT("/"); }
-
-	// Load the Widget Blueprint
-	const FString BlueprintPath = FString::Printf(TEXT("%s%s.%s"), *WidgetDir, *BlueprintName, *BlueprintName);
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintPath));
+	FString LookupError;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(Params, BlueprintName, LookupError);
 	if (!WidgetBlueprint)
 	{
-		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to load Widget Blueprint: %s"), *BlueprintPath));
+		Response->SetStringField(TEXT("error"), LookupError);
 		return Response;
 	}
 
@@ -594,7 +587,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 
 	// Save the Widget Blueprint
 	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	UEditorAssetLibrary::SaveLoadedAsset(WidgetBlueprint, false);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("binding_name"), BindingName);
@@ -612,19 +605,7 @@ static UWidgetBlueprint* LoadWidgetBP(const TSharedPtr<FJsonObject>& Params, FSt
 		OutError = TEXT("Missing 'blueprint_name' parameter");
 		return nullptr;
 	}
-	FString WidgetDir;
-	if (!Params->TryGetStringField(TEXT("path"), WidgetDir) || WidgetDir.IsEmpty())
-	{
-		WidgetDir = TEXT("/Game/Widgets/");
-	}
-	if (!WidgetDir.EndsWith(TEXT("/"))) { WidgetDir += TEXT("/"); }
-	FString FullPath = WidgetDir + BlueprintName;
-	UWidgetBlueprint* WB = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
-	if (!WB)
-	{
-		OutError = FString::Printf(TEXT("Widget Blueprint '%s' not found at '%s'"), *BlueprintName, *FullPath);
-	}
-	return WB;
+	return FindWidgetBlueprint(Params, BlueprintName, OutError);
 }
 
 // ---------------------------------------------------------------------------
@@ -0,0 +1,550 @@
+#include "MCPAssetNameIndex.h"
+#include "Async/Async.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/PlatformTime.h"
+#if ENGINE_MAJOR_VERSION >= 5
+#include "AssetRegistry/IAssetRegistry.h"
+#else
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#endif
+
+/** Packs three lower-cased characters into one posting key. */
+static uint64 MakeTrigram(const TCHAR* Chars)
+{
+	return (static_cast<uint64>(Chars[0] & 0xFFFF) << 32)
+	     | (static_cast<uint64>(Chars[1] & 0xFFFF) << 16)
+	     |  static_cast<uint64>(Chars[2] & 0xFFFF);
+}
+
+static void AppendTrigrams(const FString& Text, TArray<uint64>& OutTrigrams)
+{
+	for (int32 Index = 0; Index + 3 <= Text.Len(); ++Index)
+	{
+		OutTrigrams.Add(MakeTrigram(*Text + Index));
+	}
+}
+
+static void SortUnique(TArray<uint64>& Values)
+{
+	Values.Sort();
+	int32 Write = 0;
+	for (int32 Read = 0; Read < Values.Num(); ++Read)
+	{
+		if (Write == 0 || Values[Write - 1] != Values[Read])
+		{
+			Values[Write++] = Values[Read];
+		}
+	}
+	Values.SetNum(Write);
+}
+
+static IAssetRegistry& GetRegistry()
+{
+#if ENGINE_MAJOR_VERSION >= 5
+	return *IAssetRegistry::Get();
+#else
+	return FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// FIndexData
+// ---------------------------------------------------------------------------
+
+void FMCPAssetNameIndex::FIndexData::Add(const FAssetData& AssetData)
+{
+	FEntry Entry;
+	Entry.ObjectPath = GetObjectPath(AssetData);
+	Entry.AssetName = AssetData.AssetName;
+	Entry.PackageName = AssetData.PackageName;
+#if ENGINE_MAJOR_VERSION >= 5
+	Entry.ClassName = AssetData.AssetClassPath.GetAssetName();
+#else
+	Entry.ClassName = AssetData.AssetClass;
+#endif
+	Entry.LowerName = AssetData.AssetName.ToString().ToLower();
+	Entry.LowerPackage = AssetData.PackageName.ToString().ToLower();
+	AddEntry(MoveTemp(Entry));
+}
+
+void FMCPAssetNameIndex::FIndexData::AddEntry(FEntry&& Entry)
+{
+	Remove(Entry.ObjectPath);
+
+	TArray<uint64> Trigrams;
+	AppendTrigrams(Entry.LowerName, Trigrams);
+	AppendTrigrams(Entry.LowerPackage, Trigrams);
+	SortUnique(Trigrams);
+
+	// Ids only ever grow, so every posting list stays sorted without extra work.
+	const int32 Id = Entries.Num();
+	for (uint64 Trigram : Trigrams)
+	{
+		Postings.FindOrAdd(Trigram).Add(Id);
+	}
+	ByObjectPath.Add(Entry.ObjectPath, Id);
+	Entries.Add(MoveTemp(Entry));
+}
+
+void FMCPAssetNameIndex::FIndexData::Remove(const FString& ObjectPath)
+{
+	int32 Id = INDEX_NONE;
+	if (ByObjectPath.RemoveAndCopyValue(ObjectPath, Id))
+	{
+		// Postings keep the dead id until the next compaction; queries skip it.
+		Entries[Id].bAlive = false;
+		++NumDead;
+	}
+}
+
+void FMCPAssetNameIndex::FIndexData::Compact()
+{
+	FIndexData Fresh;
+	Fresh.Entries.Reserve(Entries.Num() - NumDead);
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.bAlive)
+		{
+			Fresh.AddEntry(MoveTemp(Entry));
+		}
+	}
+	*this = MoveTemp(Fresh);
+}
+
+// ---------------------------------------------------------------------------
+// Lifecycle
+// ---------------------------------------------------------------------------
+
+FMCPAssetNameIndex::~FMCPAssetNameIndex()
+{
+	Stop();
+}
+
+void FMCPAssetNameIndex::Start()
+{
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (bStarted)
+		{
+			return;
+		}
+		bStarted = true;
+	}
+
+	IAssetRegistry& Registry = GetRegistry();
+	AssetAddedHandle = Registry.OnAssetAdded().AddSP(this, &FMCPAssetNameIndex::OnAssetAdded);
+	AssetRemovedHandle = Registry.OnAssetRemoved().AddSP(this, &FMCPAssetNameIndex::OnAssetRemoved);
+	AssetRenamedHandle = Registry.OnAssetRenamed().AddSP(this, &FMCPAssetNameIndex::OnAssetRenamed);
+	AssetUpdatedHandle = Registry.OnAssetUpdated().AddSP(this, &FMCPAssetNameIndex::OnAssetUpdated);
+
+	if (Registry.IsLoadingAssets())
+	{
+		FilesLoadedHandle = Registry.OnFilesLoaded().AddSP(this, &FMCPAssetNameIndex::OnFilesLoaded);
+	}
+	else
+	{
+		KickBuild();
+	}
+}
+
+void FMCPAssetNameIndex::Stop()
+{
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (!bStarted)
+		{
+			return;
+		}
+		bStarted = false;
+		bBuilding = false;
+		bReady = false;
+		Data = FIndexData();
+		PendingEvents.Empty();
+	}
+
+#if ENGINE_MAJOR_VERSION >= 5
+	if (IAssetRegistry* Registry = IAssetRegistry::Get())
+#else
+	if (IAssetRegistry* Registry = &GetRegistry())
+#endif
+	{
+		Registry->OnFilesLoaded().Remove(FilesLoadedHandle);
+		Registry->OnAssetAdded().Remove(AssetAddedHandle);
+		Registry->OnAssetRemoved().Remove(AssetRemovedHandle);
+		Registry->OnAssetRenamed().Remove(AssetRenamedHandle);
+		Registry->OnAssetUpdated().Remove(AssetUpdatedHandle);
+	}
+}
+
+void FMCPAssetNameIndex::OnFilesLoaded()
+{
+	GetRegistry().OnFilesLoaded().Remove(FilesLoadedHandle);
+	FilesLoadedHandle.Reset();
+	KickBuild();
+}
+
+void FMCPAssetNameIndex::KickBuild()
+{
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (bBuilding)
+		{
+			return;
+		}
+		bBuilding = true;
+		PendingEvents.Empty();
+	}
+
+	TWeakPtr<FMCPAssetNameIndex, ESPMode::ThreadSafe> WeakThis = AsShared();
+	Async(EAsyncExecution::ThreadPool, [WeakThis]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		TArray<FAssetData> Assets;
+		GetRegistry().GetAllAssets(Assets, /*bIncludeOnlyOnDiskAssets=*/true);
+
+		FIndexData Built;
+		Built.Entries.Reserve(Assets.Num());
+		for (const FAssetData& AssetData : Assets)
+		{
+			if (ShouldIndex(AssetData))
+			{
+				Built.Add(AssetData);
+			}
+		}
+
+		TSharedPtr<FMCPAssetNameIndex, ESPMode::ThreadSafe> This = WeakThis.Pin();
+		if (!This.IsValid())
+		{
+			return;
+		}
+
+		FWriteScopeLock WriteLock(This->Lock);
+		if (!This->bStarted || !This->bBuilding)
+		{
+			return;
+		}
+		for (const FPendingEvent& Event : This->PendingEvents)
+		{
+			if (Event.bAdded)
+			{
+				Built.Add(Event.Asset);
+			}
+			else
+			{
+				Built.Remove(Event.RemovedPath);
+			}
+		}
+		This->PendingEvents.Empty();
+		This->Data = MoveTemp(Built);
+		This->bBuilding = false;
+		This->bReady = true;
+
+		UE_LOG(LogTemp, Display, TEXT("MCPAssetNameIndex: Indexed %d assets in %.2f s"),
+		       This->Data.Entries.Num(), FPlatformTime::Seconds() - StartTime);
+	});
+}
+
+// ---------------------------------------------------------------------------
+// Registry events (game thread)
+// ---------------------------------------------------------------------------
+
+bool FMCPAssetNameIndex::ShouldIndex(const FAssetData& AssetData)
+{
+	// One-file-per-actor packages and redirectors would swamp name lookups.
+	if (AssetData.PackageName.ToString().Contains(TEXT("/__External")))
+	{
+		return false;
+	}
+#if ENGINE_MAJOR_VERSION >= 5
+	return AssetData.AssetClassPath.GetAssetName() != NAME_ObjectRedirector;
+#else
+	return AssetData.AssetClass != NAME_ObjectRedirector;
+#endif
+}
+
+FString FMCPAssetNameIndex::GetObjectPath(const FAssetData& AssetData)
+{
+#if ENGINE_MAJOR_VERSION >= 5
+	return AssetData.GetObjectPathString();
+#else
+	return AssetData.ObjectPath.ToString();
+#endif
+}
+
+void FMCPAssetNameIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+	++Revision;
+	if (!ShouldIndex(AssetData))
+	{
+		return;
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	if (bBuilding)
+	{
+		FPendingEvent& Event = PendingEvents.AddDefaulted_GetRef();
+		Event.bAdded = true;
+		Event.Asset = AssetData;
+	}
+	else if (bReady)
+	{
+		Data.Add(AssetData);
+	}
+}
+
+void FMCPAssetNameIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	++Revision;
+	const FString ObjectPath = GetObjectPath(AssetData);
+
+	FWriteScopeLock WriteLock(Lock);
+	if (bBuilding)
+	{
+		FPendingEvent& Event = PendingEvents.AddDefaulted_GetRef();
+		Event.RemovedPath = ObjectPath;
+	}
+	else if (bReady)
+	{
+		Data.Remove(ObjectPath);
+		if (Data.NumDead > 1024 && Data.NumDead > Data.Entries.Num() / 4)
+		{
+			Data.Compact();
+		}
+	}
+}
+
+void FMCPAssetNameIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (bBuilding)
+		{
+			FPendingEvent& Event = PendingEvents.AddDefaulted_GetRef();
+			Event.RemovedPath = OldObjectPath;
+		}
+		else if (bReady)
+		{
+			Data.Remove(OldObjectPath);
+		}
+	}
+	OnAssetAdded(AssetData);
+}
+
+void FMCPAssetNameIndex::OnAssetUpdated(const FAssetData& AssetData)
+{
+	// Name and path are unchanged, but dependencies and tags may have moved.
+	++Revision;
+}
+
+// ---------------------------------------------------------------------------
+// Queries (any thread)
+// ---------------------------------------------------------------------------
+
+int32 FMCPAssetNameIndex::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Data.ByObjectPath.Num();
+}
+
+/** Ranking for exact / prefix / substring hits: name hits beat path-only hits, tighter names win. */
+static float ScoreLiteralMatch(const FString& LowerName, const FString& LowerPackage, const FString& Query)
+{
+	float Base = 0.0f;
+	if (LowerName == Query)
+	{
+		return 1.0f;
+	}
+	else if (LowerName.StartsWith(Query))
+	{
+		Base = 0.9f;
+	}
+	else if (LowerName.Contains(Query))
+	{
+		Base = 0.75f;
+	}
+	else if (LowerPackage.Contains(Query))
+	{
+		Base = 0.5f;
+	}
+	else
+	{
+		return 0.0f;
+	}
+	const float Coverage = static_cast<float>(Query.Len()) / FMath::Max(LowerName.Len(), 1);
+	return Base * (0.8f + 0.2f * FMath::Min(Coverage, 1.0f));
+}
+
+TArray<FMCPAssetMatch> FMCPAssetNameIndex::Query(const FString& Text, EMCPAssetMatchMode Mode, int32 Limit,
+                                                 const FString& PathPrefix, FName ClassName) const
+{
+	const FString Needle = Text.ToLower();
+	const FString LowerPrefix = PathPrefix.ToLower();
+
+	TArray<TPair<int32, float>> Scored;
+
+	FReadScopeLock ReadLock(Lock);
+
+	auto Accepts = [&](const FEntry& Entry)
+	{
+		return Entry.bAlive
+			&& (LowerPrefix.IsEmpty() || Entry.LowerPackage.StartsWith(LowerPrefix))
+			&& (ClassName.IsNone() || Entry.ClassName == ClassName);
+	};
+
+	auto ScoreEntry = [&](const FEntry& Entry) -> float
+	{
+		if (Mode == EMCPAssetMatchMode::Prefix)
+		{
+			return Entry.LowerName.StartsWith(Needle)
+				? ScoreLiteralMatch(Entry.LowerName, Entry.LowerPackage, Needle) : 0.0f;
+		}
+		return ScoreLiteralMatch(Entry.LowerName, Entry.LowerPackage, Needle);
+	};
+
+	if (Needle.Len() < 3)
+	{
+		// Too short for trigrams: a linear pass over the (cached, lower-cased) names is still cheap.
+		for (int32 Id = 0; Id < Data.Entries.Num(); ++Id)
+		{
+			const FEntry& Entry = Data.Entries[Id];
+			if (Accepts(Entry))
+			{
+				const float Score = ScoreEntry(Entry);
+				if (Score > 0.0f)
+				{
+					Scored.Emplace(Id, Score);
+				}
+			}
+		}
+	}
+	else
+	{
+		TArray<uint64> QueryTrigrams;
+		AppendTrigrams(Needle, QueryTrigrams);
+		SortUnique(QueryTrigrams);
+
+		if (Mode == EMCPAssetMatchMode::Fuzzy)
+		{
+			// Gather candidates from the rarer posting lists only: a trigram shared by a
+			// large part of the project ("_ma", "ial") adds work but hardly narrows the
+			// ranking. The rarest list is always used so a common-only query still hits.
+			constexpr int32 MaxFuzzyPostingLength = 8192;
+			TArray<const TArray<int32>*> Lists;
+			for (uint64 Trigram : QueryTrigrams)
+			{
+				if (const TArray<int32>* Posting = Data.Postings.Find(Trigram))
+				{
+					Lists.Add(Posting);
+				}
+			}
+			Lists.Sort([](const TArray<int32>& A, const TArray<int32>& B) { return A.Num() < B.Num(); });
+
+			TMap<int32, int32> Hits;
+			int32 UsedLists = 0;
+			for (const TArray<int32>* Posting : Lists)
+			{
+				if (UsedLists > 0 && Posting->Num() > MaxFuzzyPostingLength)
+				{
+					break;
+				}
+				++UsedLists;
+				for (int32 Id : *Posting)
+				{
+					++Hits.FindOrAdd(Id);
+				}
+			}
+
+			// Jaccard overlap between the query and the name's own trigrams, so the score
+			// stays within [0, 1] whatever the package path adds; literal hits get a bonus.
+			const int32 MinHits = FMath::Max(1, UsedLists / 3);
+			TArray<uint64> NameTrigrams;
+			for (const TPair<int32, int32>& Hit : Hits)
+			{
+				const FEntry& Entry = Data.Entries[Hit.Key];
+				if (Hit.Value < MinHits || !Accepts(Entry))
+				{
+					continue;
+				}
+				NameTrigrams.Reset();
+				AppendTrigrams(Entry.LowerName, NameTrigrams);
+				SortUnique(NameTrigrams);
+				int32 Shared = 0;
+				for (uint64 Trigram : NameTrigrams)
+				{
+					Shared += Algo::BinarySearch(QueryTrigrams, Trigram) != INDEX_NONE ? 1 : 0;
+				}
+				const float Overlap = Shared > 0
+					? static_cast<float>(Shared) / (QueryTrigrams.Num() + NameTrigrams.Num() - Shared) : 0.0f;
+				const float Score = FMath::Max(Overlap * 0.7f, ScoreEntry(Entry));
+				if (Score > 0.0f)
+				{
+					Scored.Emplace(Hit.Key, Score);
+				}
+			}
+		}
+		else
+		{
+			// Every query trigram must occur: intersect posting lists, smallest first.
+			TArray<const TArray<int32>*> Lists;
+			for (uint64 Trigram : QueryTrigrams)
+			{
+				const TArray<int32>* Posting = Data.Postings.Find(Trigram);
+				if (!Posting)
+				{
+					return TArray<FMCPAssetMatch>();
+				}
+				Lists.Add(Posting);
+			}
+			Lists.Sort([](const TArray<int32>& A, const TArray<int32>& B) { return A.Num() < B.Num(); });
+
+			TArray<int32> Candidates = *Lists[0];
+			for (int32 ListIndex = 1; ListIndex < Lists.Num() && Candidates.Num() > 0; ++ListIndex)
+			{
+				const TArray<int32>& Other = *Lists[ListIndex];
+				Candidates.RemoveAll([&Other](int32 Id) { return Algo::BinarySearch(Other, Id) == INDEX_NONE; });
+			}
+
+			for (int32 Id : Candidates)
+			{
+				const FEntry& Entry = Data.Entries[Id];
+				if (Accepts(Entry))
+				{
+					const float Score = ScoreEntry(Entry);
+					if (Score > 0.0f)
+					{
+						Scored.Emplace(Id, Score);
+					}
+				}
+			}
+		}
+	}
+
+	Scored.Sort([this](const TPair<int32, float>& A, const TPair<int32, float>& B)
+	{
+		if (A.Value != B.Value)
+		{
+			return A.Value > B.Value;
+		}
+		return Data.Entries[A.Key].LowerName < Data.Entries[B.Key].LowerName;
+	});
+	if (Limit > 0 && Scored.Num() > Limit)
+	{
+		Scored.SetNum(Limit);
+	}
+
+	TArray<FMCPAssetMatch> Matches;
+	Matches.Reserve(Scored.Num());
+	for (const TPair<int32, float>& Hit : Scored)
+	{
+		const FEntry& Entry = Data.Entries[Hit.Key];
+		FMCPAssetMatch& Match = Matches.AddDefaulted_GetRef();
+		Match.ObjectPath = Entry.ObjectPath;
+		Match.AssetName = Entry.AssetName;
+		Match.PackageName = Entry.PackageName;
+		Match.ClassName = Entry.ClassName;
+		Match.Score = Hit.Value;
+	}
+	return Matches;
+}
@@ -0,0 +1,408 @@
+#include "MCPBlueprintExporter.h"
+#include "MCPBlueprintNodeIndex.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_Variable.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UObjectGlobals.h"
+
+FMCPBlueprintExporter& FMCPBlueprintExporter::Get()
+{
+	static FMCPBlueprintExporter Instance;
+	return Instance;
+}
+
+void FMCPBlueprintExporter::Start()
+{
+	if (bStarted)
+	{
+		return;
+	}
+	bStarted = true;
+
+	ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FMCPBlueprintExporter::OnObjectModified);
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPBlueprintExporter::OnObjectPropertyChanged);
+}
+
+void FMCPBlueprintExporter::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+	bStarted = false;
+
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	for (TPair<FObjectKey, FCacheEntry>& Pair : Cache)
+	{
+		if (UBlueprint* Blueprint = Pair.Value.Blueprint.Get())
+		{
+			Blueprint->OnCompiled().Remove(Pair.Value.CompiledHandle);
+		}
+	}
+	Cache.Empty();
+}
+
+// ---------------------------------------------------------------------------
+// Invalidation
+// ---------------------------------------------------------------------------
+
+/** Blueprint that owns Object: a graph, node or SCS node lives under the blueprint, component templates under its generated class. */
+static UBlueprint* FindOwningBlueprint(UObject* Object)
+{
+	for (UObject* Outer = Object; Outer; Outer = Outer->GetOuter())
+	{
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(Outer))
+		{
+			return Blueprint;
+		}
+		if (UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(Outer))
+		{
+			return UBlueprint::GetBlueprintFromClass(GeneratedClass);
+		}
+	}
+	return nullptr;
+}
+
+void FMCPBlueprintExporter::MarkDirty(UObject* Object)
+{
+	// Called for every Modify() in the editor: stay cheap when nothing is cached
+	if (Cache.Num() == 0 || !Object)
+	{
+		return;
+	}
+	if (UBlueprint* Blueprint = FindOwningBlueprint(Object))
+	{
+		if (FCacheEntry* Entry = Cache.Find(FObjectKey(Blueprint)))
+		{
+			Entry->bDirty = true;
+		}
+	}
+}
+
+void FMCPBlueprintExporter::OnObjectModified(UObject* Object)
+{
+	MarkDirty(Object);
+}
+
+void FMCPBlueprintExporter::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	MarkDirty(Object);
+}
+
+void FMCPBlueprintExporter::OnBlueprintCompiled(UBlueprint* Blueprint)
+{
+	// Compiling reconstructs nodes, which can change pins without a Modify()
+	MarkDirty(Blueprint);
+}
+
+// ---------------------------------------------------------------------------
+// Export
+// ---------------------------------------------------------------------------
+
+static FString FormatPinType(const FEdGraphPinType& PinType)
+{
+	FString Type = PinType.PinCategory.ToString();
+	if (const UObject* SubCategoryObject = PinType.PinSubCategoryObject.Get())
+	{
+		Type += TEXT(":") + SubCategoryObject->GetName();
+	}
+	else if (!PinType.PinSubCategory.IsNone())
+	{
+		Type += TEXT(":") + PinType.PinSubCategory.ToString();
+	}
+
+	if (PinType.IsArray())
+	{
+		Type += TEXT("[]");
+	}
+	else if (PinType.IsSet())
+	{
+		Type += TEXT("{}");
+	}
+	else if (PinType.IsMap())
+	{
+		FString ValueType = PinType.PinValueType.TerminalCategory.ToString();
+		if (const UObject* ValueObject = PinType.PinValueType.TerminalSubCategoryObject.Get())
+		{
+			ValueType += TEXT(":") + ValueObject->GetName();
+		}
+		Type += TEXT("{") + ValueType + TEXT("}");
+	}
+	if (PinType.bIsReference)
+	{
+		Type += TEXT("&");
+	}
+	return Type;
+}
+
+static FString GetNodeMember(const UEdGraphNode* Node)
+{
+	if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+	{
+		const UClass* Parent = CallNode->FunctionReference.GetMemberParentClass();
+		const FString Name = CallNode->FunctionReference.GetMemberName().ToString();
+		return Parent && !CallNode->FunctionReference.IsSelfContext() ? Parent->GetName() + TEXT(".") + Name : Name;
+	}
+	if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+	{
+		return (EventNode->CustomFunctionName.IsNone() ? EventNode->EventReference.GetMemberName() : EventNode->CustomFunctionName).ToString();
+	}
+	if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+	{
+		return VariableNode->GetVarName().ToString();
+	}
+	return FString();
+}
+
+static TSharedPtr<FJsonObject> ExportGraph(UBlueprint* Blueprint, UEdGraph* Graph)
+{
+	TArray<UEdGraphNode*> Nodes;
+	for (UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (Node)
+		{
+			Nodes.Add(Node);
+		}
+	}
+	Nodes.Sort([](const UEdGraphNode& A, const UEdGraphNode& B) { return A.NodeGuid < B.NodeGuid; });
+
+	TArray<TSharedPtr<FJsonValue>> NodesArray;
+	TArray<TArray<FString, TFixedAllocator<4>>> Links;
+	for (UEdGraphNode* Node : Nodes)
+	{
+		const FString NodeId = Node->NodeGuid.ToString();
+
+		TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+		NodeObj->SetStringField(TEXT("id"), NodeId);
+		NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+		NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+		const FString Member = GetNodeMember(Node);
+		if (!Member.IsEmpty())
+		{
+			NodeObj->SetStringField(TEXT("member"), Member);
+		}
+		if (!Node->NodeComment.IsEmpty())
+		{
+			NodeObj->SetStringField(TEXT("comment"), Node->NodeComment);
+		}
+		NodeObj->SetNumberField(TEXT("x"), Node->NodePosX);
+		NodeObj->SetNumberField(TEXT("y"), Node->NodePosY);
+
+		// Pins as [name, "i"|"o", type, default?] to keep the export small
+		TArray<TSharedPtr<FJsonValue>> PinsArray;
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin || Pin->bHidden)
+			{
+				continue;
+			}
+			TArray<TSharedPtr<FJsonValue>> PinTuple;
+			PinTuple.Add(MakeShared<FJsonValueString>(Pin->PinName.ToString()));
+			PinTuple.Add(MakeShared<FJsonValueString>(Pin->Direction == EGPD_Input ? TEXT("i") : TEXT("o")));
+			PinTuple.Add(MakeShared<FJsonValueString>(FormatPinType(Pin->PinType)));
+			const FString Default = Pin->DefaultObject ? Pin->DefaultObject->GetPathName()
+				: !Pin->DefaultTextValue.IsEmpty() ? Pin->DefaultTextValue.ToString() : Pin->DefaultValue;
+			if (!Default.IsEmpty() && Pin->LinkedTo.Num() == 0)
+			{
+				PinTuple.Add(MakeShared<FJsonValueString>(Default));
+			}
+			PinsArray.Add(MakeShared<FJsonValueArray>(PinTuple));
+
+			if (Pin->Direction == EGPD_Output)
+			{
+				for (const UEdGraphPin* Linked : Pin->LinkedTo)
+				{
+					if (Linked && Linked->GetOwningNodeUnchecked())
+					{
+						Links.Add({ NodeId, Pin->PinName.ToString(), Linked->GetOwningNode()->NodeGuid.ToString(), Linked->PinName.ToString() });
+					}
+				}
+			}
+		}
+		NodeObj->SetArrayField(TEXT("pins"), PinsArray);
+		NodesArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+	}
+
+	// Links as [from_node, from_pin, to_node, to_pin]
+	Links.Sort([](const TArray<FString, TFixedAllocator<4>>& A, const TArray<FString, TFixedAllocator<4>>& B)
+	{
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const int32 Order = A[i].Compare(B[i], ESearchCase::CaseSensitive);
+			if (Order != 0)
+			{
+				return Order < 0;
+			}
+		}
+		return false;
+	});
+	TArray<TSharedPtr<FJsonValue>> LinksArray;
+	for (const TArray<FString, TFixedAllocator<4>>& Link : Links)
+	{
+		TArray<TSharedPtr<FJsonValue>> LinkTuple;
+		for (const FString& Part : Link)
+		{
+			LinkTuple.Add(MakeShared<FJsonValueString>(Part));
+		}
+		LinksArray.Add(MakeShared<FJsonValueArray>(LinkTuple));
+	}
+
+	TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+	GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+	GraphObj->SetStringField(TEXT("type"), FMCPBlueprintNodeIndex::GetGraphType(Blueprint, Graph));
+	GraphObj->SetArrayField(TEXT("nodes"), NodesArray);
+	GraphObj->SetArrayField(TEXT("links"), LinksArray);
+	return GraphObj;
+}
+
+static void ExportSCSNode(const USCS_Node* Node, const FString& ParentName, TArray<TSharedPtr<FJsonValue>>& OutComponents)
+{
+	TSharedPtr<FJsonObject> CompObj = MakeShared<FJsonObject>();
+	CompObj->SetStringField(TEXT("name"), Node->GetVariableName().ToString());
+	CompObj->SetStringField(TEXT("class"), Node->ComponentClass ? Node->ComponentClass->GetName() : TEXT("None"));
+	if (!ParentName.IsEmpty())
+	{
+		CompObj->SetStringField(TEXT("parent"), ParentName);
+	}
+	else if (!Node->ParentComponentOrVariableName.IsNone())
+	{
+		// Attached to a component inherited from the parent class
+		CompObj->SetStringField(TEXT("parent"), Node->ParentComponentOrVariableName.ToString());
+	}
+	OutComponents.Add(MakeShared<FJsonValueObject>(CompObj));
+
+	const FString Name = Node->GetVariableName().ToString();
+	for (const USCS_Node* Child : Node->GetChildNodes())
+	{
+		if (Child)
+		{
+			ExportSCSNode(Child, Name, OutComponents);
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FMCPBlueprintExporter::BuildExport(UBlueprint* Blueprint)
+{
+	TSharedPtr<FJsonObject> Export = MakeShared<FJsonObject>();
+	Export->SetStringField(TEXT("name"), Blueprint->GetName());
+	Export->SetStringField(TEXT("path"), Blueprint->GetPathName());
+	Export->SetStringField(TEXT("parent_class"), Blueprint->ParentClass ? Blueprint->ParentClass->GetPathName() : TEXT("None"));
+
+	TArray<TSharedPtr<FJsonValue>> Variables;
+	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+	{
+		TSharedPtr<FJsonObject> VarObj = MakeShared<FJsonObject>();
+		VarObj->SetStringField(TEXT("name"), Var.VarName.ToString());
+		VarObj->SetStringField(TEXT("type"), FormatPinType(Var.VarType));
+		if ((Var.PropertyFlags & CPF_Edit) != 0)
+		{
+			VarObj->SetBoolField(TEXT("editable"), true);
+		}
+		if ((Var.PropertyFlags & CPF_Net) != 0)
+		{
+			VarObj->SetBoolField(TEXT("replicated"), true);
+		}
+		if (!Var.DefaultValue.IsEmpty())
+		{
+			VarObj->SetStringField(TEXT("default"), Var.DefaultValue);
+		}
+		Variables.Add(MakeShared<FJsonValueObject>(VarObj));
+	}
+	Export->SetArrayField(TEXT("variables"), Variables);
+
+	TArray<TSharedPtr<FJsonValue>> Components;
+	if (Blueprint->SimpleConstructionScript)
+	{
+		for (const USCS_Node* Root : Blueprint->SimpleConstructionScript->GetRootNodes())
+		{
+			if (Root)
+			{
+				ExportSCSNode(Root, FString(), Components);
+			}
+		}
+	}
+	Export->SetArrayField(TEXT("components"), Components);
+
+	TArray<UEdGraph*> Graphs;
+	FMCPBlueprintNodeIndex::GetAllGraphs(Blueprint, Graphs);
+	Graphs.Sort([Blueprint](const UEdGraph& A, const UEdGraph& B)
+	{
+		const FString TypeA = FMCPBlueprintNodeIndex::GetGraphType(Blueprint, &A);
+		const FString TypeB = FMCPBlueprintNodeIndex::GetGraphType(Blueprint, &B);
+		return TypeA != TypeB ? TypeA < TypeB : A.GetPathName() < B.GetPathName();
+	});
+
+	TArray<TSharedPtr<FJsonValue>> GraphsArray;
+	for (UEdGraph* Graph : Graphs)
+	{
+		GraphsArray.Add(MakeShared<FJsonValueObject>(ExportGraph(Blueprint, Graph)));
+	}
+	Export->SetArrayField(TEXT("graphs"), GraphsArray);
+	return Export;
+}
+
+FString FMCPBlueprintExporter::HashExport(const TSharedPtr<FJsonObject>& Export)
+{
+	FString Serialized;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Serialized);
+	FJsonSerializer::Serialize(Export.ToSharedRef(), Writer);
+
+	const FTCHARToUTF8 Utf8(*Serialized);
+	uint8 Digest[FSHA1::DigestSize];
+	FSHA1::HashBuffer(Utf8.Get(), Utf8.Length(), Digest);
+	return BytesToHex(Digest, FSHA1::DigestSize).ToLower();
+}
+
+FString FMCPBlueprintExporter::GetCleanHash(UBlueprint* Blueprint) const
+{
+	const FCacheEntry* Entry = Cache.Find(FObjectKey(Blueprint));
+	return Entry && !Entry->bDirty ? Entry->Hash : FString();
+}
+
+TSharedPtr<FJsonObject> FMCPBlueprintExporter::Export(UBlueprint* Blueprint, FString& OutHash, bool& bOutFromCache)
+{
+	const FObjectKey Key(Blueprint);
+	FCacheEntry* Entry = Cache.Find(Key);
+	if (Entry && !Entry->bDirty)
+	{
+		OutHash = Entry->Hash;
+		bOutFromCache = true;
+		return Entry->Export;
+	}
+
+	if (!Entry)
+	{
+		// Forget blueprints that have been unloaded since they were exported
+		for (auto It = Cache.CreateIterator(); It; ++It)
+		{
+			if (!It.Value().Blueprint.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		Entry = &Cache.Add(Key);
+		Entry->Blueprint = Blueprint;
+		Entry->CompiledHandle = Blueprint->OnCompiled().AddRaw(this, &FMCPBlueprintExporter::OnBlueprintCompiled);
+	}
+
+	Entry->Export = BuildExport(Blueprint);
+	Entry->Hash = HashExport(Entry->Export);
+	Entry->bDirty = false;
+
+	OutHash = Entry->Hash;
+	bOutFromCache = false;
+	return Entry->Export;
+}
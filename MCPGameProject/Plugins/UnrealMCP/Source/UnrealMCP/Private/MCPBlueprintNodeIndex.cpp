@@ -0,0 +1,222 @@
+#include "MCPBlueprintNodeIndex.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+
+FMCPBlueprintNodeIndex& FMCPBlueprintNodeIndex::Get()
+{
+	static FMCPBlueprintNodeIndex Instance;
+	return Instance;
+}
+
+void FMCPBlueprintNodeIndex::Stop()
+{
+	for (TPair<FObjectKey, FBlueprintEntry>& Pair : Entries)
+	{
+		Unbind(Pair.Value);
+	}
+	Entries.Empty();
+}
+
+void FMCPBlueprintNodeIndex::Invalidate(UBlueprint* Blueprint)
+{
+	if (FBlueprintEntry* Entry = Entries.Find(FObjectKey(Blueprint)))
+	{
+		Entry->bDirty = true;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Graphs
+// ---------------------------------------------------------------------------
+
+void FMCPBlueprintNodeIndex::GetAllGraphs(UBlueprint* Blueprint, TArray<UEdGraph*>& OutGraphs)
+{
+	OutGraphs.Reset();
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	// UBlueprint::GetAllGraphs also walks collapsed subgraphs, but orders function graphs first
+	TArray<UEdGraph*> AllGraphs;
+	Blueprint->GetAllGraphs(AllGraphs);
+
+	OutGraphs.Reserve(AllGraphs.Num());
+	for (UEdGraph* Graph : Blueprint->UbergraphPages)
+	{
+		if (Graph)
+		{
+			OutGraphs.Add(Graph);
+		}
+	}
+	for (UEdGraph* Graph : AllGraphs)
+	{
+		if (Graph && !Blueprint->UbergraphPages.Contains(Graph))
+		{
+			OutGraphs.Add(Graph);
+		}
+	}
+}
+
+FString FMCPBlueprintNodeIndex::GetGraphType(UBlueprint* Blueprint, const UEdGraph* Graph)
+{
+	if (Blueprint->UbergraphPages.Contains(Graph))
+	{
+		return TEXT("event");
+	}
+	if (Blueprint->FunctionGraphs.Contains(Graph))
+	{
+		return TEXT("function");
+	}
+	if (Blueprint->MacroGraphs.Contains(Graph))
+	{
+		return TEXT("macro");
+	}
+	if (Blueprint->DelegateSignatureGraphs.Contains(Graph))
+	{
+		return TEXT("delegate");
+	}
+	return TEXT("subgraph");
+}
+
+// ---------------------------------------------------------------------------
+// Index
+// ---------------------------------------------------------------------------
+
+FMCPBlueprintNodeIndex::FBlueprintEntry& FMCPBlueprintNodeIndex::GetEntry(UBlueprint* Blueprint)
+{
+	const FObjectKey Key(Blueprint);
+	FBlueprintEntry* Entry = Entries.Find(Key);
+	if (!Entry)
+	{
+		// Forget entries of blueprints that have been unloaded since they were indexed
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (!It.Value().Blueprint.IsValid())
+			{
+				Unbind(It.Value());
+				It.RemoveCurrent();
+			}
+		}
+
+		Entry = &Entries.Add(Key);
+		Entry->Blueprint = Blueprint;
+		Entry->ChangedHandle = Blueprint->OnChanged().AddRaw(this, &FMCPBlueprintNodeIndex::OnBlueprintChanged);
+	}
+	return *Entry;
+}
+
+void FMCPBlueprintNodeIndex::Unbind(FBlueprintEntry& Entry)
+{
+	for (TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>& GraphHandle : Entry.GraphHandles)
+	{
+		if (UEdGraph* Graph = GraphHandle.Key.Get())
+		{
+			Graph->RemoveOnGraphChangedHandler(GraphHandle.Value);
+		}
+	}
+	Entry.GraphHandles.Reset();
+
+	if (UBlueprint* Blueprint = Entry.Blueprint.Get())
+	{
+		Blueprint->OnChanged().Remove(Entry.ChangedHandle);
+	}
+	Entry.ChangedHandle.Reset();
+}
+
+void FMCPBlueprintNodeIndex::Rebuild(FBlueprintEntry& Entry)
+{
+	UBlueprint* Blueprint = Entry.Blueprint.Get();
+
+	for (TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>& GraphHandle : Entry.GraphHandles)
+	{
+		if (UEdGraph* Graph = GraphHandle.Key.Get())
+		{
+			Graph->RemoveOnGraphChangedHandler(GraphHandle.Value);
+		}
+	}
+	Entry.GraphHandles.Reset();
+	Entry.Nodes.Reset();
+
+	TArray<UEdGraph*> Graphs;
+	GetAllGraphs(Blueprint, Graphs);
+
+	const FObjectKey BlueprintKey(Blueprint);
+	for (UEdGraph* Graph : Graphs)
+	{
+		const FDelegateHandle Handle = Graph->AddOnGraphChangedHandler(
+			FOnGraphChanged::FDelegate::CreateRaw(this, &FMCPBlueprintNodeIndex::OnGraphChanged, BlueprintKey));
+		Entry.GraphHandles.Emplace(Graph, Handle);
+
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node)
+			{
+				Entry.Nodes.Add(Node->NodeGuid, Node);
+			}
+		}
+	}
+	Entry.bDirty = false;
+}
+
+void FMCPBlueprintNodeIndex::OnGraphChanged(const FEdGraphEditAction& Action, FObjectKey BlueprintKey)
+{
+	if (FBlueprintEntry* Entry = Entries.Find(BlueprintKey))
+	{
+		Entry->bDirty = true;
+	}
+}
+
+void FMCPBlueprintNodeIndex::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	Invalidate(Blueprint);
+}
+
+// ---------------------------------------------------------------------------
+// Lookup
+// ---------------------------------------------------------------------------
+
+UEdGraphNode* FMCPBlueprintNodeIndex::FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid)
+{
+	if (!Blueprint || !NodeGuid.IsValid())
+	{
+		return nullptr;
+	}
+
+	FBlueprintEntry& Entry = GetEntry(Blueprint);
+	bool bRebuilt = false;
+	if (Entry.bDirty)
+	{
+		Rebuild(Entry);
+		bRebuilt = true;
+	}
+
+	for (;;)
+	{
+		if (const TWeakObjectPtr<UEdGraphNode>* Found = Entry.Nodes.Find(NodeGuid))
+		{
+			UEdGraphNode* Node = Found->Get();
+			if (Node && Node->NodeGuid == NodeGuid && Node->GetGraph())
+			{
+				return Node;
+			}
+		}
+		if (bRebuilt)
+		{
+			return nullptr;
+		}
+		Rebuild(Entry);
+		bRebuilt = true;
+	}
+}
+
+UEdGraphNode* FMCPBlueprintNodeIndex::FindNode(UBlueprint* Blueprint, const FString& NodeId)
+{
+	FGuid NodeGuid;
+	if (!FGuid::Parse(NodeId, NodeGuid))
+	{
+		return nullptr;
+	}
+	return FindNode(Blueprint, NodeGuid);
+}
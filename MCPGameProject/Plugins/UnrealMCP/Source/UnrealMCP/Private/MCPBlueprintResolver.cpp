@@ -0,0 +1,260 @@
+#include "MCPBlueprintResolver.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectIterator.h"
+#if ENGINE_MAJOR_VERSION >= 5
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#else
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#endif
+
+static IAssetRegistry& GetResolverRegistry()
+{
+	return FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+}
+
+static FString GetAssetObjectPath(const FAssetData& AssetData)
+{
+#if ENGINE_MAJOR_VERSION >= 5
+	return AssetData.GetObjectPathString();
+#else
+	return AssetData.ObjectPath.ToString();
+#endif
+}
+
+static FName GetAssetClassName(const FAssetData& AssetData)
+{
+#if ENGINE_MAJOR_VERSION >= 5
+	return AssetData.AssetClassPath.GetAssetName();
+#else
+	return AssetData.AssetClass;
+#endif
+}
+
+FMCPBlueprintResolver& FMCPBlueprintResolver::Get()
+{
+	static FMCPBlueprintResolver Instance;
+	return Instance;
+}
+
+void FMCPBlueprintResolver::Start()
+{
+	if (bStarted)
+	{
+		return;
+	}
+	bStarted = true;
+
+	IAssetRegistry& Registry = GetResolverRegistry();
+	AssetAddedHandle = Registry.OnAssetAdded().AddRaw(this, &FMCPBlueprintResolver::OnAssetAdded);
+	AssetRemovedHandle = Registry.OnAssetRemoved().AddRaw(this, &FMCPBlueprintResolver::OnAssetRemoved);
+	AssetRenamedHandle = Registry.OnAssetRenamed().AddRaw(this, &FMCPBlueprintResolver::OnAssetRenamed);
+}
+
+void FMCPBlueprintResolver::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+	bStarted = false;
+
+	if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+	{
+		IAssetRegistry& Registry = GetResolverRegistry();
+		Registry.OnAssetAdded().Remove(AssetAddedHandle);
+		Registry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		Registry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+	ByName.Empty();
+	Loaded.Empty();
+	bIndexBuilt = false;
+}
+
+// ---------------------------------------------------------------------------
+// Index
+// ---------------------------------------------------------------------------
+
+void FMCPBlueprintResolver::EnsureIndex()
+{
+	IAssetRegistry& Registry = GetResolverRegistry();
+	if (bIndexBuilt && !(bIndexPartial && !Registry.IsLoadingAssets()))
+	{
+		return;
+	}
+
+	BlueprintClassNames.Reset();
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->IsChildOf(UBlueprint::StaticClass()))
+		{
+			BlueprintClassNames.Add(It->GetFName());
+		}
+	}
+
+	FARFilter Filter;
+#if ENGINE_MAJOR_VERSION >= 5
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+#else
+	Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
+#endif
+	Filter.bRecursiveClasses = true;
+
+	TArray<FAssetData> Assets;
+	Registry.GetAssets(Filter, Assets);
+
+	ByName.Reset();
+	for (const FAssetData& AssetData : Assets)
+	{
+		AddAsset(AssetData);
+	}
+	bIndexBuilt = true;
+	bIndexPartial = Registry.IsLoadingAssets();
+}
+
+bool FMCPBlueprintResolver::IsBlueprintAsset(const FAssetData& AssetData) const
+{
+	return BlueprintClassNames.Contains(GetAssetClassName(AssetData));
+}
+
+void FMCPBlueprintResolver::AddAsset(const FAssetData& AssetData)
+{
+	ByName.FindOrAdd(AssetData.AssetName).AddUnique(GetAssetObjectPath(AssetData));
+}
+
+void FMCPBlueprintResolver::RemoveObjectPath(const FString& ObjectPath)
+{
+	Loaded.Remove(ObjectPath);
+
+	const FName AssetName(*FPackageName::ObjectPathToObjectName(ObjectPath));
+	if (TArray<FString>* Paths = ByName.Find(AssetName))
+	{
+		Paths->Remove(ObjectPath);
+		if (Paths->Num() == 0)
+		{
+			ByName.Remove(AssetName);
+		}
+	}
+}
+
+void FMCPBlueprintResolver::OnAssetAdded(const FAssetData& AssetData)
+{
+	// Before the first lookup there is nothing to maintain; EnsureIndex reads the registry.
+	if (bIndexBuilt && IsBlueprintAsset(AssetData))
+	{
+		AddAsset(AssetData);
+	}
+}
+
+void FMCPBlueprintResolver::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (bIndexBuilt)
+	{
+		RemoveObjectPath(GetAssetObjectPath(AssetData));
+	}
+}
+
+void FMCPBlueprintResolver::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (bIndexBuilt)
+	{
+		RemoveObjectPath(OldObjectPath);
+		OnAssetAdded(AssetData);
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Lookup
+// ---------------------------------------------------------------------------
+
+UBlueprint* FMCPBlueprintResolver::LoadCached(const FString& ObjectPath)
+{
+	if (const TWeakObjectPtr<UBlueprint>* Cached = Loaded.Find(ObjectPath))
+	{
+		if (UBlueprint* Blueprint = Cached->Get())
+		{
+			return Blueprint;
+		}
+	}
+
+	UBlueprint* Blueprint = FindObject<UBlueprint>(nullptr, *ObjectPath);
+	if (!Blueprint && FPackageName::DoesPackageExist(FPackageName::ObjectPathToPackageName(ObjectPath)))
+	{
+		Blueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath);
+	}
+	if (Blueprint)
+	{
+		Loaded.Add(ObjectPath, Blueprint);
+	}
+	return Blueprint;
+}
+
+TArray<FString> FMCPBlueprintResolver::FindCandidates(const FString& Name)
+{
+	EnsureIndex();
+	const TArray<FString>* Paths = ByName.Find(FName(*Name));
+	return Paths ? *Paths : TArray<FString>();
+}
+
+UBlueprint* FMCPBlueprintResolver::Resolve(const FString& NameOrPath, const FString& DefaultFolder)
+{
+	LastError.Reset();
+	if (NameOrPath.IsEmpty())
+	{
+		LastError = TEXT("Blueprint name is empty");
+		return nullptr;
+	}
+
+	// Explicit package or object path: "/Game/UI/WBP_Menu" or "/Game/UI/WBP_Menu.WBP_Menu".
+	if (NameOrPath.StartsWith(TEXT("/")))
+	{
+		FString ObjectPath = NameOrPath;
+		if (!ObjectPath.Contains(TEXT(".")))
+		{
+			ObjectPath = ObjectPath + TEXT(".") + FPackageName::GetShortName(ObjectPath);
+		}
+		UBlueprint* Blueprint = LoadCached(ObjectPath);
+		if (!Blueprint)
+		{
+			LastError = FString::Printf(TEXT("Blueprint not found: %s"), *NameOrPath);
+		}
+		return Blueprint;
+	}
+
+	const TArray<FString> Candidates = FindCandidates(NameOrPath);
+	FString Folder = DefaultFolder;
+	Folder.RemoveFromEnd(TEXT("/"));
+	const FString LegacyPath = FString::Printf(TEXT("%s/%s.%s"), *Folder, *NameOrPath, *NameOrPath);
+
+	if (Candidates.Num() == 0)
+	{
+		// Not in the registry yet (e.g. created this frame): try the historical default location.
+		UBlueprint* Blueprint = LoadCached(LegacyPath);
+		if (!Blueprint)
+		{
+			LastError = FString::Printf(TEXT("Blueprint not found: %s"), *NameOrPath);
+		}
+		return Blueprint;
+	}
+
+	if (Candidates.Num() == 1)
+	{
+		UBlueprint* Blueprint = LoadCached(Candidates[0]);
+		if (!Blueprint)
+		{
+			LastError = FString::Printf(TEXT("Blueprint '%s' is registered at %s but failed to load"), *NameOrPath, *Candidates[0]);
+		}
+		return Blueprint;
+	}
+
+	if (Candidates.Contains(LegacyPath))
+	{
+		return LoadCached(LegacyPath);
+	}
+
+	LastError = FString::Printf(TEXT("Blueprint name '%s' is ambiguous, pass a full path instead: %s"),
+		*NameOrPath, *FString::Join(Candidates, TEXT(", ")));
+	return nullptr;
+}
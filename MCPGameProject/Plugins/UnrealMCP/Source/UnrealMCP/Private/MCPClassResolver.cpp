@@ -0,0 +1,273 @@
+#include "MCPClassResolver.h"
+#include "MCPBlueprintResolver.h"
+#include "Engine/Blueprint.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectGlobals.h"
+
+static bool IsTransientClassName(const FString& Name)
+{
+	return Name.StartsWith(TEXT("SKEL_"))
+		|| Name.StartsWith(TEXT("REINST_"))
+		|| Name.StartsWith(TEXT("TRASHCLASS_"))
+		|| Name.StartsWith(TEXT("HOTRELOADED_"))
+		|| Name.StartsWith(TEXT("PLACEHOLDER-CLASS"));
+}
+
+static bool IsUsableClass(const UClass* Class, const UClass* RequiredBase)
+{
+	return Class
+		&& !Class->HasAnyClassFlags(CLASS_NewerVersionExists)
+		&& (!RequiredBase || Class->IsChildOf(RequiredBase));
+}
+
+FMCPClassResolver& FMCPClassResolver::Get()
+{
+	static FMCPClassResolver Instance;
+	return Instance;
+}
+
+void FMCPClassResolver::Start()
+{
+	if (bStarted)
+	{
+		return;
+	}
+	bStarted = true;
+
+	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FMCPClassResolver::OnModulesChanged);
+#if ENGINE_MAJOR_VERSION >= 5
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		Invalidate();
+	});
+#endif
+}
+
+void FMCPClassResolver::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+	bStarted = false;
+
+	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+#if ENGINE_MAJOR_VERSION >= 5
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#endif
+	ByName.Empty();
+	bIndexBuilt = false;
+}
+
+void FMCPClassResolver::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	if (Reason == EModuleChangeReason::ModuleLoaded)
+	{
+		Invalidate();
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Index
+// ---------------------------------------------------------------------------
+
+void FMCPClassResolver::EnsureIndex()
+{
+	if (bIndexBuilt)
+	{
+		return;
+	}
+
+	ByName.Reset();
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		AddClass(*It);
+	}
+	bIndexBuilt = true;
+}
+
+void FMCPClassResolver::AddKey(const FString& Key, UClass* Class, uint8 Rank)
+{
+	TArray<FEntry>& Entries = ByName.FindOrAdd(FName(*Key));
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Class.Get() == Class)
+		{
+			Entry.Rank = FMath::Min(Entry.Rank, Rank);
+			return;
+		}
+	}
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Class = Class;
+	Entry.Rank = Rank;
+}
+
+void FMCPClassResolver::AddClass(UClass* Class)
+{
+	if (!IsUsableClass(Class, nullptr))
+	{
+		return;
+	}
+
+	const FString Name = Class->GetName();
+	if (IsTransientClassName(Name))
+	{
+		return;
+	}
+
+	if (!Class->HasAnyClassFlags(CLASS_Native))
+	{
+		// Blueprint generated class: "BP_Door_C" and "BP_Door".
+		AddKey(Name, Class, 0);
+		if (Name.EndsWith(TEXT("_C")))
+		{
+			AddKey(Name.LeftChop(2), Class, 0);
+		}
+		return;
+	}
+
+	const FString Prefix = Class->GetPrefixCPP();
+	AddKey(Name, Class, 0);
+	AddKey(Prefix + Name, Class, 0);
+
+	static const FString ComponentSuffix(TEXT("Component"));
+	if (Name.Len() > ComponentSuffix.Len() && Name.EndsWith(ComponentSuffix))
+	{
+		const FString Stem = Name.LeftChop(ComponentSuffix.Len());
+		AddKey(Stem, Class, 1);
+		AddKey(Prefix + Stem, Class, 1);
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Lookup
+// ---------------------------------------------------------------------------
+
+UClass* FMCPClassResolver::ResolvePath(const FString& Path, UClass* RequiredBase)
+{
+	UClass* Class = FindObject<UClass>(nullptr, *Path);
+	if (!Class)
+	{
+		Class = LoadObject<UClass>(nullptr, *Path, nullptr, LOAD_NoWarn | LOAD_Quiet);
+	}
+	if (!Class)
+	{
+		// A blueprint asset path rather than its generated class.
+		if (UBlueprint* Blueprint = FMCPBlueprintResolver::Get().Resolve(Path))
+		{
+			Class = Blueprint->GeneratedClass;
+		}
+	}
+
+	if (!Class)
+	{
+		LastError = FString::Printf(TEXT("Class not found: %s"), *Path);
+		return nullptr;
+	}
+	if (!IsUsableClass(Class, RequiredBase))
+	{
+		LastError = FString::Printf(TEXT("Class '%s' is not a %s"), *Path, *RequiredBase->GetName());
+		return nullptr;
+	}
+	return Class;
+}
+
+UClass* FMCPClassResolver::ResolveBlueprintClass(const FString& Name, UClass* RequiredBase)
+{
+	// Blueprints created or saved since the index was built, or never loaded.
+	const FString AssetName = Name.EndsWith(TEXT("_C")) ? Name.LeftChop(2) : Name;
+	const int32 NumCandidates = FMCPBlueprintResolver::Get().FindCandidates(AssetName).Num();
+	if (NumCandidates == 0)
+	{
+		return nullptr;
+	}
+
+	UBlueprint* Blueprint = FMCPBlueprintResolver::Get().Resolve(AssetName);
+	if (!Blueprint)
+	{
+		LastError = FMCPBlueprintResolver::Get().GetLastError();
+		bLastAmbiguous = NumCandidates > 1;
+		return nullptr;
+	}
+
+	UClass* Class = Blueprint->GeneratedClass;
+	if (Class)
+	{
+		AddClass(Class);
+	}
+	return IsUsableClass(Class, RequiredBase) ? Class : nullptr;
+}
+
+UClass* FMCPClassResolver::Resolve(const FString& NameOrPath, UClass* RequiredBase)
+{
+	LastError.Reset();
+	bLastAmbiguous = false;
+
+	const FString Name = NameOrPath.TrimStartAndEnd();
+	if (Name.IsEmpty())
+	{
+		LastError = TEXT("Class name is empty");
+		return nullptr;
+	}
+	if (Name.StartsWith(TEXT("/")))
+	{
+		return ResolvePath(Name, RequiredBase);
+	}
+
+	EnsureIndex();
+
+	TArray<UClass*, TInlineAllocator<4>> Best;
+	uint8 BestRank = MAX_uint8;
+	if (const TArray<FEntry>* Entries = ByName.Find(FName(*Name)))
+	{
+		for (const FEntry& Entry : *Entries)
+		{
+			UClass* Class = Entry.Class.Get();
+			if (!IsUsableClass(Class, RequiredBase))
+			{
+				continue;
+			}
+			if (Entry.Rank < BestRank)
+			{
+				Best.Reset();
+				BestRank = Entry.Rank;
+			}
+			if (Entry.Rank == BestRank)
+			{
+				Best.AddUnique(Class);
+			}
+		}
+	}
+
+	if (Best.Num() == 1)
+	{
+		return Best[0];
+	}
+
+	if (Best.Num() > 1)
+	{
+		TArray<FString> Paths;
+		for (UClass* Class : Best)
+		{
+			Paths.Add(Class->GetPathName());
+		}
+		Paths.Sort();
+		LastError = FString::Printf(TEXT("Class name '%s' is ambiguous, pass a full path instead: %s"),
+			*Name, *FString::Join(Paths, TEXT(", ")));
+		bLastAmbiguous = true;
+		return nullptr;
+	}
+
+	if (UClass* Class = ResolveBlueprintClass(Name, RequiredBase))
+	{
+		return Class;
+	}
+
+	if (LastError.IsEmpty())
+	{
+		LastError = RequiredBase
+			? FString::Printf(TEXT("No %s class named '%s'"), *RequiredBase->GetName(), *Name)
+			: FString::Printf(TEXT("Class not found: %s"), *Name);
+	}
+	return nullptr;
+}
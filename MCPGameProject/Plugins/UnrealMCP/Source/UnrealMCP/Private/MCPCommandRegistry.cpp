@@ -10,6 +10,14 @@ void FMCPCommandRegistry::RegisterCommand(const FString& CommandName, FMCPComman
 		       *CommandName);
 	}
 	Commands.Add(CommandName, MoveTemp(Handler));
+	OffGameThreadChecks.Remove(CommandName);
+}
+
+void FMCPCommandRegistry::RegisterCommand(const FString& CommandName, FMCPCommandHandler Handler,
+                                          FMCPOffGameThreadCheck CanRunOffGameThread)
+{
+	RegisterCommand(CommandName, MoveTemp(Handler));
+	OffGameThreadChecks.Add(CommandName, MoveTemp(CanRunOffGameThread));
 }
 
 TSharedPtr<FJsonObject> FMCPCommandRegistry::ExecuteCommand(
@@ -29,6 +37,12 @@ bool FMCPCommandRegistry::HasCommand(const FString& CommandName) const
 	return Commands.Contains(CommandName);
 }
 
+bool FMCPCommandRegistry::CanExecuteOffGameThread(const FString& CommandName) const
+{
+	const FMCPOffGameThreadCheck* Check = OffGameThreadChecks.Find(CommandName);
+	return Check && (*Check)();
+}
+
 TArray<FString> FMCPCommandRegistry::GetRegisteredCommands() const
 {
 	TArray<FString> Keys;
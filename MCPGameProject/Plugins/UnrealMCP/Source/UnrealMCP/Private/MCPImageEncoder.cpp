@@ -0,0 +1,106 @@
+#include "MCPImageEncoder.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "ImageUtils.h"
+#include "Modules/ModuleManager.h"
+
+static const FName ImageWrapperModuleName(TEXT("ImageWrapper"));
+
+bool FMCPImageEncoder::ParseFormat(const FString& Name, EMCPImageFormat& OutFormat)
+{
+	if (Name.Equals(TEXT("png"), ESearchCase::IgnoreCase))
+	{
+		OutFormat = EMCPImageFormat::Png;
+		return true;
+	}
+	if (Name.Equals(TEXT("jpg"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("jpeg"), ESearchCase::IgnoreCase))
+	{
+		OutFormat = EMCPImageFormat::Jpeg;
+		return true;
+	}
+	return false;
+}
+
+const TCHAR* FMCPImageEncoder::GetExtension(EMCPImageFormat Format)
+{
+	return Format == EMCPImageFormat::Jpeg ? TEXT(".jpg") : TEXT(".png");
+}
+
+const TCHAR* FMCPImageEncoder::GetMimeType(EMCPImageFormat Format)
+{
+	return Format == EMCPImageFormat::Jpeg ? TEXT("image/jpeg") : TEXT("image/png");
+}
+
+FIntPoint FMCPImageEncoder::GetOutputSize(int32 Width, int32 Height, const FMCPImageEncodeOptions& Options)
+{
+	double Scale = 1.0;
+	if (Options.MaxWidth > 0 && Width > Options.MaxWidth)
+	{
+		Scale = FMath::Min(Scale, static_cast<double>(Options.MaxWidth) / Width);
+	}
+	if (Options.MaxHeight > 0 && Height > Options.MaxHeight)
+	{
+		Scale = FMath::Min(Scale, static_cast<double>(Options.MaxHeight) / Height);
+	}
+	if (Scale >= 1.0)
+	{
+		return FIntPoint(Width, Height);
+	}
+	return FIntPoint(FMath::Max(1, FMath::FloorToInt(Width * Scale)), FMath::Max(1, FMath::FloorToInt(Height * Scale)));
+}
+
+void FMCPImageEncoder::LoadModules()
+{
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>(ImageWrapperModuleName);
+}
+
+bool FMCPImageEncoder::Encode(FMCPImage& Image, const FMCPImageEncodeOptions& Options, TArray<uint8>& OutBytes, FString& OutError)
+{
+	if (Image.Width <= 0 || Image.Height <= 0 || Image.Pixels.Num() != Image.Width * Image.Height)
+	{
+		OutError = FString::Printf(TEXT("Invalid image: %dx%d with %d pixels"), Image.Width, Image.Height, Image.Pixels.Num());
+		return false;
+	}
+
+	IImageWrapperModule* ImageWrapperModule = FModuleManager::GetModulePtr<IImageWrapperModule>(ImageWrapperModuleName);
+	if (!ImageWrapperModule)
+	{
+		OutError = TEXT("ImageWrapper module is not loaded");
+		return false;
+	}
+
+	const FIntPoint OutputSize = GetOutputSize(Image.Width, Image.Height, Options);
+	if (OutputSize.X != Image.Width || OutputSize.Y != Image.Height)
+	{
+		TArray<FColor> Resized;
+		FImageUtils::ImageResize(Image.Width, Image.Height, Image.Pixels, OutputSize.X, OutputSize.Y, Resized, /*bLinearSpace=*/false);
+		Image.Pixels = MoveTemp(Resized);
+		Image.Width = OutputSize.X;
+		Image.Height = OutputSize.Y;
+	}
+
+	// Viewport read-back leaves alpha undefined; PNG would keep it
+	for (FColor& Pixel : Image.Pixels)
+	{
+		Pixel.A = 255;
+	}
+
+	const bool bJpeg = Options.Format == EMCPImageFormat::Jpeg;
+	TSharedPtr<IImageWrapper> Wrapper = ImageWrapperModule->CreateImageWrapper(bJpeg ? EImageFormat::JPEG : EImageFormat::PNG);
+	if (!Wrapper.IsValid()
+		|| !Wrapper->SetRaw(Image.Pixels.GetData(), Image.Pixels.Num() * sizeof(FColor), Image.Width, Image.Height, ERGBFormat::BGRA, 8))
+	{
+		OutError = TEXT("Failed to prepare the image for compression");
+		return false;
+	}
+
+	const auto& Compressed = Wrapper->GetCompressed(bJpeg ? FMath::Clamp(Options.Quality, 1, 100) : 0);
+	if (Compressed.Num() == 0)
+	{
+		OutError = TEXT("Image compression failed");
+		return false;
+	}
+	OutBytes.Reset(static_cast<int32>(Compressed.Num()));
+	OutBytes.Append(Compressed.GetData(), static_cast<int32>(Compressed.Num()));
+	return true;
+}
@@ -0,0 +1,288 @@
+#include "MCPJobManager.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+
+/** Finished jobs kept around for clients that have not collected their results yet. */
+static constexpr int32 MaxRetainedJobs = 16;
+
+/** Per-frame budget limits; a job cannot starve the editor or be starved itself. */
+static constexpr double MinBudgetMs = 1.0;
+static constexpr double MaxBudgetMs = 200.0;
+
+static const TCHAR* JobStateToString(EMCPJobState State)
+{
+	switch (State)
+	{
+	case EMCPJobState::Queued:    return TEXT("queued");
+	case EMCPJobState::Running:   return TEXT("running");
+	case EMCPJobState::Finished:  return TEXT("finished");
+	case EMCPJobState::Cancelled: return TEXT("cancelled");
+	}
+	return TEXT("unknown");
+}
+
+FMCPJobManager::~FMCPJobManager()
+{
+	Stop();
+}
+
+void FMCPJobManager::Stop()
+{
+	if (bTicking)
+	{
+#if ENGINE_MAJOR_VERSION >= 5
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+		TickerHandle.Reset();
+		bTicking = false;
+	}
+
+	for (FJobRecord& Record : Jobs)
+	{
+		if (Record.State == EMCPJobState::Queued || Record.State == EMCPJobState::Running)
+		{
+			Record.Job->Cancel();
+		}
+	}
+	Jobs.Empty();
+}
+
+void FMCPJobManager::RegisterCommands(FMCPCommandRegistry& Registry)
+{
+	Registry.RegisterCommand(TEXT("get_job_status"),
+		[this](const TSharedPtr<FJsonObject>& P) { return HandleGetJobStatus(P); });
+	Registry.RegisterCommand(TEXT("cancel_job"),
+		[this](const TSharedPtr<FJsonObject>& P) { return HandleCancelJob(P); });
+	Registry.RegisterCommand(TEXT("list_jobs"),
+		[this](const TSharedPtr<FJsonObject>& P) { return HandleListJobs(P); });
+}
+
+FString FMCPJobManager::Submit(const FString& Kind, const TSharedRef<FMCPJob>& Job, double BudgetMs)
+{
+	PruneFinished();
+
+	FJobRecord& Record = Jobs.AddDefaulted_GetRef();
+	Record.Id = FString::Printf(TEXT("%s-%d"), *Kind, NextJobNumber++);
+	Record.Kind = Kind;
+	Record.Job = Job;
+	Record.BudgetSeconds = FMath::Clamp(BudgetMs, MinBudgetMs, MaxBudgetMs) / 1000.0;
+	Record.SubmitTime = FPlatformTime::Seconds();
+
+	EnsureTicking();
+	return Record.Id;
+}
+
+void FMCPJobManager::EnsureTicking()
+{
+	if (bTicking)
+	{
+		return;
+	}
+	bTicking = true;
+#if ENGINE_MAJOR_VERSION >= 5
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPJobManager::Tick));
+#else
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPJobManager::Tick));
+#endif
+}
+
+bool FMCPJobManager::Tick(float DeltaTime)
+{
+	// Jobs run one at a time in submission order: two validation passes competing
+	// for the same frame budget would each take twice as long and finish no sooner.
+	FJobRecord* Active = nullptr;
+	for (FJobRecord& Record : Jobs)
+	{
+		if (Record.State == EMCPJobState::Queued || Record.State == EMCPJobState::Running)
+		{
+			Active = &Record;
+			break;
+		}
+	}
+	if (!Active)
+	{
+		bTicking = false;
+		TickerHandle.Reset();
+		return false;   // removes the ticker; Submit() re-adds it
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Active->State == EMCPJobState::Queued)
+	{
+		Active->State = EMCPJobState::Running;
+		Active->StartTime = Now;
+	}
+
+	const bool bDone = Active->Job->Step(Now + Active->BudgetSeconds);
+	const double End = FPlatformTime::Seconds();
+	Active->BusySeconds += End - Now;
+	if (bDone)
+	{
+		Active->State = EMCPJobState::Finished;
+		Active->EndTime = End;
+	}
+	return true;
+}
+
+void FMCPJobManager::PruneFinished()
+{
+	int32 NumFinished = 0;
+	for (const FJobRecord& Record : Jobs)
+	{
+		NumFinished += (Record.State == EMCPJobState::Finished || Record.State == EMCPJobState::Cancelled) ? 1 : 0;
+	}
+
+	// Oldest first, since Jobs is in submission order
+	for (int32 Index = 0; Index < Jobs.Num() && NumFinished >= MaxRetainedJobs; )
+	{
+		if (Jobs[Index].State == EMCPJobState::Finished || Jobs[Index].State == EMCPJobState::Cancelled)
+		{
+			Jobs.RemoveAt(Index);
+			--NumFinished;
+		}
+		else
+		{
+			++Index;
+		}
+	}
+}
+
+const FMCPJobManager::FJobRecord* FMCPJobManager::FindRecord(const FString& JobId) const
+{
+	return Jobs.FindByPredicate([&JobId](const FJobRecord& Record) { return Record.Id == JobId; });
+}
+
+TSharedPtr<FJsonObject> FMCPJobManager::DescribeJob(const FString& JobId, int32 Cursor, int32 MaxResults) const
+{
+	const FJobRecord* Record = FindRecord(JobId);
+	if (!Record)
+	{
+		return nullptr;
+	}
+
+	const FMCPJob& Job = *Record->Job;
+	const int32 Completed = Job.GetCompleted();
+	const int32 Total = Job.GetTotal();
+	const bool bActive = Record->State == EMCPJobState::Queued || Record->State == EMCPJobState::Running;
+	const double Now = FPlatformTime::Seconds();
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("job_id"), Record->Id);
+	Result->SetStringField(TEXT("kind"), Record->Kind);
+	Result->SetStringField(TEXT("state"), JobStateToString(Record->State));
+	Result->SetBoolField(TEXT("done"), !bActive);
+	Result->SetNumberField(TEXT("completed"), Completed);
+	Result->SetNumberField(TEXT("total"), Total);
+	Result->SetNumberField(TEXT("progress"), Total > 0 ? static_cast<double>(Completed) / Total : (bActive ? 0.0 : 1.0));
+	if (Record->StartTime > 0.0)
+	{
+		const double EndTime = bActive ? Now : Record->EndTime;
+		Result->SetNumberField(TEXT("elapsed_ms"), FMath::RoundToInt((EndTime - Record->StartTime) * 1000.0));
+		Result->SetNumberField(TEXT("busy_ms"), FMath::RoundToInt(Record->BusySeconds * 1000.0));
+	}
+
+	// Stream results from the client's cursor; next_cursor is what to send on the next poll
+	const int32 NumResults = Job.GetNumResults();
+	const int32 First = FMath::Clamp(Cursor, 0, NumResults);
+	const int32 Last = MaxResults > 0 ? FMath::Min(NumResults, First + MaxResults) : NumResults;
+	TArray<TSharedPtr<FJsonValue>> Results;
+	Results.Reserve(Last - First);
+	for (int32 Index = First; Index < Last; ++Index)
+	{
+		Results.Add(Job.GetResult(Index));
+	}
+	Result->SetArrayField(TEXT("results"), Results);
+	Result->SetNumberField(TEXT("next_cursor"), Last);
+	Result->SetBoolField(TEXT("has_more_results"), Last < NumResults);
+
+	TSharedPtr<FJsonObject> Summary = MakeShared<FJsonObject>();
+	Job.WriteSummary(*Summary);
+	Result->SetObjectField(TEXT("summary"), Summary);
+	return Result;
+}
+
+// ---------------------------------------------------------------------------
+// get_job_status
+// Params: job_id (string, required), cursor (number, default 0: results from
+//         the start), max_results (number, default 500; 0 = all)
+// ---------------------------------------------------------------------------
+TSharedPtr<FJsonObject> FMCPJobManager::HandleGetJobStatus(const TSharedPtr<FJsonObject>& Params)
+{
+	FString JobId;
+	if (!Params->TryGetStringField(TEXT("job_id"), JobId))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+	}
+
+	double Cursor = 0.0;
+	Params->TryGetNumberField(TEXT("cursor"), Cursor);
+	double MaxResults = 500.0;
+	Params->TryGetNumberField(TEXT("max_results"), MaxResults);
+
+	TSharedPtr<FJsonObject> Result = DescribeJob(JobId, static_cast<int32>(Cursor), static_cast<int32>(MaxResults));
+	if (!Result)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown job: %s"), *JobId));
+	}
+	return Result;
+}
+
+// ---------------------------------------------------------------------------
+// cancel_job
+// Params: job_id (string, required)
+// Results produced before the cancel stay available through get_job_status.
+// ---------------------------------------------------------------------------
+TSharedPtr<FJsonObject> FMCPJobManager::HandleCancelJob(const TSharedPtr<FJsonObject>& Params)
+{
+	FString JobId;
+	if (!Params->TryGetStringField(TEXT("job_id"), JobId))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+	}
+
+	FJobRecord* Record = Jobs.FindByPredicate([&JobId](const FJobRecord& R) { return R.Id == JobId; });
+	if (!Record)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown job: %s"), *JobId));
+	}
+
+	const bool bWasActive = Record->State == EMCPJobState::Queued || Record->State == EMCPJobState::Running;
+	if (bWasActive)
+	{
+		Record->Job->Cancel();
+		Record->State = EMCPJobState::Cancelled;
+		Record->EndTime = FPlatformTime::Seconds();
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("job_id"), JobId);
+	Result->SetBoolField(TEXT("cancelled"), bWasActive);
+	Result->SetStringField(TEXT("state"), JobStateToString(Record->State));
+	return Result;
+}
+
+// ---------------------------------------------------------------------------
+// list_jobs
+// Params: none
+// ---------------------------------------------------------------------------
+TSharedPtr<FJsonObject> FMCPJobManager::HandleListJobs(const TSharedPtr<FJsonObject>& Params)
+{
+	TArray<TSharedPtr<FJsonValue>> JobArray;
+	for (const FJobRecord& Record : Jobs)
+	{
+		TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetStringField(TEXT("job_id"), Record.Id);
+		Entry->SetStringField(TEXT("kind"), Record.Kind);
+		Entry->SetStringField(TEXT("state"), JobStateToString(Record.State));
+		Entry->SetNumberField(TEXT("completed"), Record.Job->GetCompleted());
+		Entry->SetNumberField(TEXT("total"), Record.Job->GetTotal());
+		Entry->SetNumberField(TEXT("results"), Record.Job->GetNumResults());
+		JobArray.Add(MakeShared<FJsonValueObject>(Entry));
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetArrayField(TEXT("jobs"), JobArray);
+	Result->SetNumberField(TEXT("count"), JobArray.Num());
+	return Result;
+}
@@ -0,0 +1,255 @@
+#include "MCPLogCapture.h"
+#include "Algo/Reverse.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Logging/LogVerbosity.h"
+#include "Misc/OutputDeviceRedirector.h"
+
+FMCPLogCapture::FMCPLogCapture(int32 InCapacity)
+	: Capacity(FMath::Max(InCapacity, 16))
+	, Slots(MakeUnique<FSlot[]>(Capacity))
+{
+}
+
+FMCPLogCapture::~FMCPLogCapture()
+{
+	Stop();
+}
+
+void FMCPLogCapture::Start()
+{
+	if (bStarted || !GLog)
+	{
+		return;
+	}
+	bStarted = true;
+	GLog->AddOutputDevice(this);
+}
+
+void FMCPLogCapture::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+	bStarted = false;
+	if (GLog)
+	{
+		GLog->RemoveOutputDevice(this);
+	}
+}
+
+void FMCPLogCapture::RegisterCommands(FMCPCommandRegistry& Registry)
+{
+	// Reads the ring without locks, so it never waits for the game thread
+	Registry.RegisterCommand(TEXT("query_log"),
+		[this](const TSharedPtr<FJsonObject>& P) { return HandleQueryLog(P); },
+		[]() { return true; });
+}
+
+void FMCPLogCapture::Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+	if (!Message || Verbosity == ELogVerbosity::SetColor)
+	{
+		return;   // colour changes are not lines
+	}
+
+	const uint64 Sequence = LastSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+	FSlot& Slot = Slots[Sequence % Capacity];
+
+	// Unpublish, write, publish: a reader that sees the same sequence before
+	// and after its copy got a consistent entry
+	Slot.Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Slot.Ticks = FDateTime::UtcNow().GetTicks();
+	Slot.Category = Category;
+	Slot.Verbosity = static_cast<ELogVerbosity::Type>(Verbosity & ELogVerbosity::VerbosityMask);
+	int32 Length = 0;
+	while (Length < MaxMessageChars && Message[Length])
+	{
+		Slot.Text[Length] = Message[Length];
+		++Length;
+	}
+	Slot.Length = Length;
+	Slot.bTruncated = Message[Length] != 0;
+
+	Slot.Sequence.store(Sequence, std::memory_order_release);
+}
+
+bool FMCPLogCapture::ReadEntry(uint64 Sequence, FEntry& OutEntry) const
+{
+	const FSlot& Slot = Slots[Sequence % Capacity];
+	if (Slot.Sequence.load(std::memory_order_acquire) != Sequence)
+	{
+		return false;
+	}
+
+	OutEntry.Ticks = Slot.Ticks;
+	OutEntry.Category = Slot.Category;
+	OutEntry.Verbosity = Slot.Verbosity;
+	OutEntry.bTruncated = Slot.bTruncated;
+	OutEntry.Length = FMath::Clamp(Slot.Length, 0, MaxMessageChars);
+	FMemory::Memcpy(OutEntry.Text, Slot.Text, OutEntry.Length * sizeof(TCHAR));
+	OutEntry.Text[OutEntry.Length] = TEXT('\0');
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (Slot.Sequence.load(std::memory_order_relaxed) != Sequence)
+	{
+		return false;   // overwritten while we copied it
+	}
+	OutEntry.Sequence = Sequence;
+	return true;
+}
+
+bool FMCPLogCapture::IsPending(uint64 Sequence) const
+{
+	// Until a later writer claims this slot again, an unreadable entry can only be one still being written
+	const uint64 Current = LastSequence.load(std::memory_order_acquire);
+	return Sequence + Capacity > Current
+		&& Slots[Sequence % Capacity].Sequence.load(std::memory_order_acquire) != Sequence;
+}
+
+// query_log
+// Params: since (number, optional) - only entries after this sequence, oldest first;
+//           without it the newest matching entries are returned
+//         category (string or array, optional), min_verbosity (string, optional:
+//           Fatal / Error / Warning / Display / Log / Verbose), contains (string,
+//           optional, case-insensitive), limit (int, default 200, max 5000)
+// Returns: entries[] {seq, time, category, verbosity, message, truncated},
+//          count, first_seq (oldest entry still held), last_seq,
+//          next_since (pass back as since), has_more,
+//          missed (entries after since were already overwritten)
+TSharedPtr<FJsonObject> FMCPLogCapture::HandleQueryLog(const TSharedPtr<FJsonObject>& Params)
+{
+	TArray<FName> Categories;
+	FString CategoryString;
+	const TArray<TSharedPtr<FJsonValue>>* CategoryValues = nullptr;
+	if (Params->TryGetArrayField(TEXT("category"), CategoryValues))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *CategoryValues)
+		{
+			Categories.Add(FName(*Value->AsString()));
+		}
+	}
+	else if (Params->TryGetStringField(TEXT("category"), CategoryString) && !CategoryString.IsEmpty())
+	{
+		Categories.Add(FName(*CategoryString));
+	}
+
+	ELogVerbosity::Type MinVerbosity = ELogVerbosity::All;
+	FString VerbosityString;
+	if (Params->TryGetStringField(TEXT("min_verbosity"), VerbosityString) && !VerbosityString.IsEmpty())
+	{
+		MinVerbosity = ParseLogVerbosityFromString(VerbosityString);
+		if (MinVerbosity == ELogVerbosity::NoLogging)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+				TEXT("Unknown verbosity '%s' (expected Fatal, Error, Warning, Display, Log, Verbose or VeryVerbose)"),
+				*VerbosityString));
+		}
+	}
+
+	FString Contains;
+	Params->TryGetStringField(TEXT("contains"), Contains);
+
+	int32 Limit = 200;
+	double Number = 0.0;
+	if (Params->TryGetNumberField(TEXT("limit"), Number))
+	{
+		Limit = FMath::Clamp(static_cast<int32>(Number), 1, 5000);
+	}
+
+	const uint64 Last = LastSequence.load(std::memory_order_acquire);
+	const uint64 First = Last > static_cast<uint64>(Capacity) ? Last - Capacity + 1 : 1;
+
+	const bool bHasSince = Params->TryGetNumberField(TEXT("since"), Number);
+	const uint64 Since = bHasSince ? static_cast<uint64>(FMath::Max(0.0, Number)) : 0;
+
+	auto Matches = [&](const FEntry& Entry)
+	{
+		return Entry.Verbosity <= MinVerbosity
+			&& (Categories.Num() == 0 || Categories.Contains(Entry.Category))
+			&& (Contains.IsEmpty() || FCString::Stristr(Entry.Text, *Contains) != nullptr);
+	};
+
+	TArray<TSharedPtr<FJsonValue>> EntryValues;
+	auto AddEntry = [&EntryValues](const FEntry& Entry)
+	{
+		TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+		EntryObj->SetNumberField(TEXT("seq"), static_cast<double>(Entry.Sequence));
+		EntryObj->SetStringField(TEXT("time"), FDateTime(Entry.Ticks).ToIso8601());
+		EntryObj->SetStringField(TEXT("category"), Entry.Category.ToString());
+		EntryObj->SetStringField(TEXT("verbosity"), ToString(Entry.Verbosity));
+		EntryObj->SetStringField(TEXT("message"), FString(Entry.Length, Entry.Text));
+		if (Entry.bTruncated)
+		{
+			EntryObj->SetBoolField(TEXT("truncated"), true);
+		}
+		EntryValues.Add(MakeShared<FJsonValueObject>(EntryObj));
+	};
+
+	FEntry Entry;
+	bool bHasMore = false;
+	uint64 NextSince = Last;
+	if (bHasSince)
+	{
+		for (uint64 Sequence = FMath::Max(Since + 1, First); Sequence <= Last; ++Sequence)
+		{
+			if (!ReadEntry(Sequence, Entry))
+			{
+				if (IsPending(Sequence))
+				{
+					// Stop before a line another thread is still writing, so the next poll reads it
+					NextSince = Sequence - 1;
+					bHasMore = true;
+					break;
+				}
+				continue;   // already overwritten
+			}
+			if (!Matches(Entry))
+			{
+				continue;
+			}
+			if (EntryValues.Num() == Limit)
+			{
+				bHasMore = true;
+				break;
+			}
+			AddEntry(Entry);
+			NextSince = Sequence;
+		}
+		if (!bHasMore)
+		{
+			NextSince = Last;
+		}
+	}
+	else
+	{
+		// Newest first, then flipped so entries always read oldest to newest
+		for (uint64 Sequence = Last; Sequence >= First && Sequence > 0; --Sequence)
+		{
+			if (!ReadEntry(Sequence, Entry) || !Matches(Entry))
+			{
+				continue;
+			}
+			if (EntryValues.Num() == Limit)
+			{
+				bHasMore = true;
+				break;
+			}
+			AddEntry(Entry);
+		}
+		Algo::Reverse(EntryValues);
+	}
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetArrayField(TEXT("entries"), EntryValues);
+	ResultObj->SetNumberField(TEXT("count"), EntryValues.Num());
+	ResultObj->SetNumberField(TEXT("first_seq"), static_cast<double>(Last > 0 ? First : 0));
+	ResultObj->SetNumberField(TEXT("last_seq"), static_cast<double>(Last));
+	ResultObj->SetNumberField(TEXT("next_since"), static_cast<double>(NextSince));
+	ResultObj->SetBoolField(TEXT("has_more"), bHasMore);
+	ResultObj->SetBoolField(TEXT("missed"), bHasSince && Since + 1 < First);
+	return ResultObj;
+}
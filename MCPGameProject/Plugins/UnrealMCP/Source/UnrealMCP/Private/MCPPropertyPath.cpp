@@ -0,0 +1,1021 @@
+#include "MCPPropertyPath.h"
+#include "MCPClassResolver.h"
+#include "UnrealMCPCompat.h"
+#include "Editor.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "JsonObjectConverter.h"
+#include "Misc/OutputDeviceNull.h"
+#include "Misc/ScopeExit.h"
+#include "UObject/UnrealType.h"
+#include "UObject/TextProperty.h"
+#include "UObject/EnumProperty.h"
+
+/** Sub-object hops a single path may take; guards against reference cycles in malformed paths. */
+static constexpr int32 MaxObjectHops = 8;
+
+/** Compiled paths kept before the cache starts over; enough for every property of a few hundred classes. */
+static constexpr int32 MaxCachedPaths = 8192;
+
+/** Enum options listed in an "unknown value" error before it is truncated. */
+static constexpr int32 MaxListedEnumOptions = 16;
+
+/** Nesting of structs / containers serialized by ValueToJson; deeper values are written as null. */
+static constexpr int32 MaxValueDepth = 12;
+
+FMCPPropertyPath& FMCPPropertyPath::Get()
+{
+	static FMCPPropertyPath Instance;
+	return Instance;
+}
+
+void FMCPPropertyPath::Start()
+{
+	if (bStarted)
+	{
+		return;
+	}
+	bStarted = true;
+
+	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FMCPPropertyPath::OnModulesChanged);
+#if ENGINE_MAJOR_VERSION >= 5
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		Invalidate();
+	});
+#endif
+	// A blueprint compile recreates the generated class's properties in place
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddLambda([this]()
+		{
+			Invalidate();
+		});
+	}
+}
+
+void FMCPPropertyPath::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+	bStarted = false;
+
+	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+#if ENGINE_MAJOR_VERSION >= 5
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#endif
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	Cache.Empty();
+	EditableProperties.Empty();
+}
+
+void FMCPPropertyPath::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	if (Reason == EModuleChangeReason::ModuleLoaded)
+	{
+		Invalidate();
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Parsing and compilation
+// ---------------------------------------------------------------------------
+
+namespace
+{
+	struct FPathToken
+	{
+		bool bIndex = false;
+		FString Text;
+		int32 Start = 0;   // offset of the token in the path, used to split off sub-object remainders
+	};
+}
+
+/** Split "A.B[2].C[Key]" into A, B, [2], C, [Key]. */
+static bool TokenizePath(const FString& Path, TArray<FPathToken>& OutTokens, FString& OutError)
+{
+	const int32 Len = Path.Len();
+	int32 Pos = 0;
+	while (Pos < Len)
+	{
+		FPathToken& Token = OutTokens.AddDefaulted_GetRef();
+		Token.Start = Pos;
+		if (Path[Pos] == TEXT('['))
+		{
+			const int32 Close = Path.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+			if (Close == INDEX_NONE)
+			{
+				OutError = FString::Printf(TEXT("Unbalanced '[' in property path '%s'"), *Path);
+				return false;
+			}
+			if (OutTokens.Num() == 1)
+			{
+				OutError = FString::Printf(TEXT("Property path '%s' must start with a property name"), *Path);
+				return false;
+			}
+			Token.bIndex = true;
+			Token.Text = Path.Mid(Pos + 1, Close - Pos - 1).TrimStartAndEnd();
+			Pos = Close + 1;
+			if (Pos < Len && Path[Pos] != TEXT('.') && Path[Pos] != TEXT('['))
+			{
+				OutError = FString::Printf(TEXT("Expected '.' or '[' after ']' in property path '%s'"), *Path);
+				return false;
+			}
+		}
+		else
+		{
+			int32 End = Pos;
+			while (End < Len && Path[End] != TEXT('.') && Path[End] != TEXT('['))
+			{
+				++End;
+			}
+			if (End == Pos)
+			{
+				OutError = FString::Printf(TEXT("Empty segment in property path '%s'"), *Path);
+				return false;
+			}
+			Token.Text = Path.Mid(Pos, End - Pos);
+			Pos = End;
+		}
+
+		if (Pos < Len && Path[Pos] == TEXT('.'))
+		{
+			++Pos;
+			if (Pos == Len)
+			{
+				OutError = FString::Printf(TEXT("Property path '%s' ends with '.'"), *Path);
+				return false;
+			}
+		}
+	}
+
+	if (OutTokens.Num() == 0)
+	{
+		OutError = TEXT("Empty property path");
+		return false;
+	}
+	return true;
+}
+
+static bool ParseIndex(const FString& Text, int32& OutIndex)
+{
+	if (Text.IsEmpty() || !Text.IsNumeric() || Text.Contains(TEXT(".")) || Text.StartsWith(TEXT("-")))
+	{
+		return false;
+	}
+	OutIndex = FCString::Atoi(*Text);
+	return true;
+}
+
+const FMCPPropertyPath::FCompiledPath& FMCPPropertyPath::Compile(UClass* Class, const FString& Path)
+{
+	const TPair<FObjectKey, FString> Key(FObjectKey(Class), Path);
+	if (const FCompiledPath* Found = Cache.Find(Key))
+	{
+		return *Found;
+	}
+
+	if (Cache.Num() >= MaxCachedPaths)
+	{
+		Cache.Reset();
+	}
+	FCompiledPath& Entry = Cache.Add(Key);
+	CompileInto(Class, Path, Entry);
+	return Entry;
+}
+
+void FMCPPropertyPath::CompileInto(UClass* Class, const FString& Path, FCompiledPath& Out)
+{
+	TArray<FPathToken> Tokens;
+	if (!TokenizePath(Path, Tokens, Out.Error))
+	{
+		return;
+	}
+
+	UStruct* Container = Class;
+	FProperty* Current = nullptr;      // property describing the value the steps so far point at
+	bool bElementSelected = false;     // a fixed-size Current has already been indexed
+
+	for (const FPathToken& Token : Tokens)
+	{
+		if (!Token.bIndex)
+		{
+			if (Current)
+			{
+				if (Current->ArrayDim > 1 && !bElementSelected)
+				{
+					Out.Error = FString::Printf(TEXT("'%s' is a fixed-size array; index it before accessing '%s'"),
+						*Current->GetName(), *Token.Text);
+					return;
+				}
+				if (FStructProperty* StructProp = CastField<FStructProperty>(Current))
+				{
+					Container = StructProp->Struct;
+				}
+				else if (CastField<FObjectPropertyBase>(Current))
+				{
+					// Resolved per hop against the sub-object's runtime class
+					Out.Remainder = Path.Mid(Token.Start);
+					return;
+				}
+				else
+				{
+					Out.Error = FString::Printf(TEXT("'%s' is not a struct or object; cannot access '%s'"),
+						*Current->GetName(), *Token.Text);
+					return;
+				}
+			}
+
+			FProperty* Property = FindFProperty<FProperty>(Container, *Token.Text);
+			if (!Property)
+			{
+				Out.Error = FString::Printf(TEXT("Property not found: %s on %s"), *Token.Text, *Container->GetName());
+				return;
+			}
+			FStep& Step = Out.Steps.AddDefaulted_GetRef();
+			Step.Kind = FStep::EKind::Member;
+			Step.Property = Property;
+			Current = Property;
+			bElementSelected = false;
+			continue;
+		}
+
+		FStep& Step = Out.Steps.AddDefaulted_GetRef();
+		Step.Property = Current;
+		if (Current->ArrayDim > 1 && !bElementSelected)
+		{
+			if (!ParseIndex(Token.Text, Step.Index) || Step.Index >= Current->ArrayDim)
+			{
+				Out.Error = FString::Printf(TEXT("Invalid index [%s] for '%s' (size %d)"),
+					*Token.Text, *Current->GetName(), Current->ArrayDim);
+				return;
+			}
+			Step.Kind = FStep::EKind::StaticIndex;
+			bElementSelected = true;
+		}
+		else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Current))
+		{
+			if (!ParseIndex(Token.Text, Step.Index))
+			{
+				Out.Error = FString::Printf(TEXT("Invalid array index [%s] for '%s'"), *Token.Text, *Current->GetName());
+				return;
+			}
+			Step.Kind = FStep::EKind::ArrayIndex;
+			Current = ArrayProp->Inner;
+			bElementSelected = false;
+		}
+		else if (FMapProperty* MapProp = CastField<FMapProperty>(Current))
+		{
+			Step.Kind = FStep::EKind::MapKey;
+			Step.Key = Token.Text;
+			Current = MapProp->ValueProp;
+			bElementSelected = false;
+		}
+		else
+		{
+			Out.Error = FString::Printf(TEXT("'%s' cannot be indexed with [%s]"), *Current->GetName(), *Token.Text);
+			return;
+		}
+	}
+
+	if (Current->ArrayDim > 1 && !bElementSelected)
+	{
+		Out.Error = FString::Printf(TEXT("'%s' is a fixed-size array; address its elements with [i]"), *Current->GetName());
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Resolution
+// ---------------------------------------------------------------------------
+
+bool FMCPPropertyPath::Resolve(UObject* Object, const FString& Path, FMCPPropertyTarget& OutTarget, FString& OutError,
+	bool bAllowGrow)
+{
+	const EWalkResult Result = Walk(Object, Path, bAllowGrow, OutTarget, OutError, 0);
+	if (Result == EWalkResult::NeedsGrow)
+	{
+		OutError = FString::Printf(TEXT("'%s' does not exist"), *Path);
+	}
+	return Result == EWalkResult::Ok;
+}
+
+FMCPPropertyPath::EWalkResult FMCPPropertyPath::Walk(UObject* Object, const FString& Path, bool bAllowGrow,
+	FMCPPropertyTarget& OutTarget, FString& OutError, int32 Depth)
+{
+	if (!Object)
+	{
+		OutError = TEXT("Invalid object");
+		return EWalkResult::Failed;
+	}
+	if (Depth > MaxObjectHops)
+	{
+		OutError = FString::Printf(TEXT("Property path crosses more than %d objects"), MaxObjectHops);
+		return EWalkResult::Failed;
+	}
+
+	const FCompiledPath& Compiled = Compile(Object->GetClass(), Path);
+	if (!Compiled.Error.IsEmpty())
+	{
+		// On actors the first segment may name a component rather than a property
+		if (AActor* Actor = Cast<AActor>(Object))
+		{
+			int32 SegmentEnd = 0;
+			while (SegmentEnd < Path.Len() && Path[SegmentEnd] != TEXT('.') && Path[SegmentEnd] != TEXT('['))
+			{
+				++SegmentEnd;
+			}
+			if (SegmentEnd < Path.Len() && Path[SegmentEnd] == TEXT('.'))
+			{
+				const FString ComponentName = Path.Left(SegmentEnd);
+				for (UActorComponent* Component : Actor->GetComponents())
+				{
+					if (Component && Component->GetName() == ComponentName)
+					{
+						return Walk(Component, Path.Mid(SegmentEnd + 1), bAllowGrow, OutTarget, OutError, Depth + 1);
+					}
+				}
+			}
+		}
+		OutError = Compiled.Error;
+		return EWalkResult::Failed;
+	}
+
+	uint8* ValuePtr = reinterpret_cast<uint8*>(Object);
+	FProperty* Leaf = nullptr;
+	FProperty* MemberProperty = nullptr;
+
+	auto NeedsGrow = [&]()
+	{
+		OutTarget.Owner = Object;
+		OutTarget.MemberProperty = MemberProperty;
+		OutTarget.Property = nullptr;
+		OutTarget.ValuePtr = nullptr;
+		return EWalkResult::NeedsGrow;
+	};
+
+	for (const FStep& Step : Compiled.Steps)
+	{
+		switch (Step.Kind)
+		{
+		case FStep::EKind::Member:
+			ValuePtr = Step.Property->ContainerPtrToValuePtr<uint8>(ValuePtr);
+			Leaf = Step.Property;
+			MemberProperty = MemberProperty ? MemberProperty : Step.Property;
+			break;
+
+		case FStep::EKind::StaticIndex:
+			ValuePtr += Step.Index * (Step.Property->GetSize() / Step.Property->ArrayDim);
+			break;
+
+		case FStep::EKind::ArrayIndex:
+		{
+			FArrayProperty* ArrayProp = CastFieldChecked<FArrayProperty>(Step.Property);
+			FScriptArrayHelper Helper(ArrayProp, ValuePtr);
+			if (Step.Index >= Helper.Num())
+			{
+				if (Step.Index > Helper.Num())
+				{
+					OutError = FString::Printf(TEXT("Index %d is out of range for '%s' (%d elements)"),
+						Step.Index, *ArrayProp->GetName(), Helper.Num());
+					return EWalkResult::Failed;
+				}
+				if (!bAllowGrow)
+				{
+					return NeedsGrow();
+				}
+				Helper.AddValue();
+			}
+			ValuePtr = Helper.GetRawPtr(Step.Index);
+			Leaf = ArrayProp->Inner;
+			break;
+		}
+
+		case FStep::EKind::MapKey:
+		{
+			FMapProperty* MapProp = CastFieldChecked<FMapProperty>(Step.Property);
+			FProperty* KeyProp = MapProp->KeyProp;
+			FScriptMapHelper Helper(MapProp, ValuePtr);
+
+			TArray<uint8> KeyBuffer;
+			KeyBuffer.SetNumZeroed(KeyProp->GetSize());
+			KeyProp->InitializeValue(KeyBuffer.GetData());
+			ON_SCOPE_EXIT
+			{
+				KeyProp->DestroyValue(KeyBuffer.GetData());
+			};
+
+			if (FStrProperty* StrKeyProp = CastField<FStrProperty>(KeyProp))
+			{
+				StrKeyProp->SetPropertyValue(KeyBuffer.GetData(), Step.Key);
+			}
+			else
+			{
+				FOutputDeviceNull Ignored;
+				if (!MCP_IMPORT_TEXT(KeyProp, *Step.Key, KeyBuffer.GetData(), Object, &Ignored))
+				{
+					OutError = FString::Printf(TEXT("'%s' is not a valid key for '%s'"), *Step.Key, *MapProp->GetName());
+					return EWalkResult::Failed;
+				}
+			}
+
+			int32 PairIndex = INDEX_NONE;
+			for (int32 Index = 0, MaxIndex = Helper.GetMaxIndex(); Index < MaxIndex; ++Index)
+			{
+				if (Helper.IsValidIndex(Index) && KeyProp->Identical(Helper.GetKeyPtr(Index), KeyBuffer.GetData()))
+				{
+					PairIndex = Index;
+					break;
+				}
+			}
+			if (PairIndex == INDEX_NONE)
+			{
+				if (!bAllowGrow)
+				{
+					return NeedsGrow();
+				}
+				PairIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+				KeyProp->CopySingleValue(Helper.GetKeyPtr(PairIndex), KeyBuffer.GetData());
+				Helper.Rehash();
+			}
+			ValuePtr = Helper.GetValuePtr(PairIndex);
+			Leaf = MapProp->ValueProp;
+			break;
+		}
+		}
+	}
+
+	if (!Compiled.Remainder.IsEmpty())
+	{
+		// Copy before recursing: compiling the next hop may grow the cache under Compiled
+		const FString Remainder = Compiled.Remainder;
+		UObject* SubObject = CastFieldChecked<FObjectPropertyBase>(Leaf)->GetObjectPropertyValue(ValuePtr);
+		if (!SubObject)
+		{
+			OutError = FString::Printf(TEXT("'%s' is None; cannot resolve '%s'"), *Leaf->GetName(), *Remainder);
+			return EWalkResult::Failed;
+		}
+		return Walk(SubObject, Remainder, bAllowGrow, OutTarget, OutError, Depth + 1);
+	}
+
+	OutTarget.Owner = Object;
+	OutTarget.MemberProperty = MemberProperty;
+	OutTarget.Property = Leaf;
+	OutTarget.ValuePtr = ValuePtr;
+	return EWalkResult::Ok;
+}
+
+// ---------------------------------------------------------------------------
+// Value conversion
+// ---------------------------------------------------------------------------
+
+static bool ResolveEnumValue(const UEnum* Enum, const TSharedPtr<FJsonValue>& Value, int64& OutValue, FString& OutError)
+{
+	if (Value->Type == EJson::Number)
+	{
+		OutValue = static_cast<int64>(Value->AsNumber());
+		return true;
+	}
+
+	const FString Text = Value->AsString();
+	if (Text.IsNumeric())
+	{
+		OutValue = FCString::Atoi64(*Text);
+		return true;
+	}
+
+	// "Player0" or "EAutoReceiveInput::Player0"
+	FString ShortName = Text;
+	Text.Split(TEXT("::"), nullptr, &ShortName);
+	int64 EnumValue = Enum->GetValueByNameString(ShortName);
+	if (EnumValue == INDEX_NONE)
+	{
+		EnumValue = Enum->GetValueByNameString(Text);
+	}
+
+	// NumEnums() includes the implicit _MAX entry
+	const int32 NumOptions = FMath::Max(Enum->NumEnums() - 1, 0);
+	for (int32 Index = 0; EnumValue == INDEX_NONE && Index < NumOptions; ++Index)
+	{
+		if (Enum->GetDisplayNameTextByIndex(Index).ToString().Equals(Text, ESearchCase::IgnoreCase))
+		{
+			EnumValue = Enum->GetValueByIndex(Index);
+		}
+	}
+
+	if (EnumValue == INDEX_NONE)
+	{
+		TArray<FString> Options;
+		for (int32 Index = 0; Index < FMath::Min(NumOptions, MaxListedEnumOptions); ++Index)
+		{
+			Options.Add(Enum->GetNameStringByIndex(Index));
+		}
+		OutError = FString::Printf(TEXT("Unknown value '%s' for enum %s (valid: %s%s)"), *Text, *Enum->GetName(),
+			*FString::Join(Options, TEXT(", ")), NumOptions > MaxListedEnumOptions ? TEXT(", ...") : TEXT(""));
+		return false;
+	}
+	OutValue = EnumValue;
+	return true;
+}
+
+static bool ImportFromText(FProperty* Property, void* ValuePtr, UObject* Owner, const FString& Text, FString& OutError)
+{
+	FOutputDeviceNull Ignored;
+	if (!MCP_IMPORT_TEXT(Property, *Text, ValuePtr, Owner, &Ignored))
+	{
+		OutError = FString::Printf(TEXT("Could not parse '%s' as %s"), *Text, *Property->GetCPPType());
+		return false;
+	}
+	return true;
+}
+
+/** [x, y, z] into a struct whose fields are all floating point (FVector, FRotator, FLinearColor, ...). */
+static bool SetStructFromNumbers(FStructProperty* StructProp, void* ValuePtr, const TArray<TSharedPtr<FJsonValue>>& Numbers,
+	FString& OutError)
+{
+	TArray<FNumericProperty*> Fields;
+	for (TFieldIterator<FProperty> It(StructProp->Struct); It; ++It)
+	{
+		FNumericProperty* Field = CastField<FNumericProperty>(*It);
+		if (!Field || !Field->IsFloatingPoint())
+		{
+			Fields.Reset();
+			break;
+		}
+		Fields.Add(Field);
+	}
+	if (Fields.Num() == 0 || Numbers.Num() > Fields.Num())
+	{
+		OutError = FString::Printf(TEXT("%s cannot be set from an array of %d numbers"),
+			*StructProp->Struct->GetName(), Numbers.Num());
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Numbers.Num(); ++Index)
+	{
+		double Number = 0.0;
+		if (!Numbers[Index].IsValid() || !Numbers[Index]->TryGetNumber(Number))
+		{
+			OutError = FString::Printf(TEXT("Element %d of the %s value is not a number"), Index, *StructProp->Struct->GetName());
+			return false;
+		}
+		Fields[Index]->SetFloatingPointPropertyValue(Fields[Index]->ContainerPtrToValuePtr<void>(ValuePtr), Number);
+	}
+	return true;
+}
+
+bool FMCPPropertyPath::SetValueFromJson(FProperty* Property, void* ValuePtr, UObject* Owner,
+	const TSharedPtr<FJsonValue>& Value, FString& OutError)
+{
+	if (!Property || !ValuePtr || !Value.IsValid())
+	{
+		OutError = TEXT("Invalid property or value");
+		return false;
+	}
+
+	if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+	{
+		bool bValue = false;
+		if (!Value->TryGetBool(bValue))
+		{
+			OutError = FString::Printf(TEXT("'%s' expects a bool"), *Property->GetName());
+			return false;
+		}
+		BoolProp->SetPropertyValue(ValuePtr, bValue);
+		return true;
+	}
+
+	if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+	{
+		int64 EnumValue = 0;
+		if (!ResolveEnumValue(EnumProp->GetEnum(), Value, EnumValue, OutError))
+		{
+			return false;
+		}
+		EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, EnumValue);
+		return true;
+	}
+
+	if (FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+	{
+		if (const UEnum* Enum = NumericProp->GetIntPropertyEnum())
+		{
+			int64 EnumValue = 0;
+			if (!ResolveEnumValue(Enum, Value, EnumValue, OutError))
+			{
+				return false;
+			}
+			NumericProp->SetIntPropertyValue(ValuePtr, EnumValue);
+			return true;
+		}
+
+		double Number = 0.0;
+		if (!Value->TryGetNumber(Number))
+		{
+			OutError = FString::Printf(TEXT("'%s' expects a number"), *Property->GetName());
+			return false;
+		}
+		if (NumericProp->IsFloatingPoint())
+		{
+			NumericProp->SetFloatingPointPropertyValue(ValuePtr, Number);
+		}
+		else
+		{
+			NumericProp->SetIntPropertyValue(ValuePtr, static_cast<int64>(Number));
+		}
+		return true;
+	}
+
+	if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+	{
+		StrProp->SetPropertyValue(ValuePtr, Value->AsString());
+		return true;
+	}
+	if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+	{
+		NameProp->SetPropertyValue(ValuePtr, FName(*Value->AsString()));
+		return true;
+	}
+	if (FTextProperty* TextProp = CastField<FTextProperty>(Property))
+	{
+		TextProp->SetPropertyValue(ValuePtr, FText::FromString(Value->AsString()));
+		return true;
+	}
+
+	if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		if (Value->Type == EJson::Array)
+		{
+			return SetStructFromNumbers(StructProp, ValuePtr, Value->AsArray(), OutError);
+		}
+		if (Value->Type == EJson::Object)
+		{
+			if (!FJsonObjectConverter::JsonObjectToUStruct(Value->AsObject().ToSharedRef(), StructProp->Struct, ValuePtr))
+			{
+				OutError = FString::Printf(TEXT("Could not convert the object to %s"), *StructProp->Struct->GetName());
+				return false;
+			}
+			return true;
+		}
+	}
+
+	if (FClassProperty* ClassProp = CastField<FClassProperty>(Property))
+	{
+		if (Value->Type == EJson::Null || Value->AsString().IsEmpty() || Value->AsString() == TEXT("None"))
+		{
+			ClassProp->SetObjectPropertyValue(ValuePtr, nullptr);
+			return true;
+		}
+		UClass* Class = FMCPClassResolver::Get().Resolve(Value->AsString(), ClassProp->MetaClass);
+		if (!Class)
+		{
+			OutError = FMCPClassResolver::Get().GetLastError();
+			return false;
+		}
+		ClassProp->SetObjectPropertyValue(ValuePtr, Class);
+		return true;
+	}
+
+	// Soft references keep their path; hard references load the object
+	if (FObjectProperty* ObjectProp = CastField<FObjectProperty>(Property))
+	{
+		if (Value->Type == EJson::Null || Value->AsString().IsEmpty() || Value->AsString() == TEXT("None"))
+		{
+			ObjectProp->SetObjectPropertyValue(ValuePtr, nullptr);
+			return true;
+		}
+		if (Value->Type == EJson::String)
+		{
+			UObject* Referenced = StaticLoadObject(ObjectProp->PropertyClass, nullptr, *Value->AsString());
+			if (!Referenced)
+			{
+				OutError = FString::Printf(TEXT("No %s found at '%s'"), *ObjectProp->PropertyClass->GetName(), *Value->AsString());
+				return false;
+			}
+			ObjectProp->SetObjectPropertyValue(ValuePtr, Referenced);
+			return true;
+		}
+	}
+
+	if ((Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>())
+		&& (Value->Type == EJson::Array || Value->Type == EJson::Object))
+	{
+		if (!FJsonObjectConverter::JsonValueToUProperty(Value, Property, ValuePtr, 0, 0))
+		{
+			OutError = FString::Printf(TEXT("Could not convert the value to %s"), *Property->GetCPPType());
+			return false;
+		}
+		return true;
+	}
+
+	if (Value->Type == EJson::String)
+	{
+		return ImportFromText(Property, ValuePtr, Owner, Value->AsString(), OutError);
+	}
+
+	OutError = FString::Printf(TEXT("Unsupported value for %s property '%s'"), *Property->GetCPPType(), *Property->GetName());
+	return false;
+}
+
+// ---------------------------------------------------------------------------
+// Batched edits
+// ---------------------------------------------------------------------------
+
+int32 FMCPPropertyPath::SetProperties(UObject* Object, const TArray<TPair<FString, TSharedPtr<FJsonValue>>>& Values,
+	TArray<FString>& OutErrors)
+{
+	struct FOwnerEdit
+	{
+		UObject* Owner = nullptr;
+		FProperty* MemberProperty = nullptr;   // null when several members of Owner change
+		FProperty* Leaf = nullptr;
+		bool bSingleMember = true;
+	};
+
+	// Pass 1: validate every path and find the objects that will change. Values
+	// are not written yet: appending to a container for one path could move
+	// memory another resolved path points into.
+	TArray<FOwnerEdit> Owners;
+	TArray<int32> Valid;
+	for (int32 Index = 0; Index < Values.Num(); ++Index)
+	{
+		FMCPPropertyTarget Target;
+		FString Error;
+		if (Walk(Object, Values[Index].Key, false, Target, Error, 0) == EWalkResult::Failed)
+		{
+			OutErrors.Add(FString::Printf(TEXT("%s: %s"), *Values[Index].Key, *Error));
+			continue;
+		}
+		Valid.Add(Index);
+
+		// A container that is about to grow reports its member as the changed property
+		FProperty* Leaf = Target.Property ? Target.Property : Target.MemberProperty;
+		FOwnerEdit* Edit = Owners.FindByPredicate([&Target](const FOwnerEdit& E) { return E.Owner == Target.Owner; });
+		if (!Edit)
+		{
+			Edit = &Owners.AddDefaulted_GetRef();
+			Edit->Owner = Target.Owner;
+			Edit->MemberProperty = Target.MemberProperty;
+			Edit->Leaf = Leaf;
+		}
+		else if (Edit->MemberProperty != Target.MemberProperty || Edit->Leaf != Leaf)
+		{
+			Edit->bSingleMember = false;
+		}
+	}
+
+	for (const FOwnerEdit& Edit : Owners)
+	{
+		Edit.Owner->Modify();
+		Edit.Owner->PreEditChange(Edit.bSingleMember ? Edit.MemberProperty : nullptr);
+	}
+
+	// Pass 2: resolve again (cheap, the paths are compiled) growing containers as needed, then write
+	int32 NumSet = 0;
+	for (int32 Index : Valid)
+	{
+		FMCPPropertyTarget Target;
+		FString Error;
+		if (Walk(Object, Values[Index].Key, true, Target, Error, 0) != EWalkResult::Ok
+			|| !SetValueFromJson(Target.Property, Target.ValuePtr, Target.Owner, Values[Index].Value, Error))
+		{
+			OutErrors.Add(FString::Printf(TEXT("%s: %s"), *Values[Index].Key, *Error));
+			continue;
+		}
+		++NumSet;
+	}
+
+	for (const FOwnerEdit& Edit : Owners)
+	{
+		if (Edit.bSingleMember && Edit.Leaf)
+		{
+			FPropertyChangedEvent Event(Edit.Leaf, EPropertyChangeType::ValueSet);
+			Event.SetActiveMemberProperty(Edit.MemberProperty);
+			Edit.Owner->PostEditChangeProperty(Event);
+		}
+		else
+		{
+			Edit.Owner->PostEditChange();
+		}
+	}
+	return NumSet;
+}
+
+int32 FMCPPropertyPath::SetProperties(UObject* Object, const FJsonObject& Values, TArray<FString>& OutErrors)
+{
+	TArray<TPair<FString, TSharedPtr<FJsonValue>>> Pairs;
+	Pairs.Reserve(Values.Values.Num());
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Values.Values)
+	{
+		Pairs.Emplace(Pair.Key, Pair.Value);
+	}
+	return SetProperties(Object, Pairs, OutErrors);
+}
+
+// ---------------------------------------------------------------------------
+// Reading
+// ---------------------------------------------------------------------------
+
+static TSharedPtr<FJsonValue> ValueToJsonAtDepth(FProperty* Property, const void* ValuePtr, int32 Depth);
+
+/** A member as JSON; fixed-size (ArrayDim > 1) members become arrays. */
+static TSharedPtr<FJsonValue> MemberToJson(FProperty* Property, const void* ValuePtr, int32 Depth)
+{
+	if (Property->ArrayDim <= 1)
+	{
+		return ValueToJsonAtDepth(Property, ValuePtr, Depth);
+	}
+
+	const int32 ElementSize = Property->GetSize() / Property->ArrayDim;
+	TArray<TSharedPtr<FJsonValue>> Elements;
+	Elements.Reserve(Property->ArrayDim);
+	for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+	{
+		Elements.Add(ValueToJsonAtDepth(Property, static_cast<const uint8*>(ValuePtr) + Index * ElementSize, Depth));
+	}
+	return MakeShared<FJsonValueArray>(Elements);
+}
+
+static TSharedPtr<FJsonValue> ValueToJsonAtDepth(FProperty* Property, const void* ValuePtr, int32 Depth)
+{
+	if (Depth > MaxValueDepth)
+	{
+		return MakeShared<FJsonValueNull>();
+	}
+
+	if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+	{
+		return MakeShared<FJsonValueBoolean>(BoolProp->GetPropertyValue(ValuePtr));
+	}
+	if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+	{
+		const int64 Value = EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+		return MakeShared<FJsonValueString>(EnumProp->GetEnum()->GetNameStringByValue(Value));
+	}
+	if (FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+	{
+		if (const UEnum* Enum = NumericProp->GetIntPropertyEnum())
+		{
+			return MakeShared<FJsonValueString>(Enum->GetNameStringByValue(NumericProp->GetSignedIntPropertyValue(ValuePtr)));
+		}
+		if (NumericProp->IsFloatingPoint())
+		{
+			return MakeShared<FJsonValueNumber>(NumericProp->GetFloatingPointPropertyValue(ValuePtr));
+		}
+		return MakeShared<FJsonValueNumber>(static_cast<double>(NumericProp->GetSignedIntPropertyValue(ValuePtr)));
+	}
+	if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+	{
+		return MakeShared<FJsonValueString>(StrProp->GetPropertyValue(ValuePtr));
+	}
+	if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+	{
+		return MakeShared<FJsonValueString>(NameProp->GetPropertyValue(ValuePtr).ToString());
+	}
+	if (FTextProperty* TextProp = CastField<FTextProperty>(Property))
+	{
+		return MakeShared<FJsonValueString>(TextProp->GetPropertyValue(ValuePtr).ToString());
+	}
+
+	// References are written as paths; soft references are not loaded
+	if (FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(Property))
+	{
+		const FSoftObjectPath Path = SoftProp->GetPropertyValue(ValuePtr).ToSoftObjectPath();
+		return Path.IsNull() ? StaticCastSharedRef<FJsonValue>(MakeShared<FJsonValueNull>())
+			: StaticCastSharedRef<FJsonValue>(MakeShared<FJsonValueString>(Path.ToString()));
+	}
+	if (FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Property))
+	{
+		const UObject* Referenced = ObjectProp->GetObjectPropertyValue(ValuePtr);
+		return Referenced ? StaticCastSharedRef<FJsonValue>(MakeShared<FJsonValueString>(Referenced->GetPathName()))
+			: StaticCastSharedRef<FJsonValue>(MakeShared<FJsonValueNull>());
+	}
+
+	if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		TSharedPtr<FJsonObject> Fields = MakeShared<FJsonObject>();
+		for (TFieldIterator<FProperty> It(StructProp->Struct); It; ++It)
+		{
+			Fields->SetField(It->GetName(), MemberToJson(*It, It->ContainerPtrToValuePtr<void>(ValuePtr), Depth + 1));
+		}
+		return MakeShared<FJsonValueObject>(Fields);
+	}
+
+	if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Helper(ArrayProp, ValuePtr);
+		TArray<TSharedPtr<FJsonValue>> Elements;
+		Elements.Reserve(Helper.Num());
+		for (int32 Index = 0; Index < Helper.Num(); ++Index)
+		{
+			Elements.Add(ValueToJsonAtDepth(ArrayProp->Inner, Helper.GetRawPtr(Index), Depth + 1));
+		}
+		return MakeShared<FJsonValueArray>(Elements);
+	}
+	if (FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProp, ValuePtr);
+		TArray<TSharedPtr<FJsonValue>> Elements;
+		Elements.Reserve(Helper.Num());
+		for (int32 Index = 0, MaxIndex = Helper.GetMaxIndex(); Index < MaxIndex; ++Index)
+		{
+			if (Helper.IsValidIndex(Index))
+			{
+				Elements.Add(ValueToJsonAtDepth(SetProp->ElementProp, Helper.GetElementPtr(Index), Depth + 1));
+			}
+		}
+		return MakeShared<FJsonValueArray>(Elements);
+	}
+	if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper Helper(MapProp, ValuePtr);
+		const bool bStringKeys = MapProp->KeyProp->IsA<FStrProperty>() || MapProp->KeyProp->IsA<FNameProperty>()
+			|| MapProp->KeyProp->IsA<FNumericProperty>() || MapProp->KeyProp->IsA<FEnumProperty>();
+
+		TSharedPtr<FJsonObject> Entries = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> Pairs;
+		for (int32 Index = 0, MaxIndex = Helper.GetMaxIndex(); Index < MaxIndex; ++Index)
+		{
+			if (!Helper.IsValidIndex(Index))
+			{
+				continue;
+			}
+			TSharedPtr<FJsonValue> Key = ValueToJsonAtDepth(MapProp->KeyProp, Helper.GetKeyPtr(Index), Depth + 1);
+			TSharedPtr<FJsonValue> Value = ValueToJsonAtDepth(MapProp->ValueProp, Helper.GetValuePtr(Index), Depth + 1);
+			if (bStringKeys)
+			{
+				Entries->SetField(Key->AsString(), Value);
+			}
+			else
+			{
+				Pairs.Add(MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>{ Key, Value }));
+			}
+		}
+		return bStringKeys ? StaticCastSharedRef<FJsonValue>(MakeShared<FJsonValueObject>(Entries))
+			: StaticCastSharedRef<FJsonValue>(MakeShared<FJsonValueArray>(Pairs));
+	}
+
+	// Delegates, interfaces and field paths have no useful JSON form
+	return MakeShared<FJsonValueNull>();
+}
+
+TSharedPtr<FJsonValue> FMCPPropertyPath::ValueToJson(FProperty* Property, const void* ValuePtr)
+{
+	return ValueToJsonAtDepth(Property, ValuePtr, 0);
+}
+
+const TArray<FProperty*>& FMCPPropertyPath::GetEditableProperties(UClass* Class)
+{
+	const FObjectKey Key(Class);
+	if (const TArray<FProperty*>* Found = EditableProperties.Find(Key))
+	{
+		return *Found;
+	}
+
+	TArray<FProperty*>& Properties = EditableProperties.Add(Key);
+	for (TFieldIterator<FProperty> It(Class); It; ++It)
+	{
+		if (It->HasAnyPropertyFlags(CPF_Edit) && !It->HasAnyPropertyFlags(CPF_Deprecated))
+		{
+			Properties.Add(*It);
+		}
+	}
+	return Properties;
+}
+
+TSharedPtr<FJsonObject> FMCPPropertyPath::ReadProperties(UObject* Object, const TArray<FString>& Paths,
+	TArray<FString>& OutErrors)
+{
+	TSharedPtr<FJsonObject> Values = MakeShared<FJsonObject>();
+	if (!Object)
+	{
+		OutErrors.Add(TEXT("Invalid object"));
+		return Values;
+	}
+
+	if (Paths.Num() == 0)
+	{
+		for (FProperty* Property : GetEditableProperties(Object->GetClass()))
+		{
+			Values->SetField(Property->GetName(), MemberToJson(Property, Property->ContainerPtrToValuePtr<void>(Object), 0));
+		}
+		return Values;
+	}
+
+	for (const FString& Path : Paths)
+	{
+		FMCPPropertyTarget Target;
+		FString Error;
+		if (!Resolve(Object, Path, Target, Error))
+		{
+			OutErrors.Add(FString::Printf(TEXT("%s: %s"), *Path, *Error));
+			continue;
+		}
+		Values->SetField(Path, ValueToJsonAtDepth(Target.Property, Target.ValuePtr, 0));
+	}
+	return Values;
+}
@@ -8,17 +8,44 @@
 #include "UnrealMCPBridge.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
+#include "HAL/RunnableThread.h"
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
-#include "JsonObjectConverter.h"
-#include "Misc/ScopeLock.h"
-#include "HAL/PlatformTime.h"
+#include "Serialization/JsonWriter.h"
+#include "HAL/PlatformProcess.h"
 
-// Buffer size for receiving data
-const int32 BufferSize = 8192;
+namespace
+{
+    // Bytes read from the socket per Recv
+    const int32 ReceiveChunkSize = 64 * 1024;
+
+    // Socket send / receive buffer size
+    const int32 SocketBufferSize = 64 * 1024;
+
+    // How long a thread blocks on a socket before checking whether it should stop
+    const FTimespan PollInterval = FTimespan::FromMilliseconds(100);
+
+    // Same shape as the error responses of UUnrealMCPBridge::DispatchCommand
+    FString MakeErrorResponse(const FString& Message)
+    {
+        TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), Message);
+
+        FString ResultString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
+        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+        return ResultString;
+    }
+
+    bool IsJsonWhitespace(uint8 Byte)
+    {
+        return Byte == ' ' || Byte == '\t' || Byte == '\r' || Byte == '\n';
+    }
+}
 
 FMCPServerRunnable::FMCPServerRunnable(UUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
     : Bridge(InBridge)
@@ -30,7 +57,7 @@ FMCPServerRunnable::FMCPServerRunnable(UUnrealMCPBridge* InBridge, TSharedPtr<FS
 
 FMCPServerRunnable::~FMCPServerRunnable()
 {
-    // Note: We don't delete the sockets here as they're owned by the bridge
+    // Note: We don't delete the listener socket here as it's owned by the bridge
 }
 
 bool FMCPServerRunnable::Init()
@@ -41,129 +68,52 @@ bool FMCPServerRunnable::Init()
 uint32 FMCPServerRunnable::Run()
 {
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Server thread starting..."));
-    
+
+    int32 NextConnectionId = 1;
     while (bRunning)
     {
-        // UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Waiting for client connection..."));
-        
+        ReapConnections(false);
+
         bool bPending = false;
-        if (ListenerSocket->HasPendingConnection(bPending) && bPending)
+        if (!ListenerSocket->WaitForPendingConnection(bPending, PollInterval))
         {
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection pending, accepting..."));
-            
-            ClientSocket = MakeShareable(ListenerSocket->Accept(TEXT("MCPClient")));
-            if (ClientSocket.IsValid())
-            {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection accepted"));
-                
-                // Set socket options to improve connection stability
-                ClientSocket->SetNoDelay(true);
-                int32 SocketBufferSize = 65536;  // 64KB buffer
-                ClientSocket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
-                ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
-                
-                uint8 Buffer[8192];
-                while (bRunning)
-                {
-                    int32 BytesRead = 0;
-                    if (ClientSocket->Recv(Buffer, sizeof(Buffer), BytesRead))
-                    {
-                        if (BytesRead == 0)
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client disconnected (zero bytes)"));
-                            break;
-                        }
-
-                        // Convert received data to string
-                        Buffer[BytesRead] = '\0';
-                        FString ReceivedText = UTF8_TO_TCHAR(Buffer);
-                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *ReceivedText);
-
-                        // Parse JSON
-                        TSharedPtr<FJsonObject> JsonObject;
-                        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReceivedText);
-                        
-                        if (FJsonSerializer::Deserialize(Reader, JsonObject))
-                        {
-                            // Get command type
-                            FString CommandType;
-                            if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
-                            {
-                                TSharedPtr<FJsonObject> Params = JsonObject->HasField(TEXT("params"))
-                                    ? JsonObject->GetObjectField(TEXT("params"))
-                                    : MakeShared<FJsonObject>();
-
-                                // ExecuteCommand already dispatches to game thread internally
-                                // via TPromise/TFuture+AsyncTask, so call it directly here.
-                                FString Response = Bridge->ExecuteCommand(CommandType, Params);
-
-                                // Log response for debugging
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
-
-                                // Send response
-                                int32 BytesSent = 0;
-                                FTCHARToUTF8 Utf8Response(*Response);
-                                if (!ClientSocket->Send((const uint8*)Utf8Response.Get(), Utf8Response.Length(), BytesSent))
-                                {
-                                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response"));
-                                }
-                                else
-                                {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully, bytes: %d"), BytesSent);
-                                }
-                            }
-                            else
-                            {
-                                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
-                            }
-                        }
-                        else
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText);
-                        }
-                    }
-                    else
-                    {
-                        int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
-                        // Don't break the connection for WouldBlock error, which is normal for non-blocking sockets
-                        bool bShouldBreak = true;
-                        
-                        // Check for "would block" error which isn't a real error for non-blocking sockets
-                        if (LastError == SE_EWOULDBLOCK) 
-                        {
-                            UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Socket would block, continuing..."));
-                            bShouldBreak = false;
-                            // Small sleep to prevent tight loop when no data
-                            FPlatformProcess::Sleep(0.01f);
-                        }
-                        // Check for other transient errors we might want to tolerate
-                        else if (LastError == SE_EINTR) // Interrupted system call
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Socket read interrupted, continuing..."));
-                            bShouldBreak = false;
-                        }
-                        else 
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client disconnected or error. Last error code: %d"), LastError);
-                        }
-                        
-                        if (bShouldBreak)
-                        {
-                            break;
-                        }
-                    }
-                }
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to accept client connection"));
-            }
+            // Listener error: back off instead of spinning
+            FPlatformProcess::Sleep(0.1f);
+            continue;
+        }
+        if (!bPending)
+        {
+            continue;
+        }
+
+        FSocket* NewSocket = ListenerSocket->Accept(TEXT("MCPClient"));
+        if (!NewSocket)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to accept client connection"));
+            continue;
+        }
+
+        if (Connections.Num() >= MaxConnections)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Refusing client, %d connections already open"), Connections.Num());
+            NewSocket->Close();
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(NewSocket);
+            continue;
+        }
+
+        TUniquePtr<FMCPClientConnection> Connection = MakeUnique<FMCPClientConnection>(Bridge, NewSocket, NextConnectionId++);
+        if (Connection->Start())
+        {
+            Connections.Add(MoveTemp(Connection));
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to create client thread"));
         }
-        
-        // Small sleep to prevent tight loop
-        FPlatformProcess::Sleep(0.1f);
     }
-    
+
+    ReapConnections(true);
+
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Server thread stopping"));
     return 0;
 }
@@ -177,159 +127,302 @@ void FMCPServerRunnable::Exit()
 {
 }
 
-void FMCPServerRunnable::HandleClientConnection(TSharedPtr<FSocket> InClientSocket)
+void FMCPServerRunnable::ReapConnections(bool bAll)
 {
-    if (!InClientSocket.IsValid())
+    for (int32 Index = Connections.Num() - 1; Index >= 0; --Index)
     {
-        UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Invalid client socket passed to HandleClientConnection"));
-        return;
+        if (bAll || Connections[Index]->IsFinished())
+        {
+            // Joins the connection thread and closes its socket
+            Connections.RemoveAt(Index);
+        }
     }
+}
 
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Starting to handle client connection"));
-    
-    // Set socket options for better connection stability
-    InClientSocket->SetNonBlocking(false);
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Set socket to blocking mode"));
-    
-    // Properly read full message with timeout
-    const int32 MaxBufferSize = 4096;
-    uint8 Buffer[MaxBufferSize];
-    FString MessageBuffer;
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Starting message receive loop"));
-    
-    while (bRunning && InClientSocket.IsValid())
+FMCPClientConnection::FMCPClientConnection(UUnrealMCPBridge* InBridge, FSocket* InSocket, int32 InId)
+    : Bridge(InBridge)
+    , Socket(InSocket)
+    , Id(InId)
+    , bRunning(true)
+    , bFinished(false)
+{
+}
+
+FMCPClientConnection::~FMCPClientConnection()
+{
+    if (Thread)
+    {
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    if (Socket)
+    {
+        Socket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+        Socket = nullptr;
+    }
+}
+
+bool FMCPClientConnection::Start()
+{
+    // Non-blocking with Wait() before each read / write, so Stop() is noticed
+    // within PollInterval on every platform
+    Socket->SetNonBlocking(true);
+    Socket->SetNoDelay(true);
+    int32 ActualSize = 0;
+    Socket->SetSendBufferSize(SocketBufferSize, ActualSize);
+    Socket->SetReceiveBufferSize(SocketBufferSize, ActualSize);
+    ReceiveChunk.SetNumUninitialized(ReceiveChunkSize);
+
+    Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("UnrealMCPClient%d"), Id), 0, TPri_Normal);
+    return Thread != nullptr;
+}
+
+uint32 FMCPClientConnection::Run()
+{
+    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client %d connected"), Id);
+
+    while (bRunning)
     {
-        // Log socket state
-        bool bIsConnected = InClientSocket->GetConnectionState() == SCS_Connected;
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Socket state - Connected: %s"), 
-               bIsConnected ? TEXT("true") : TEXT("false"));
-        
-        // Log pending data status before receive
-        uint32 PendingDataSize = 0;
-        bool HasPendingData = InClientSocket->HasPendingData(PendingDataSize);
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Before Recv - HasPendingData=%s, Size=%d"), 
-               HasPendingData ? TEXT("true") : TEXT("false"), PendingDataSize);
-        
-        // Try to receive data with timeout
-        int32 BytesRead = 0;
-        bool bReadSuccess = false;
-        
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Attempting to receive data..."));
-        bReadSuccess = InClientSocket->Recv(Buffer, MaxBufferSize, BytesRead, ESocketReceiveFlags::None);
-        
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Recv attempt complete - Success=%s, BytesRead=%d"), 
-               bReadSuccess ? TEXT("true") : TEXT("false"), BytesRead);
-        
-        if (BytesRead > 0)
+        // Answer every request already received before waiting for more input
+        int32 RequestStart = 0;
+        int32 RequestLength = 0;
+        bool bFramed = false;
+        bool bProtocolError = false;
+        bool bConnected = true;
+        while (bConnected && TakeRequest(RequestStart, RequestLength, bFramed, bProtocolError))
         {
-            // Log raw data for debugging
-            FString HexData;
-            for (int32 i = 0; i < FMath::Min(BytesRead, 50); ++i)
-            {
-                HexData += FString::Printf(TEXT("%02X "), Buffer[i]);
-            }
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Raw data (first 50 bytes hex): %s%s"), 
-                   *HexData, BytesRead > 50 ? TEXT("...") : TEXT(""));
-            
-            // Convert and log received data
-            Buffer[BytesRead] = 0; // Null terminate
-            FString ReceivedData = UTF8_TO_TCHAR(Buffer);
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received data as string: '%s'"), *ReceivedData);
-            
-            // Append to message buffer
-            MessageBuffer.Append(ReceivedData);
-            
-            // Process complete messages (messages are terminated with newline)
-            if (MessageBuffer.Contains(TEXT("\n")))
+            bConnected = HandleRequest(Buffer.GetData() + RequestStart, RequestLength, bFramed);
+        }
+        if (!bConnected || bProtocolError)
+        {
+            break;
+        }
+
+        // Keep only the request in progress
+        if (ReadPos == Buffer.Num())
+        {
+            Buffer.Reset();
+            JsonScanPos = 0;
+            ReadPos = 0;
+        }
+        else if (ReadPos > 0)
+        {
+            Buffer.RemoveAt(0, ReadPos);
+            JsonScanPos -= ReadPos;
+            ReadPos = 0;
+        }
+
+        if (!ReceiveMore())
+        {
+            break;
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client %d disconnected"), Id);
+    bFinished = true;
+    return 0;
+}
+
+void FMCPClientConnection::Stop()
+{
+    bRunning = false;
+}
+
+bool FMCPClientConnection::ReceiveMore()
+{
+    if (!Socket->Wait(ESocketWaitConditions::WaitForRead, PollInterval))
+    {
+        // Timed out; keep going unless the socket itself failed
+        return Socket->GetConnectionState() != SCS_ConnectionError;
+    }
+
+    int32 BytesRead = 0;
+    const bool bReceived = Socket->Recv(ReceiveChunk.GetData(), ReceiveChunk.Num(), BytesRead);
+    if (BytesRead > 0)
+    {
+        Buffer.Append(ReceiveChunk.GetData(), BytesRead);
+        return true;
+    }
+
+    // Readable but nothing to read means the peer closed the connection
+    const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+    if (!bReceived && LastError == SE_EINTR)
+    {
+        return true;
+    }
+    if (!bReceived && LastError != SE_EWOULDBLOCK && LastError != SE_NO_ERROR)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Client %d receive error %d"), Id, (int32)LastError);
+    }
+    return false;
+}
+
+bool FMCPClientConnection::TakeRequest(int32& OutStart, int32& OutLength, bool& bOutFramed, bool& bOutProtocolError)
+{
+    const int32 Num = Buffer.Num();
+
+    // Whitespace between requests (e.g. a newline after a bare JSON request) is ignored.
+    // It cannot start a length prefix, whose first byte is at most MaxFrameBytes >> 24.
+    if (JsonScanPos == ReadPos)
+    {
+        while (ReadPos < Num && IsJsonWhitespace(Buffer[ReadPos]))
+        {
+            ++ReadPos;
+        }
+        JsonScanPos = ReadPos;
+    }
+    if (ReadPos >= Num)
+    {
+        return false;
+    }
+
+    if (Buffer[ReadPos] == '{')
+    {
+        // Bare JSON: find the brace closing the top-level object, resuming where the last call stopped
+        for (; JsonScanPos < Num; ++JsonScanPos)
+        {
+            const uint8 Byte = Buffer[JsonScanPos];
+            if (bJsonInString)
             {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Newline detected in buffer, processing messages"));
-                
-                TArray<FString> Messages;
-                MessageBuffer.ParseIntoArray(Messages, TEXT("\n"), true);
-                
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Found %d message(s) in buffer"), Messages.Num());
-                
-                // Process all complete messages
-                for (int32 i = 0; i < Messages.Num() - 1; ++i)
+                if (bJsonEscape)
                 {
-                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Processing message %d: '%s'"), 
-                           i + 1, *Messages[i]);
-                    ProcessMessage(InClientSocket, Messages[i]);
+                    bJsonEscape = false;
+                }
+                else if (Byte == '\\')
+                {
+                    bJsonEscape = true;
+                }
+                else if (Byte == '"')
+                {
+                    bJsonInString = false;
                 }
-                
-                // Keep any incomplete message in the buffer
-                MessageBuffer = Messages.Last();
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Remaining buffer after processing: %s"), 
-                       *MessageBuffer);
             }
-            else
+            else if (Byte == '"')
             {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: No complete message yet (no newline detected)"));
+                bJsonInString = true;
+            }
+            else if (Byte == '{' || Byte == '[')
+            {
+                ++JsonDepth;
+            }
+            else if ((Byte == '}' || Byte == ']') && --JsonDepth == 0)
+            {
+                OutStart = ReadPos;
+                OutLength = JsonScanPos + 1 - ReadPos;
+                bOutFramed = false;
+                ReadPos = JsonScanPos = JsonScanPos + 1;
+                return true;
             }
         }
-        else if (!bReadSuccess)
+
+        if ((uint32)(Num - ReadPos) > MaxFrameBytes)
         {
-            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Connection closed or error occurred - Last error: %d"), 
-                   (int32)ISocketSubsystem::Get()->GetLastErrorCode());
-            break;
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client %d sent an unterminated JSON request over %u bytes"), Id, MaxFrameBytes);
+            bOutProtocolError = true;
         }
-        
-        // Small sleep to prevent tight loop
-        FPlatformProcess::Sleep(0.01f);
+        return false;
+    }
+
+    if (Num - ReadPos < 4)
+    {
+        return false;
+    }
+
+    const uint8* Header = Buffer.GetData() + ReadPos;
+    const uint32 FrameLength = ((uint32)Header[0] << 24) | ((uint32)Header[1] << 16) | ((uint32)Header[2] << 8) | (uint32)Header[3];
+    if (FrameLength == 0 || FrameLength > MaxFrameBytes)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client %d sent an invalid frame length %u"), Id, FrameLength);
+        bOutProtocolError = true;
+        return false;
     }
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Exited message receive loop"));
+    if ((uint32)(Num - ReadPos - 4) < FrameLength)
+    {
+        return false;
+    }
+
+    OutStart = ReadPos + 4;
+    OutLength = (int32)FrameLength;
+    bOutFramed = true;
+    ReadPos = JsonScanPos = OutStart + OutLength;
+    return true;
 }
 
-void FMCPServerRunnable::ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message)
+bool FMCPClientConnection::HandleRequest(const uint8* Data, int32 Length, bool bFramed)
 {
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Processing message: %s"), *Message);
-    
-    // Parse message as JSON
-    TSharedPtr<FJsonObject> JsonMessage;
+    FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), Length);
+    const FString Message(Converter.Length(), Converter.Get());
+
+    FString CommandType;
+    FString Response;
+    TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
-    
-    if (!FJsonSerializer::Deserialize(Reader, JsonMessage) || !JsonMessage.IsValid())
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
     {
-        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse message as JSON"));
-        return;
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client %d sent invalid JSON (%d bytes)"), Id, Length);
+        Response = MakeErrorResponse(TEXT("Invalid JSON request"));
     }
-    
-    // Extract command type and parameters using MCP protocol format
-    FString CommandType;
-    TSharedPtr<FJsonObject> Params = MakeShareable(new FJsonObject());
-    
-    if (!JsonMessage->TryGetStringField(TEXT("command"), CommandType))
+    else if (!JsonObject->TryGetStringField(TEXT("type"), CommandType))
     {
-        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Message missing 'command' field"));
-        return;
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
+        Response = MakeErrorResponse(TEXT("Missing 'type' field in command"));
     }
-    
-    // Parameters are optional in MCP protocol
-    if (JsonMessage->HasField(TEXT("params")))
+    else
     {
-        TSharedPtr<FJsonValue> ParamsValue = JsonMessage->TryGetField(TEXT("params"));
-        if (ParamsValue.IsValid() && ParamsValue->Type == EJson::Object)
-        {
-            Params = ParamsValue->AsObject();
-        }
+        const TSharedPtr<FJsonObject>* ParamsObject = nullptr;
+        TSharedPtr<FJsonObject> Params = JsonObject->TryGetObjectField(TEXT("params"), ParamsObject)
+            ? *ParamsObject
+            : MakeShared<FJsonObject>();
+
+        // ExecuteCommand already dispatches to game thread internally
+        // via TPromise/TFuture+AsyncTask, so call it directly here.
+        Response = Bridge->ExecuteCommand(CommandType, Params);
     }
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
-    
-    // Execute command
-    FString Response = Bridge->ExecuteCommand(CommandType, Params);
-    
-    // Send response with newline terminator
-    Response += TEXT("\n");
-    int32 BytesSent = 0;
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
-    
+
+    // Sizes only: requests and responses can carry whole source files or inline screenshots
     FTCHARToUTF8 Utf8Response(*Response);
-    if (!Client->Send((const uint8*)Utf8Response.Get(), Utf8Response.Length(), BytesSent))
+    const int32 ResponseLength = Utf8Response.Length();
+    UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Client %d %s: %d bytes in, %d bytes out"), Id, *CommandType, Length, ResponseLength);
+
+    if (!bFramed)
+    {
+        return SendAll(reinterpret_cast<const uint8*>(Utf8Response.Get()), ResponseLength);
+    }
+
+    TArray<uint8> Frame;
+    Frame.Reserve(4 + ResponseLength);
+    Frame.Add((uint8)(ResponseLength >> 24));
+    Frame.Add((uint8)(ResponseLength >> 16));
+    Frame.Add((uint8)(ResponseLength >> 8));
+    Frame.Add((uint8)ResponseLength);
+    Frame.Append(reinterpret_cast<const uint8*>(Utf8Response.Get()), ResponseLength);
+    return SendAll(Frame.GetData(), Frame.Num());
+}
+
+bool FMCPClientConnection::SendAll(const uint8* Data, int32 Length)
+{
+    int32 Offset = 0;
+    while (Offset < Length && bRunning)
     {
-        UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response"));
+        int32 BytesSent = 0;
+        if (Socket->Send(Data + Offset, Length - Offset, BytesSent) && BytesSent > 0)
+        {
+            Offset += BytesSent;
+            continue;
+        }
+
+        const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+        if (LastError != SE_EWOULDBLOCK && LastError != SE_EINTR && LastError != SE_NO_ERROR)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response to client %d, error %d"), Id, (int32)LastError);
+            return false;
+        }
+
+        // Send buffer full: wait for the client to read
+        Socket->Wait(ESocketWaitConditions::WaitForWrite, PollInterval);
     }
-} 
\ No newline at end of file
+    return Offset == Length;
+}
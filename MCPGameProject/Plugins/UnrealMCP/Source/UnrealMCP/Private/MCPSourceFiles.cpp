@@ -0,0 +1,999 @@
+#include "MCPSourceFiles.h"
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Internationalization/Regex.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include <atomic>
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#endif
+
+FMCPFileView::FMCPFileView() = default;
+
+FMCPFileView::~FMCPFileView()
+{
+	Close();
+}
+
+void FMCPFileView::Close()
+{
+	Region.Reset();
+	Handle.Reset();
+	Loaded.Empty();
+	Data = nullptr;
+	Size = 0;
+}
+
+bool FMCPFileView::Open(const FString& Path, FString& OutError)
+{
+	Close();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 FileSize = PlatformFile.FileSize(*Path);
+	if (FileSize < 0)
+	{
+		OutError = FString::Printf(TEXT("File not found: %s"), *Path);
+		return false;
+	}
+	if (FileSize == 0)
+	{
+		return true;   // nothing to map
+	}
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3)
+	FOpenMappedResult Mapped = PlatformFile.OpenMappedEx(*Path);
+	if (Mapped.HasValue())
+	{
+		Handle = Mapped.StealValue();
+	}
+#else
+	Handle.Reset(PlatformFile.OpenMapped(*Path));
+#endif
+	if (Handle)
+	{
+		Region.Reset(Handle->MapRegion(0, FileSize));
+	}
+
+	if (Region)
+	{
+		Data = Region->GetMappedPtr();
+		Size = Region->GetMappedSize();
+	}
+	else
+	{
+		// No mapping support (or the file is locked for mapping): read it instead
+		Region.Reset();
+		Handle.Reset();
+		if (!FFileHelper::LoadFileToArray(Loaded, *Path))
+		{
+			OutError = FString::Printf(TEXT("Failed to read file: %s"), *Path);
+			return false;
+		}
+		Data = Loaded.GetData();
+		Size = Loaded.Num();
+	}
+
+	// UTF-16 sources are rare but valid; convert them once so every consumer sees UTF-8
+	if (FMCPSourceFiles::IsUtf16(Data, Size))
+	{
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *Path))
+		{
+			Close();
+			OutError = FString::Printf(TEXT("Failed to read file: %s"), *Path);
+			return false;
+		}
+		Region.Reset();
+		Handle.Reset();
+		const FTCHARToUTF8 Utf8(*Text);
+		Loaded.Reset();
+		Loaded.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		Data = Loaded.GetData();
+		Size = Loaded.Num();
+	}
+	return true;
+}
+
+int64 FMCPFileView::GetTextStart() const
+{
+	return (Size >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF) ? 3 : 0;
+}
+
+FString FMCPSourceFiles::ResolvePath(const FString& Path)
+{
+	if (FPaths::IsRelative(Path))
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / Path);
+	}
+	return Path;
+}
+
+FString FMCPSourceFiles::HashBytes(const uint8* Data, int64 Size)
+{
+	uint8 Digest[FSHA1::DigestSize];
+	FSHA1::HashBuffer(Data, static_cast<uint64>(Size), Digest);
+	return BytesToHex(Digest, FSHA1::DigestSize).ToLower();
+}
+
+FString FMCPSourceFiles::Utf8ToString(const uint8* Data, int64 Size)
+{
+	if (Size <= 0)
+	{
+		return FString();
+	}
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data), static_cast<int32>(Size));
+	return FString(Converted.Length(), Converted.Get());
+}
+
+// ---------------------------------------------------------------------------
+// Search
+// ---------------------------------------------------------------------------
+
+namespace MCPSourceSearch
+{
+	/** Longest line text returned; generated or minified files can have enormous lines. */
+	constexpr int64 MaxLineBytes = 400;
+	/** Files handed to one ParallelFor task; each task compiles the regex at most once. */
+	constexpr int32 FilesPerTask = 64;
+
+	/** Byte needle for the prefilter and for literal searches (ASCII-folded when case-insensitive). */
+	struct FLiteral
+	{
+		TArray<uint8> Bytes;
+		bool bCaseSensitive = true;
+	};
+
+	static uint8 FoldAscii(uint8 Byte)
+	{
+		return (Byte >= 'A' && Byte <= 'Z') ? static_cast<uint8>(Byte + ('a' - 'A')) : Byte;
+	}
+
+	static FLiteral MakeLiteral(const FString& Text, bool bCaseSensitive)
+	{
+		FLiteral Literal;
+		Literal.bCaseSensitive = bCaseSensitive;
+		const FTCHARToUTF8 Utf8(*Text);
+		Literal.Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		if (!bCaseSensitive)
+		{
+			for (uint8& Byte : Literal.Bytes)
+			{
+				Byte = FoldAscii(Byte);
+			}
+		}
+		return Literal;
+	}
+
+	/** First occurrence of Needle in [Begin, End); an empty needle matches at Begin. */
+	static const uint8* Find(const uint8* Begin, const uint8* End, const FLiteral& Needle)
+	{
+		const int64 NeedleSize = Needle.Bytes.Num();
+		if (NeedleSize == 0)
+		{
+			return Begin;
+		}
+		if (End - Begin < NeedleSize)
+		{
+			return nullptr;
+		}
+		const uint8* LastStart = End - NeedleSize;
+		const uint8* NeedleBytes = Needle.Bytes.GetData();
+
+		if (Needle.bCaseSensitive)
+		{
+			for (const uint8* Pos = Begin; Pos <= LastStart; ++Pos)
+			{
+				Pos = static_cast<const uint8*>(memchr(Pos, NeedleBytes[0], (LastStart - Pos) + 1));
+				if (!Pos)
+				{
+					return nullptr;
+				}
+				if (FMemory::Memcmp(Pos + 1, NeedleBytes + 1, NeedleSize - 1) == 0)
+				{
+					return Pos;
+				}
+			}
+			return nullptr;
+		}
+
+		for (const uint8* Pos = Begin; Pos <= LastStart; ++Pos)
+		{
+			if (FoldAscii(*Pos) != NeedleBytes[0])
+			{
+				continue;
+			}
+			int64 Matched = 1;
+			while (Matched < NeedleSize && FoldAscii(Pos[Matched]) == NeedleBytes[Matched])
+			{
+				++Matched;
+			}
+			if (Matched == NeedleSize)
+			{
+				return Pos;
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Longest run of characters every match of the regex must contain, or ""
+	 * when there is none we can be sure of. Conservative: alternation and
+	 * inline flags disable it, groups and classes end runs, and a character
+	 * followed by ?, * or {..} is dropped since it may be absent.
+	 */
+	static FString ExtractRequiredLiteral(const FString& Pattern, bool bCaseSensitive)
+	{
+		if (Pattern.Contains(TEXT("|")) || Pattern.Contains(TEXT("(?")) || Pattern.Contains(TEXT("\\Q")))
+		{
+			return FString();
+		}
+
+		FString Best;
+		FString Run;
+		int32 Depth = 0;
+		auto EndRun = [&Best, &Run]()
+		{
+			if (Run.Len() > Best.Len())
+			{
+				Best = Run;
+			}
+			Run.Reset();
+		};
+
+		const int32 Len = Pattern.Len();
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			TCHAR Char = Pattern[Index];
+			switch (Char)
+			{
+			case TEXT('\\'):
+				if (Index + 1 >= Len)
+				{
+					return FString();
+				}
+				Char = Pattern[++Index];
+				if (FChar::IsAlnum(Char))
+				{
+					// \d, \w, \b, back references, \x41, \p{L}...: not literal; skip their arguments
+					EndRun();
+					if (Index + 1 < Len && Pattern[Index + 1] == TEXT('{'))
+					{
+						while (Index + 1 < Len && Pattern[Index] != TEXT('}'))
+						{
+							++Index;
+						}
+					}
+					else
+					{
+						const int32 ArgLen = Char == TEXT('x') ? 2 : Char == TEXT('u') ? 4 : Char == TEXT('c') ? 1 : 0;
+						Index = FMath::Min(Index + ArgLen, Len - 1);
+						while (FChar::IsDigit(Char) && Index + 1 < Len && FChar::IsDigit(Pattern[Index + 1]))
+						{
+							++Index;
+						}
+					}
+					continue;
+				}
+				break;   // escaped punctuation is a literal character
+
+			case TEXT('['):
+				EndRun();
+				++Index;
+				if (Index < Len && Pattern[Index] == TEXT('^'))
+				{
+					++Index;
+				}
+				if (Index < Len && Pattern[Index] == TEXT(']'))
+				{
+					++Index;
+				}
+				for (; Index < Len && Pattern[Index] != TEXT(']'); ++Index)
+				{
+					if (Pattern[Index] == TEXT('\\'))
+					{
+						++Index;
+					}
+				}
+				continue;
+
+			case TEXT('('):
+				EndRun();
+				++Depth;
+				continue;
+
+			case TEXT(')'):
+				EndRun();
+				--Depth;
+				continue;
+
+			case TEXT('?'):
+			case TEXT('*'):
+			case TEXT('{'):
+				Run.LeftChopInline(1);
+				EndRun();
+				if (Char == TEXT('{'))
+				{
+					while (Index + 1 < Len && Pattern[Index] != TEXT('}'))
+					{
+						++Index;
+					}
+				}
+				continue;
+
+			case TEXT('+'):
+			case TEXT('.'):
+			case TEXT('^'):
+			case TEXT('$'):
+				EndRun();
+				continue;
+
+			default:
+				break;
+			}
+
+			// Char is literal. Inside groups it may be optional; without case
+			// sensitivity only ASCII folds the same way in both engines.
+			if (Depth > 0 || (!bCaseSensitive && Char > 127))
+			{
+				EndRun();
+				continue;
+			}
+			Run.AppendChar(Char);
+		}
+		EndRun();
+		return Best;
+	}
+
+	static bool MatchesAny(const TArray<FString>& Wildcards, const FString& RelativePath)
+	{
+		for (const FString& Wildcard : Wildcards)
+		{
+			const bool bPathWildcard = Wildcard.Contains(TEXT("/"));
+			const FString Subject = bPathWildcard ? RelativePath : FPaths::GetCleanFilename(RelativePath);
+			if (Subject.MatchesWildcard(Wildcard, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static int32 CountChars(const uint8* Begin, const uint8* End)
+	{
+		int32 Count = 0;
+		for (const uint8* Pos = Begin; Pos < End; ++Pos)
+		{
+			Count += FMCPSourceFiles::IsUtf8Continuation(*Pos) ? 0 : 1;
+		}
+		return Count;
+	}
+
+	static FString LineText(const uint8* Data, int64 Size, const TArray<int64>& LineStarts, int32 LineIndex)
+	{
+		const int64 Begin = LineStarts[LineIndex];
+		int64 End = LineStarts.IsValidIndex(LineIndex + 1) ? LineStarts[LineIndex + 1] : Size;
+		if (End > Begin && Data[End - 1] == '\n')
+		{
+			--End;
+		}
+		if (End > Begin && Data[End - 1] == '\r')
+		{
+			--End;
+		}
+		if (End - Begin > MaxLineBytes)
+		{
+			End = Begin + MaxLineBytes;
+			while (End > Begin && FMCPSourceFiles::IsUtf8Continuation(Data[End]))
+			{
+				--End;
+			}
+		}
+		return FMCPSourceFiles::Utf8ToString(Data + Begin, End - Begin);
+	}
+
+	/** Search one file; Regex is compiled on first use and reused by the calling task. */
+	static void SearchFile(const FString& Path, const FString& RelativePath, const FMCPSourceSearchOptions& Options,
+		const FLiteral& Prefilter, const FString& RegexSource, TUniquePtr<FRegexPattern>& Regex,
+		TArray<FMCPSourceMatch>& OutMatches)
+	{
+		FMCPFileView View;
+		FString Error;
+		if (!View.Open(Path, Error) || View.GetSize() == 0)
+		{
+			return;
+		}
+
+		const uint8* Data = View.GetData();
+		const int64 Size = View.GetSize();
+		const int64 TextStart = View.GetTextStart();
+		const uint8* FirstHit = Find(Data + TextStart, Data + Size, Prefilter);
+		if (!FirstHit)
+		{
+			return;   // the common case: the file cannot match
+		}
+
+		// Candidate file: index its lines
+		TArray<int64> LineStarts;
+		LineStarts.Add(TextStart);
+		for (const uint8* Pos = Data + TextStart; Pos < Data + Size;)
+		{
+			const uint8* Newline = static_cast<const uint8*>(memchr(Pos, '\n', (Data + Size) - Pos));
+			if (!Newline || Newline + 1 == Data + Size)
+			{
+				break;
+			}
+			Pos = Newline + 1;
+			LineStarts.Add(Pos - Data);
+		}
+
+		// (line index, column); one entry per line
+		const int32 Limit = Options.MaxPerFile > 0 ? Options.MaxPerFile : MAX_int32;
+		TArray<TPair<int32, int32>> Hits;
+
+		if (!Options.bRegex)
+		{
+			for (const uint8* Pos = FirstHit; Pos && Hits.Num() < Limit;)
+			{
+				const int32 LineIndex = Algo::UpperBound(LineStarts, static_cast<int64>(Pos - Data)) - 1;
+				Hits.Emplace(LineIndex, CountChars(Data + LineStarts[LineIndex], Pos) + 1);
+				if (!LineStarts.IsValidIndex(LineIndex + 1))
+				{
+					break;
+				}
+				Pos = Find(Data + LineStarts[LineIndex + 1], Data + Size, Prefilter);
+			}
+		}
+		else
+		{
+			if (!Regex)
+			{
+				Regex = MakeUnique<FRegexPattern>(RegexSource);
+			}
+			const FString Text = FMCPSourceFiles::Utf8ToString(Data + TextStart, Size - TextStart);
+			FRegexMatcher Matcher(*Regex, Text);
+			int32 LineIndex = 0;
+			int32 LineStartIndex = 0;
+			int32 Scanned = 0;
+			while (Hits.Num() < Limit && Matcher.FindNext())
+			{
+				const int32 MatchBegin = Matcher.GetMatchBeginning();
+				for (; Scanned < MatchBegin; ++Scanned)
+				{
+					if (Text[Scanned] == TEXT('\n'))
+					{
+						++LineIndex;
+						LineStartIndex = Scanned + 1;
+					}
+				}
+				if (!LineStarts.IsValidIndex(LineIndex))
+				{
+					break;   // an empty match after the final newline
+				}
+				if (Hits.Num() == 0 || Hits.Last().Key != LineIndex)
+				{
+					Hits.Emplace(LineIndex, MatchBegin - LineStartIndex + 1);
+				}
+			}
+		}
+
+		const int32 ContextLines = FMath::Max(0, Options.ContextLines);
+		for (const TPair<int32, int32>& Hit : Hits)
+		{
+			FMCPSourceMatch& Match = OutMatches.AddDefaulted_GetRef();
+			Match.File = RelativePath;
+			Match.Line = Hit.Key + 1;
+			Match.Column = Hit.Value;
+			Match.Text = LineText(Data, Size, LineStarts, Hit.Key);
+			for (int32 Line = FMath::Max(0, Hit.Key - ContextLines); Line < Hit.Key; ++Line)
+			{
+				Match.Before.Add(LineText(Data, Size, LineStarts, Line));
+			}
+			const int32 LastAfter = FMath::Min(LineStarts.Num() - 1, Hit.Key + ContextLines);
+			for (int32 Line = Hit.Key + 1; Line <= LastAfter; ++Line)
+			{
+				Match.After.Add(LineText(Data, Size, LineStarts, Line));
+			}
+		}
+	}
+}
+
+TArray<FString> FMCPSourceFiles::GetSourceRoots(bool bIncludePlugins)
+{
+	TArray<FString> Roots;
+	Roots.Add(FPaths::ConvertRelativePathToFull(FPaths::GameSourceDir()));
+	if (bIncludePlugins)
+	{
+		for (const TSharedRef<IPlugin>& Plugin : IPluginManager::Get().GetDiscoveredPlugins())
+		{
+			if (Plugin->GetLoadedFrom() != EPluginLoadedFrom::Project)
+			{
+				continue;
+			}
+			const FString PluginSource = FPaths::ConvertRelativePathToFull(Plugin->GetBaseDir() / TEXT("Source"));
+			if (FPaths::DirectoryExists(PluginSource))
+			{
+				Roots.Add(PluginSource);
+			}
+		}
+	}
+	return Roots;
+}
+
+void FMCPSourceFiles::Search(const FMCPSourceSearchOptions& Options, FMCPSourceSearchResult& OutResult)
+{
+	using namespace MCPSourceSearch;
+
+	OutResult = FMCPSourceSearchResult();
+	if (Options.Pattern.IsEmpty())
+	{
+		return;
+	}
+
+	static const TArray<FString> DefaultInclude = {
+		TEXT("*.h"), TEXT("*.hpp"), TEXT("*.inl"), TEXT("*.c"), TEXT("*.cc"), TEXT("*.cpp"), TEXT("*.cs")
+	};
+	const TArray<FString>& Include = Options.Include.Num() > 0 ? Options.Include : DefaultInclude;
+	const FString ProjectDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+
+	TArray<FString> Files;
+	TArray<FString> RelativeFiles;
+	TSet<FString> Seen;
+	for (const FString& Root : Options.Roots)
+	{
+		TArray<FString> Found;
+		IFileManager::Get().FindFilesRecursive(Found, *Root, TEXT("*"), true, false);
+		for (FString& File : Found)
+		{
+			FString RelativePath = File;
+			FPaths::MakePathRelativeTo(RelativePath, *ProjectDir);
+			if (!MatchesAny(Include, RelativePath) || MatchesAny(Options.Exclude, RelativePath))
+			{
+				continue;
+			}
+			bool bAlreadySeen = false;
+			Seen.Add(File, &bAlreadySeen);
+			if (!bAlreadySeen)
+			{
+				Files.Add(MoveTemp(File));
+				RelativeFiles.Add(MoveTemp(RelativePath));
+			}
+		}
+	}
+
+	const FLiteral Prefilter = MakeLiteral(
+		Options.bRegex ? ExtractRequiredLiteral(Options.Pattern, Options.bCaseSensitive) : Options.Pattern,
+		Options.bCaseSensitive);
+	// (?m): ^ and $ match at line boundaries, as they would in grep
+	const FString RegexSource = FString(TEXT("(?m)")) + (Options.bCaseSensitive ? TEXT("") : TEXT("(?i)")) + Options.Pattern;
+	const int32 MaxResults = Options.MaxResults > 0 ? Options.MaxResults : MAX_int32;
+
+	TArray<TArray<FMCPSourceMatch>> PerFile;
+	PerFile.SetNum(Files.Num());
+	std::atomic<int32> FilesSearched{0};
+
+	const int32 NumTasks = FMath::DivideAndRoundUp(Files.Num(), FilesPerTask);
+	// Matches found so far by each task; they only grow, so once the tasks before
+	// a file (and the files before it in the same task) hold MaxResults, that file
+	// cannot reach the merged result and is skipped. The kept matches are thus the
+	// same whichever tasks finish first.
+	TUniquePtr<std::atomic<int32>[]> TaskMatches(new std::atomic<int32>[NumTasks]);
+	for (int32 Task = 0; Task < NumTasks; ++Task)
+	{
+		TaskMatches[Task] = 0;
+	}
+
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		// FRegexPattern shares its compiled state through a non-thread-safe
+		// reference count, so every task compiles its own
+		TUniquePtr<FRegexPattern> Regex;
+		const int32 End = FMath::Min(Files.Num(), (Task + 1) * FilesPerTask);
+		for (int32 Index = Task * FilesPerTask; Index < End; ++Index)
+		{
+			int64 MatchesBefore = 0;
+			for (int32 Earlier = 0; Earlier <= Task && MatchesBefore < MaxResults; ++Earlier)
+			{
+				MatchesBefore += TaskMatches[Earlier].load(std::memory_order_relaxed);
+			}
+			if (MatchesBefore >= MaxResults)
+			{
+				return;
+			}
+			SearchFile(Files[Index], RelativeFiles[Index], Options, Prefilter, RegexSource, Regex, PerFile[Index]);
+			TaskMatches[Task] += PerFile[Index].Num();
+			++FilesSearched;
+		}
+	});
+
+	// Merge in file order so results are stable across runs
+	for (int32 Index = 0; Index < PerFile.Num(); ++Index)
+	{
+		TArray<FMCPSourceMatch>& Matches = PerFile[Index];
+		if (Matches.Num() == 0)
+		{
+			continue;
+		}
+		++OutResult.FilesMatched;
+		const int32 Room = MaxResults - OutResult.Matches.Num();
+		if (Matches.Num() > Room)
+		{
+			Matches.SetNum(Room);
+			OutResult.bTruncated = true;
+		}
+		OutResult.Matches.Append(MoveTemp(Matches));
+		if (OutResult.Matches.Num() >= MaxResults)
+		{
+			// Later files may or may not have been searched depending on timing;
+			// report the cut from the file list alone so the flag is stable too
+			OutResult.bTruncated |= Index < PerFile.Num() - 1;
+			break;
+		}
+	}
+	OutResult.FilesSearched = FilesSearched.load();
+}
+
+// ---------------------------------------------------------------------------
+// Editing
+// ---------------------------------------------------------------------------
+
+FMCPTextLines FMCPTextLines::Parse(const uint8* Data, int64 Size)
+{
+	FMCPTextLines Text;
+	int64 TextStart = 0;
+	if (Size >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+	{
+		Text.bBom = true;
+		TextStart = 3;
+	}
+	const FString Content = FMCPSourceFiles::Utf8ToString(Data + TextStart, Size - TextStart);
+
+	int32 FirstNewline = INDEX_NONE;
+	if (Content.FindChar(TEXT('\n'), FirstNewline))
+	{
+		Text.bCRLF = FirstNewline > 0 && Content[FirstNewline - 1] == TEXT('\r');
+	}
+	Text.bTrailingNewline = Content.IsEmpty() || Content.EndsWith(TEXT("\n"));
+	Text.Lines = SplitLines(Content);
+	return Text;
+}
+
+TArray<FString> FMCPTextLines::SplitLines(const FString& Text)
+{
+	TArray<FString> Lines;
+	int32 LineStart = 0;
+	const int32 Len = Text.Len();
+	for (int32 Index = 0; Index <= Len; ++Index)
+	{
+		if (Index == Len || Text[Index] == TEXT('\n'))
+		{
+			if (Index == Len && LineStart == Len)
+			{
+				break;   // no line after the final line break
+			}
+			int32 LineEnd = Index;
+			if (LineEnd > LineStart && Text[LineEnd - 1] == TEXT('\r'))
+			{
+				--LineEnd;
+			}
+			Lines.Add(Text.Mid(LineStart, LineEnd - LineStart));
+			LineStart = Index + 1;
+		}
+	}
+	return Lines;
+}
+
+TArray<uint8> FMCPTextLines::ToBytes() const
+{
+	const TCHAR* LineEnd = bCRLF ? TEXT("\r\n") : TEXT("\n");
+	FString Content = FString::Join(Lines, LineEnd);
+	if (bTrailingNewline && Lines.Num() > 0)
+	{
+		Content += LineEnd;
+	}
+
+	TArray<uint8> Bytes;
+	if (bBom)
+	{
+		Bytes.Append({ 0xEF, 0xBB, 0xBF });
+	}
+	const FTCHARToUTF8 Utf8(*Content);
+	Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	return Bytes;
+}
+
+namespace MCPSourceEdit
+{
+	struct FHunk
+	{
+		/** 0-based line index the hunk's old lines are expected to start at. */
+		int32 Hint = 0;
+		TArray<FString> OldLines;
+		TArray<FString> NewLines;
+		bool bOldNoNewline = false;
+		bool bNewNoNewline = false;
+	};
+
+	/** "@@ -12,5 +12,7 @@ context" -> Hint. */
+	static bool ParseHunkHeader(const FString& Line, FHunk& OutHunk)
+	{
+		int32 Minus = INDEX_NONE;
+		if (!Line.FindChar(TEXT('-'), Minus))
+		{
+			return false;
+		}
+		int32 Index = Minus + 1;
+		int32 Start = 0;
+		while (Index < Line.Len() && FChar::IsDigit(Line[Index]))
+		{
+			Start = Start * 10 + (Line[Index++] - TEXT('0'));
+		}
+		int32 Count = 1;
+		if (Index < Line.Len() && Line[Index] == TEXT(','))
+		{
+			Count = 0;
+			++Index;
+			while (Index < Line.Len() && FChar::IsDigit(Line[Index]))
+			{
+				Count = Count * 10 + (Line[Index++] - TEXT('0'));
+			}
+		}
+		// "-12,0" inserts after line 12; otherwise the hunk starts at line 12
+		OutHunk.Hint = Count == 0 ? Start : FMath::Max(0, Start - 1);
+		return true;
+	}
+
+	static bool ParsePatch(const FString& Patch, TArray<FHunk>& OutHunks, FString& OutError)
+	{
+		const TArray<FString> PatchLines = FMCPTextLines::SplitLines(Patch);
+		FHunk* Hunk = nullptr;
+		TCHAR LastKind = 0;
+		for (int32 Index = 0; Index < PatchLines.Num(); ++Index)
+		{
+			const FString& Line = PatchLines[Index];
+			if (Line.StartsWith(TEXT("@@")))
+			{
+				Hunk = &OutHunks.AddDefaulted_GetRef();
+				if (!ParseHunkHeader(Line, *Hunk))
+				{
+					OutError = FString::Printf(TEXT("Malformed hunk header: %s"), *Line);
+					return false;
+				}
+				LastKind = 0;
+				continue;
+			}
+
+			// File headers end the current hunk ("--- a/x" followed by "+++ b/x")
+			const bool bFileHeader = Line.StartsWith(TEXT("diff ")) || Line.StartsWith(TEXT("index "))
+				|| (Line.StartsWith(TEXT("--- ")) && PatchLines.IsValidIndex(Index + 1) && PatchLines[Index + 1].StartsWith(TEXT("+++ ")))
+				|| (Line.StartsWith(TEXT("+++ ")) && Index > 0 && PatchLines[Index - 1].StartsWith(TEXT("--- ")));
+			if (bFileHeader)
+			{
+				Hunk = nullptr;
+				continue;
+			}
+			if (!Hunk)
+			{
+				continue;   // preamble
+			}
+
+			const TCHAR Kind = Line.IsEmpty() ? TEXT(' ') : Line[0];
+			const FString Body = Line.IsEmpty() ? FString() : Line.Mid(1);
+			switch (Kind)
+			{
+			case TEXT(' '):
+				Hunk->OldLines.Add(Body);
+				Hunk->NewLines.Add(Body);
+				break;
+			case TEXT('-'):
+				Hunk->OldLines.Add(Body);
+				break;
+			case TEXT('+'):
+				Hunk->NewLines.Add(Body);
+				break;
+			case TEXT('\\'):
+				// "\ No newline at end of file" applies to the line before it
+				if (LastKind != TEXT('+'))
+				{
+					Hunk->bOldNoNewline = true;
+				}
+				if (LastKind != TEXT('-'))
+				{
+					Hunk->bNewNoNewline = true;
+				}
+				break;
+			default:
+				OutError = FString::Printf(TEXT("Unexpected line in hunk %d: %s"), OutHunks.Num(), *Line);
+				return false;
+			}
+			LastKind = Kind;
+		}
+
+		if (OutHunks.Num() == 0)
+		{
+			OutError = TEXT("Patch contains no hunks");
+			return false;
+		}
+		return true;
+	}
+
+	static bool LinesMatchAt(const TArray<FString>& Lines, int32 Pos, const TArray<FString>& Expected)
+	{
+		for (int32 Index = 0; Index < Expected.Num(); ++Index)
+		{
+			if (!Lines[Pos + Index].Equals(Expected[Index], ESearchCase::CaseSensitive))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+bool FMCPSourceFiles::ApplyUnifiedDiff(FMCPTextLines& Text, const FString& Patch, int32& OutHunks, FString& OutError)
+{
+	using namespace MCPSourceEdit;
+
+	TArray<FHunk> Hunks;
+	if (!ParsePatch(Patch, Hunks, OutError))
+	{
+		return false;
+	}
+
+	const TArray<FString>& Lines = Text.Lines;
+	TArray<FString> Result;
+	Result.Reserve(Lines.Num());
+	int32 Cursor = 0;
+	for (int32 HunkIndex = 0; HunkIndex < Hunks.Num(); ++HunkIndex)
+	{
+		const FHunk& Hunk = Hunks[HunkIndex];
+		const int32 LastStart = Lines.Num() - Hunk.OldLines.Num();
+		const int32 Hint = FMath::Clamp(Hunk.Hint, Cursor, FMath::Max(Cursor, LastStart));
+
+		// Nearest exact match to the hinted line, never before the previous hunk
+		int32 Found = INDEX_NONE;
+		for (int32 Distance = 0; Found == INDEX_NONE; ++Distance)
+		{
+			const int32 Below = Hint + Distance;
+			const int32 Above = Hint - Distance;
+			const bool bBelowValid = Below <= LastStart;
+			const bool bAboveValid = Distance > 0 && Above >= Cursor && Above <= LastStart;
+			if (!bBelowValid && !bAboveValid)
+			{
+				break;
+			}
+			if (bBelowValid && LinesMatchAt(Lines, Below, Hunk.OldLines))
+			{
+				Found = Below;
+			}
+			else if (bAboveValid && LinesMatchAt(Lines, Above, Hunk.OldLines))
+			{
+				Found = Above;
+			}
+		}
+		if (Found == INDEX_NONE)
+		{
+			OutError = FString::Printf(TEXT("Hunk %d does not apply near line %d: its context / removed lines were not found"),
+				HunkIndex + 1, Hunk.Hint + 1);
+			if (Hunk.OldLines.Num() > 0)
+			{
+				OutError += FString::Printf(TEXT(" (first line: \"%s\")"), *Hunk.OldLines[0]);
+			}
+			return false;
+		}
+
+		for (; Cursor < Found; ++Cursor)
+		{
+			Result.Add(Lines[Cursor]);
+		}
+		Result.Append(Hunk.NewLines);
+		Cursor = Found + Hunk.OldLines.Num();
+
+		if (Cursor == Lines.Num() && (Hunk.bOldNoNewline || Hunk.bNewNoNewline))
+		{
+			Text.bTrailingNewline = !Hunk.bNewNoNewline;
+		}
+	}
+	for (; Cursor < Lines.Num(); ++Cursor)
+	{
+		Result.Add(Lines[Cursor]);
+	}
+
+	Text.Lines = MoveTemp(Result);
+	OutHunks = Hunks.Num();
+	return true;
+}
+
+bool FMCPSourceFiles::ApplyLineEdits(FMCPTextLines& Text, TArray<FMCPLineEdit> Edits, FString& OutError)
+{
+	const int32 NumLines = Text.Lines.Num();
+	Edits.StableSort([](const FMCPLineEdit& A, const FMCPLineEdit& B) { return A.StartLine < B.StartLine; });
+
+	int32 PreviousEnd = 0;
+	for (const FMCPLineEdit& Edit : Edits)
+	{
+		if (Edit.StartLine < 1 || Edit.StartLine > NumLines + 1 || Edit.EndLine < Edit.StartLine - 1 || Edit.EndLine > NumLines)
+		{
+			OutError = FString::Printf(TEXT("Edit %d-%d is outside the file (%d lines)"), Edit.StartLine, Edit.EndLine, NumLines);
+			return false;
+		}
+		if (Edit.StartLine <= PreviousEnd)
+		{
+			OutError = FString::Printf(TEXT("Edit %d-%d overlaps the previous edit"), Edit.StartLine, Edit.EndLine);
+			return false;
+		}
+		PreviousEnd = Edit.EndLine;
+	}
+
+	TArray<FString> Result;
+	Result.Reserve(NumLines);
+	int32 Cursor = 0;   // 0-based index of the next original line to copy
+	for (const FMCPLineEdit& Edit : Edits)
+	{
+		for (; Cursor < Edit.StartLine - 1; ++Cursor)
+		{
+			Result.Add(Text.Lines[Cursor]);
+		}
+		Result.Append(Edit.NewLines);
+		Cursor = FMath::Max(Cursor, Edit.EndLine);
+	}
+	for (; Cursor < NumLines; ++Cursor)
+	{
+		Result.Add(Text.Lines[Cursor]);
+	}
+	Text.Lines = MoveTemp(Result);
+	return true;
+}
+
+bool FMCPSourceFiles::WriteFileAtomically(const FString& Path, const TArray<uint8>& Bytes, FString& OutError)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+
+	// Same directory, so the rename never crosses volumes
+	const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *Path, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+	{
+		OutError = FString::Printf(TEXT("Failed to write temporary file: %s"), *TempPath);
+		return false;
+	}
+
+#if PLATFORM_WINDOWS
+	// MoveFileW refuses to replace; MoveFileEx does so in one step
+	const bool bMoved = ::MoveFileExW(*TempPath, *Path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	// rename() replaces the destination atomically
+	const bool bMoved = PlatformFile.MoveFile(*Path, *TempPath);
+#endif
+	if (!bMoved)
+	{
+		PlatformFile.DeleteFile(*TempPath);
+		OutError = FString::Printf(TEXT("Failed to replace %s (is it read-only or locked?)"), *Path);
+		return false;
+	}
+	return true;
+}
+
+FString FMCPSourceFiles::GetBackupPath(const FString& Hash)
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("MCPSourceBackups") / Hash + TEXT(".bak"));
+}
+
+FString FMCPSourceFiles::StoreBackup(const uint8* Data, int64 Size, const FString& Hash)
+{
+	const FString BackupPath = GetBackupPath(Hash);
+	if (IFileManager::Get().FileSize(*BackupPath) == Size)
+	{
+		return BackupPath;   // this exact content is already backed up
+	}
+
+	TArray<uint8> Bytes(Data, static_cast<int32>(Size));
+	FString Error;
+	return WriteFileAtomically(BackupPath, Bytes, Error) ? BackupPath : FString();
+}
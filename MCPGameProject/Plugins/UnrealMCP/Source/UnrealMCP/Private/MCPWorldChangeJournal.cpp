@@ -0,0 +1,305 @@
+#include "MCPWorldChangeJournal.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+static const TCHAR* ChangeTypeToString(EMCPWorldChangeType Type)
+{
+	switch (Type)
+	{
+	case EMCPWorldChangeType::Added:            return TEXT("added");
+	case EMCPWorldChangeType::Removed:          return TEXT("removed");
+	case EMCPWorldChangeType::TransformChanged: return TEXT("transform_changed");
+	case EMCPWorldChangeType::PropertyChanged:  return TEXT("property_changed");
+	case EMCPWorldChangeType::Renamed:          return TEXT("renamed");
+	}
+	return TEXT("unknown");
+}
+
+/** Only the editor world is journaled; PIE and preview worlds are ignored. */
+static bool IsJournaledWorld(const UWorld* World)
+{
+	return World && World->WorldType == EWorldType::Editor;
+}
+
+FMCPWorldChangeJournal::FMCPWorldChangeJournal(int32 InCapacity)
+	: Capacity(FMath::Max(InCapacity, 16))
+{
+}
+
+FMCPWorldChangeJournal::~FMCPWorldChangeJournal()
+{
+	Stop();
+}
+
+void FMCPWorldChangeJournal::Start()
+{
+	if (bStarted || !GEngine)
+	{
+		return;
+	}
+	bStarted = true;
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPWorldChangeJournal::OnActorAdded);
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPWorldChangeJournal::OnActorDeleted);
+	ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPWorldChangeJournal::OnActorMoved);
+	ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPWorldChangeJournal::OnActorLabelChanged);
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPWorldChangeJournal::OnObjectPropertyChanged);
+	PostUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPWorldChangeJournal::OnPostUndoRedo);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FMCPWorldChangeJournal::OnWorldCleanup);
+}
+
+void FMCPWorldChangeJournal::Stop()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+	bStarted = false;
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	FEditorDelegates::PostUndoRedo.Remove(PostUndoRedoHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	Journals.Empty();
+}
+
+void FMCPWorldChangeJournal::RegisterCommands(FMCPCommandRegistry& Registry)
+{
+	Registry.RegisterCommand(TEXT("get_world_changes_since"),
+		[this](const TSharedPtr<FJsonObject>& P) { return HandleGetWorldChangesSince(P); });
+}
+
+uint64 FMCPWorldChangeJournal::GetRevision(const UWorld* World) const
+{
+	const FWorldJournal* Journal = World ? Journals.Find(FObjectKey(World)) : nullptr;
+	return Journal ? Journal->Revision : 0;
+}
+
+uint64 FMCPWorldChangeJournal::GetActorRevision(const AActor* Actor) const
+{
+	const FWorldJournal* Journal = Actor ? Journals.Find(FObjectKey(Actor->GetWorld())) : nullptr;
+	if (!Journal)
+	{
+		return 0;
+	}
+	const uint64* ActorRevision = Journal->ActorRevisions.Find(FObjectKey(Actor));
+	return FMath::Max(ActorRevision ? *ActorRevision : 0, Journal->ResetRevision);
+}
+
+FMCPWorldChangeJournal::FWorldJournal* FMCPWorldChangeJournal::FindJournal(const UWorld* World)
+{
+	if (!IsJournaledWorld(World))
+	{
+		return nullptr;
+	}
+	FWorldJournal& Journal = Journals.FindOrAdd(FObjectKey(World));
+	if (Journal.Ring.Num() != Capacity)
+	{
+		Journal.Ring.SetNum(Capacity);
+	}
+	return &Journal;
+}
+
+void FMCPWorldChangeJournal::Record(AActor* Actor, EMCPWorldChangeType Type, const FString& Detail)
+{
+	if (!Actor || Actor->IsTemplate())
+	{
+		return;
+	}
+	FWorldJournal* Journal = FindJournal(Actor->GetWorld());
+	if (!Journal)
+	{
+		return;
+	}
+
+	const uint64 Revision = ++Journal->Revision;
+	FChange& Slot = Journal->Ring[Revision % Capacity];
+	Slot.Revision = Revision;
+	Slot.Type = Type;
+	Slot.ActorName = Actor->GetFName();
+	Slot.Detail = Detail;
+	Slot.Actor = Actor;
+	Journal->ActorRevisions.Add(FObjectKey(Actor), Revision);
+
+	// Once the ring is full each write evicts the oldest entry.
+	if (Revision - Journal->FirstRetained >= static_cast<uint64>(Capacity))
+	{
+		Journal->FirstRetained = Revision - Capacity + 1;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Delegate handlers
+// ---------------------------------------------------------------------------
+
+void FMCPWorldChangeJournal::OnActorAdded(AActor* Actor)
+{
+	Record(Actor, EMCPWorldChangeType::Added);
+}
+
+void FMCPWorldChangeJournal::OnActorDeleted(AActor* Actor)
+{
+	Record(Actor, EMCPWorldChangeType::Removed);
+}
+
+void FMCPWorldChangeJournal::OnActorMoved(AActor* Actor)
+{
+	Record(Actor, EMCPWorldChangeType::TransformChanged);
+}
+
+void FMCPWorldChangeJournal::OnActorLabelChanged(AActor* Actor)
+{
+	Record(Actor, EMCPWorldChangeType::Renamed, Actor ? Actor->GetActorLabel() : FString());
+}
+
+void FMCPWorldChangeJournal::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	if (!Object || Object->IsTemplate())
+	{
+		return;
+	}
+
+	AActor* Actor = Cast<AActor>(Object);
+	if (!Actor)
+	{
+		if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+		{
+			Actor = Component->GetOwner();
+		}
+	}
+	if (!Actor)
+	{
+		return;
+	}
+
+	const FName PropertyName = Event.GetMemberPropertyName();
+	const bool bIsTransform =
+		PropertyName == USceneComponent::GetRelativeLocationPropertyName() ||
+		PropertyName == USceneComponent::GetRelativeRotationPropertyName() ||
+		PropertyName == USceneComponent::GetRelativeScale3DPropertyName();
+
+	Record(Actor,
+		bIsTransform ? EMCPWorldChangeType::TransformChanged : EMCPWorldChangeType::PropertyChanged,
+		PropertyName.ToString());
+}
+
+void FMCPWorldChangeJournal::OnPostUndoRedo()
+{
+	// Undo/redo can touch arbitrary actors without per-actor notifications, so the
+	// journal can no longer describe the delta: force every client onto a snapshot.
+	// The editor world may not have a journal yet if nothing was recorded since it loaded.
+	if (GEditor)
+	{
+		FindJournal(GEditor->GetEditorWorldContext().World());
+	}
+	for (TPair<FObjectKey, FWorldJournal>& Pair : Journals)
+	{
+		FWorldJournal& Journal = Pair.Value;
+		++Journal.Revision;
+		Journal.FirstRetained = Journal.Revision + 1;
+		Journal.ResetRevision = Journal.Revision;
+	}
+}
+
+void FMCPWorldChangeJournal::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (World)
+	{
+		Journals.Remove(FObjectKey(World));
+	}
+}
+
+// ---------------------------------------------------------------------------
+// get_world_changes_since
+// Params: revision (number, required; 0 = no client state), epoch (string, optional)
+// Returns the changes after 'revision', or a full snapshot ("snapshot": true)
+// when the journal has wrapped, was reset by undo, or the epoch differs
+// (the world was reloaded since the client's last sync).
+// ---------------------------------------------------------------------------
+TSharedPtr<FJsonObject> FMCPWorldChangeJournal::HandleGetWorldChangesSince(const TSharedPtr<FJsonObject>& Params)
+{
+	double SinceValue = 0.0;
+	if (!Params->TryGetNumberField(TEXT("revision"), SinceValue))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'revision' parameter"));
+	}
+	const uint64 Since = static_cast<uint64>(FMath::Max(SinceValue, 0.0));
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	FWorldJournal* Journal = FindJournal(World);
+	if (!Journal)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world available"));
+	}
+
+	FString ClientEpoch;
+	const bool bEpochMismatch = Params->TryGetStringField(TEXT("epoch"), ClientEpoch)
+		&& !ClientEpoch.IsEmpty() && ClientEpoch != Journal->Epoch.ToString();
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("world"), World->GetOutermost()->GetName());
+	Result->SetStringField(TEXT("epoch"), Journal->Epoch.ToString());
+	Result->SetNumberField(TEXT("revision"), static_cast<double>(Journal->Revision));
+
+	const bool bNeedsSnapshot = bEpochMismatch || Since > Journal->Revision
+		|| Since + 1 < Journal->FirstRetained;
+	if (bNeedsSnapshot)
+	{
+		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			if (*It)
+			{
+				ActorArray.Add(FUnrealMCPCommonUtils::ActorToJson(*It));
+			}
+		}
+		Result->SetBoolField(TEXT("snapshot"), true);
+		Result->SetArrayField(TEXT("actors"), ActorArray);
+		return Result;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Changes;
+	for (uint64 Revision = Since + 1; Revision <= Journal->Revision; ++Revision)
+	{
+		const FChange& Change = Journal->Ring[Revision % Capacity];
+		if (Change.Revision != Revision)
+		{
+			continue;   // revision consumed by an undo/redo reset
+		}
+
+		TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetNumberField(TEXT("revision"), static_cast<double>(Change.Revision));
+		Entry->SetStringField(TEXT("type"), ChangeTypeToString(Change.Type));
+		Entry->SetStringField(TEXT("name"), Change.ActorName.ToString());
+		if (!Change.Detail.IsEmpty())
+		{
+			Entry->SetStringField(Change.Type == EMCPWorldChangeType::Renamed ? TEXT("label") : TEXT("property"),
+				Change.Detail);
+		}
+
+		// Attach the current transform so a mirror can apply the change without a follow-up read.
+		AActor* Actor = Change.Actor.Get();
+		if (Actor && (Change.Type == EMCPWorldChangeType::Added || Change.Type == EMCPWorldChangeType::TransformChanged))
+		{
+			Entry->SetObjectField(TEXT("actor"), FUnrealMCPCommonUtils::ActorToJsonObject(Actor));
+		}
+		Changes.Add(MakeShared<FJsonValueObject>(Entry));
+	}
+
+	Result->SetBoolField(TEXT("snapshot"), false);
+	Result->SetArrayField(TEXT("changes"), Changes);
+	return Result;
+}
@@ -0,0 +1,380 @@
+#include "UnrealMCPBatchCommandlet.h"
+#include "UnrealMCPBridge.h"
+#include "Editor.h"
+#include "FileHelpers.h"
+#include "Engine/World.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#if ENGINE_MAJOR_VERSION >= 5
+#include "AssetRegistry/AssetRegistryModule.h"
+#else
+#include "AssetRegistryModule.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogUnrealMCPBatch, Log, All);
+
+static bool WriteJsonFile(const TSharedPtr<FJsonObject>& Json, const FString& Path)
+{
+	FString Text;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Text);
+	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
+	return FFileHelper::SaveStringToFile(Text, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+static TSharedPtr<FJsonObject> ReadJsonFile(const FString& Path)
+{
+	FString Text;
+	TSharedPtr<FJsonObject> Json;
+	if (FFileHelper::LoadFileToString(Text, *Path))
+	{
+		FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Json);
+	}
+	return Json;
+}
+
+/** Drop the dirty flag on everything the script touched, so the next map load neither prompts nor saves. */
+static void DiscardDirtyPackages()
+{
+	TArray<UPackage*> DirtyPackages;
+	FEditorFileUtils::GetDirtyWorldPackages(DirtyPackages);
+	FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+	for (UPackage* Package : DirtyPackages)
+	{
+		Package->SetDirtyFlag(false);
+	}
+}
+
+UUnrealMCPBatchCommandlet::UUnrealMCPBatchCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UUnrealMCPBatchCommandlet::Main(const FString& Params)
+{
+	FString ScriptPath;
+	if (!FParse::Value(*Params, TEXT("script="), ScriptPath))
+	{
+		UE_LOG(LogUnrealMCPBatch, Error, TEXT("Missing -script=<ops.json>"));
+		return 1;
+	}
+	ScriptPath = FPaths::ConvertRelativePathToFull(ScriptPath);
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("MCPBatch/Result.json");
+	FParse::Value(*Params, TEXT("output="), OutputPath);
+	OutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
+
+	int32 ShardCount = 1;
+	FParse::Value(*Params, TEXT("shards="), ShardCount);
+
+	TArray<FString> Maps;
+	FString Error;
+	if (!GatherMaps(Params, Maps, Error))
+	{
+		UE_LOG(LogUnrealMCPBatch, Error, TEXT("%s"), *Error);
+		return 1;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	TSharedPtr<FJsonObject> Result;
+
+	ShardCount = FMath::Clamp(ShardCount, 1, Maps.Num());
+	if (ShardCount > 1)
+	{
+		Result = RunSharded(ScriptPath, Maps, ShardCount, FPaths::GetPath(OutputPath));
+	}
+	else
+	{
+		TSharedPtr<FJsonObject> Script = ReadJsonFile(ScriptPath);
+		TArray<TSharedPtr<FJsonValue>> Commands;
+		bool bSave = false;
+		if (Script)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* CommandArray = nullptr;
+			if (Script->TryGetArrayField(TEXT("commands"), CommandArray))
+			{
+				Commands = *CommandArray;
+			}
+			Script->TryGetBoolField(TEXT("save"), bSave);
+		}
+		else
+		{
+			// A bare array of commands: wrap it so the JSON reader accepts it
+			FString Text;
+			FFileHelper::LoadFileToString(Text, *ScriptPath);
+			TSharedPtr<FJsonObject> Wrapped;
+			if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(TEXT("{\"commands\":") + Text + TEXT("}")), Wrapped))
+			{
+				Commands = Wrapped->GetArrayField(TEXT("commands"));
+			}
+		}
+		if (Commands.Num() == 0)
+		{
+			UE_LOG(LogUnrealMCPBatch, Error, TEXT("Script '%s' has no commands"), *ScriptPath);
+			return 1;
+		}
+
+		UUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UUnrealMCPBridge>() : nullptr;
+		if (!Bridge)
+		{
+			UE_LOG(LogUnrealMCPBatch, Error, TEXT("UnrealMCPBridge subsystem not available"));
+			return 1;
+		}
+		Result = RunMaps(Bridge, Maps, Commands, bSave);
+	}
+
+	Result->SetNumberField(TEXT("elapsed_ms"), FMath::RoundToInt((FPlatformTime::Seconds() - StartTime) * 1000.0));
+	if (!WriteJsonFile(Result, OutputPath))
+	{
+		UE_LOG(LogUnrealMCPBatch, Error, TEXT("Failed to write '%s'"), *OutputPath);
+		return 1;
+	}
+
+	const int32 FailedMaps = static_cast<int32>(Result->GetNumberField(TEXT("failed_maps")));
+	UE_LOG(LogUnrealMCPBatch, Display, TEXT("%d maps processed (%d failed), results in %s"),
+		Maps.Num(), FailedMaps, *OutputPath);
+	return FailedMaps > 0 ? 2 : 0;
+}
+
+bool UUnrealMCPBatchCommandlet::GatherMaps(const FString& Params, TArray<FString>& OutMaps, FString& OutError)
+{
+	FString MapList;
+	FString MapsFile;
+	FString MapPath;
+	if (FParse::Value(*Params, TEXT("maps="), MapList, /*bShouldStopOnSeparator=*/false))
+	{
+		MapList.ParseIntoArray(OutMaps, TEXT(","), /*InCullEmpty=*/true);
+	}
+	else if (FParse::Value(*Params, TEXT("mapsfile="), MapsFile))
+	{
+		if (!FFileHelper::LoadFileToStringArray(OutMaps, *MapsFile))
+		{
+			OutError = FString::Printf(TEXT("Cannot read maps file '%s'"), *MapsFile);
+			return false;
+		}
+	}
+	else
+	{
+		MapPath = TEXT("/Game");
+		FParse::Value(*Params, TEXT("mappath="), MapPath);
+
+		// Commandlets do not scan the registry in the background; wait for a full scan once
+		IAssetRegistry& AssetRegistry =
+			FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.SearchAllAssets(/*bSynchronousSearch=*/true);
+
+		FARFilter Filter;
+#if ENGINE_MAJOR_VERSION >= 5
+		Filter.ClassPaths.Add(UWorld::StaticClass()->GetClassPathName());
+#else
+		Filter.ClassNames.Add(UWorld::StaticClass()->GetFName());
+#endif
+		Filter.PackagePaths.Add(FName(*MapPath));
+		Filter.bRecursivePaths = true;
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssets(Filter, Assets);
+		for (const FAssetData& Asset : Assets)
+		{
+			OutMaps.Add(Asset.PackageName.ToString());
+		}
+	}
+
+	for (FString& Map : OutMaps)
+	{
+		Map.TrimStartAndEndInline();
+	}
+	OutMaps.RemoveAll([](const FString& Map) { return Map.IsEmpty(); });
+	OutMaps.Sort();
+
+	if (OutMaps.Num() == 0)
+	{
+		OutError = MapPath.IsEmpty() ? TEXT("No maps given") : FString::Printf(TEXT("No maps found under '%s'"), *MapPath);
+		return false;
+	}
+	return true;
+}
+
+TSharedPtr<FJsonObject> UUnrealMCPBatchCommandlet::RunMaps(UUnrealMCPBridge* Bridge, const TArray<FString>& Maps,
+	const TArray<TSharedPtr<FJsonValue>>& Commands, bool bSave)
+{
+	TArray<TSharedPtr<FJsonValue>> MapResults;
+	int32 FailedMaps = 0;
+
+	for (int32 MapIndex = 0; MapIndex < Maps.Num(); ++MapIndex)
+	{
+		const FString& Map = Maps[MapIndex];
+		UE_LOG(LogUnrealMCPBatch, Display, TEXT("[%d/%d] %s"), MapIndex + 1, Maps.Num(), *Map);
+
+		TSharedPtr<FJsonObject> MapResult = MakeShared<FJsonObject>();
+		MapResult->SetStringField(TEXT("map"), Map);
+
+		const double LoadStart = FPlatformTime::Seconds();
+		UWorld* World = UEditorLoadingAndSavingUtils::LoadMap(Map);
+		const double OpsStart = FPlatformTime::Seconds();
+		MapResult->SetNumberField(TEXT("load_ms"), FMath::RoundToInt((OpsStart - LoadStart) * 1000.0));
+
+		bool bMapSucceeded = World != nullptr;
+		if (!World)
+		{
+			MapResult->SetStringField(TEXT("error"), TEXT("Failed to load map"));
+		}
+		else
+		{
+			TArray<TSharedPtr<FJsonValue>> CommandResults;
+			for (const TSharedPtr<FJsonValue>& CommandValue : Commands)
+			{
+				const TSharedPtr<FJsonObject>* CommandObj = nullptr;
+				FString Type;
+				if (!CommandValue->TryGetObject(CommandObj) || !(*CommandObj)->TryGetStringField(TEXT("type"), Type))
+				{
+					continue;
+				}
+				const TSharedPtr<FJsonObject>* CommandParams = nullptr;
+				TSharedPtr<FJsonObject> Params = (*CommandObj)->TryGetObjectField(TEXT("params"), CommandParams)
+					? *CommandParams : MakeShared<FJsonObject>();
+
+				TSharedPtr<FJsonObject> Response = Bridge->ExecuteRegistryCommand(Type, Params);
+				bool bSuccess = true;
+				Response->TryGetBoolField(TEXT("success"), bSuccess);
+				bMapSucceeded &= bSuccess;
+
+				TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+				Entry->SetStringField(TEXT("command"), Type);
+				Entry->SetBoolField(TEXT("success"), bSuccess);
+				Entry->SetObjectField(TEXT("result"), Response);
+				CommandResults.Add(MakeShared<FJsonValueObject>(Entry));
+			}
+			MapResult->SetArrayField(TEXT("results"), CommandResults);
+
+			if (bSave)
+			{
+				UEditorLoadingAndSavingUtils::SaveDirtyPackages(/*bSaveMapPackages=*/true, /*bSaveContentPackages=*/true);
+			}
+			else
+			{
+				DiscardDirtyPackages();
+			}
+		}
+		MapResult->SetNumberField(TEXT("ops_ms"), FMath::RoundToInt((FPlatformTime::Seconds() - OpsStart) * 1000.0));
+		MapResult->SetBoolField(TEXT("success"), bMapSucceeded);
+		FailedMaps += bMapSucceeded ? 0 : 1;
+
+		// Reclaim whatever the map and the script created before loading the next one
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, /*bPerformFullPurge=*/true);
+		MapResult->SetNumberField(TEXT("used_physical_mb"),
+			static_cast<double>(FPlatformMemory::GetStats().UsedPhysical / (1024 * 1024)));
+
+		MapResults.Add(MakeShared<FJsonValueObject>(MapResult));
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetNumberField(TEXT("shards"), 1);
+	Result->SetNumberField(TEXT("total_maps"), Maps.Num());
+	Result->SetNumberField(TEXT("failed_maps"), FailedMaps);
+	Result->SetArrayField(TEXT("maps"), MapResults);
+	return Result;
+}
+
+TSharedPtr<FJsonObject> UUnrealMCPBatchCommandlet::RunSharded(const FString& ScriptPath, const TArray<FString>& Maps,
+	int32 ShardCount, const FString& WorkDir)
+{
+	struct FShard
+	{
+		FString MapsFile;
+		FString OutputFile;
+		FString LogFile;
+		FProcHandle Process;
+		int32 NumMaps = 0;
+	};
+
+	// Round-robin keeps neighbouring (often similarly sized) maps on different shards
+	TArray<TArray<FString>> ShardMaps;
+	ShardMaps.SetNum(ShardCount);
+	for (int32 Index = 0; Index < Maps.Num(); ++Index)
+	{
+		ShardMaps[Index % ShardCount].Add(Maps[Index]);
+	}
+
+	const FString Executable = FPlatformProcess::ExecutablePath();
+	const FString ProjectFile = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+	TArray<FShard> Shards;
+	Shards.SetNum(ShardCount);
+	for (int32 Index = 0; Index < ShardCount; ++Index)
+	{
+		FShard& Shard = Shards[Index];
+		Shard.MapsFile = WorkDir / FString::Printf(TEXT("Shard%d.maps.txt"), Index);
+		Shard.OutputFile = WorkDir / FString::Printf(TEXT("Shard%d.json"), Index);
+		Shard.LogFile = WorkDir / FString::Printf(TEXT("Shard%d.log"), Index);
+		Shard.NumMaps = ShardMaps[Index].Num();
+		FFileHelper::SaveStringArrayToFile(ShardMaps[Index], *Shard.MapsFile);
+		IFileManager::Get().Delete(*Shard.OutputFile, /*RequireExists=*/false, /*EvenReadOnly=*/true, /*Quiet=*/true);
+
+		// Children never shard again and never open the MCP port (see UUnrealMCPBridge::Initialize)
+		const FString Args = FString::Printf(
+			TEXT("\"%s\" -run=UnrealMCPBatch -script=\"%s\" -mapsfile=\"%s\" -output=\"%s\" -abslog=\"%s\" -unattended -nullrhi -nosplash -nosourcecontrol"),
+			*ProjectFile, *ScriptPath, *Shard.MapsFile, *Shard.OutputFile, *Shard.LogFile);
+
+		Shard.Process = FPlatformProcess::CreateProc(*Executable, *Args,
+			/*bLaunchDetached=*/false, /*bLaunchHidden=*/true, /*bLaunchReallyHidden=*/true,
+			nullptr, /*PriorityModifier=*/0, nullptr, nullptr);
+		UE_LOG(LogUnrealMCPBatch, Display, TEXT("Shard %d: %d maps%s"), Index, Shard.NumMaps,
+			Shard.Process.IsValid() ? TEXT("") : TEXT(" (failed to launch)"));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> MapResults;
+	TArray<TSharedPtr<FJsonValue>> FailedShards;
+	int32 FailedMaps = 0;
+	for (int32 Index = 0; Index < ShardCount; ++Index)
+	{
+		FShard& Shard = Shards[Index];
+		int32 ReturnCode = -1;
+		if (Shard.Process.IsValid())
+		{
+			FPlatformProcess::WaitForProc(Shard.Process);
+			FPlatformProcess::GetProcReturnCode(Shard.Process, &ReturnCode);
+			FPlatformProcess::CloseProc(Shard.Process);
+		}
+
+		// Exit code 2 only means some maps failed; their results are still in the output
+		TSharedPtr<FJsonObject> ShardResult = ReadJsonFile(Shard.OutputFile);
+		const TArray<TSharedPtr<FJsonValue>>* ShardMapResults = nullptr;
+		if (!ShardResult || !ShardResult->TryGetArrayField(TEXT("maps"), ShardMapResults))
+		{
+			TSharedPtr<FJsonObject> Failure = MakeShared<FJsonObject>();
+			Failure->SetNumberField(TEXT("shard"), Index);
+			Failure->SetNumberField(TEXT("exit_code"), ReturnCode);
+			Failure->SetNumberField(TEXT("maps"), Shard.NumMaps);
+			Failure->SetStringField(TEXT("log"), Shard.LogFile);
+			FailedShards.Add(MakeShared<FJsonValueObject>(Failure));
+			FailedMaps += Shard.NumMaps;
+			continue;
+		}
+		MapResults.Append(*ShardMapResults);
+		FailedMaps += static_cast<int32>(ShardResult->GetNumberField(TEXT("failed_maps")));
+	}
+
+	// Same order as an unsharded run
+	MapResults.Sort([](const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+	{
+		return A->AsObject()->GetStringField(TEXT("map")) < B->AsObject()->GetStringField(TEXT("map"));
+	});
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetNumberField(TEXT("shards"), ShardCount);
+	Result->SetNumberField(TEXT("total_maps"), Maps.Num());
+	Result->SetNumberField(TEXT("failed_maps"), FailedMaps);
+	Result->SetArrayField(TEXT("maps"), MapResults);
+	if (FailedShards.Num() > 0)
+	{
+		Result->SetArrayField(TEXT("failed_shards"), FailedShards);
+	}
+	return Result;
+}
@@ -58,6 +58,15 @@
 #endif
 // Command registry and handler modules
 #include "MCPCommandRegistry.h"
+#include "MCPWorldChangeJournal.h"
+#include "MCPAssetNameIndex.h"
+#include "MCPJobManager.h"
+#include "MCPLogCapture.h"
+#include "MCPBlueprintResolver.h"
+#include "MCPClassResolver.h"
+#include "MCPBlueprintNodeIndex.h"
+#include "MCPBlueprintExporter.h"
+#include "MCPPropertyPath.h"
 #include "Commands/UnrealMCPEditorCommands.h"
 #include "Commands/UnrealMCPBlueprintCommands.h"
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
@@ -68,6 +77,7 @@
 #include "Commands/UnrealMCPAssetCommands.h"
 #include "Commands/UnrealMCPDiagnosticsCommands.h"
 #include "Commands/UnrealMCPTestCommands.h"
+#include "Commands/UnrealMCPInstancingCommands.h"
 // Settings, editor menu, and cross-version compat macros
 #include "UnrealMCPSettings.h"
 #include "UnrealMCPCompat.h"
@@ -84,6 +94,12 @@ UUnrealMCPBridge::UUnrealMCPBridge()
     // Create the central command registry
     CommandRegistry = MakeShared<FMCPCommandRegistry>();
 
+    // Shared services used by command modules
+    AssetNameIndex        = MakeShared<FMCPAssetNameIndex, ESPMode::ThreadSafe>();
+    JobManager            = MakeShared<FMCPJobManager>();
+    ChangeJournal         = MakeShared<FMCPWorldChangeJournal>();
+    LogCapture            = MakeShared<FMCPLogCapture>();
+
     // Instantiate all command handler modules
     EditorCommands        = MakeShared<FUnrealMCPEditorCommands>();
     BlueprintCommands     = MakeShared<FUnrealMCPBlueprintCommands>();
@@ -91,10 +107,11 @@ UUnrealMCPBridge::UUnrealMCPBridge()
     ProjectCommands       = MakeShared<FUnrealMCPProjectCommands>();
     UMGCommands           = MakeShared<FUnrealMCPUMGCommands>();
     LevelCommands         = MakeShared<FUnrealMCPLevelCommands>();
-    AssetCommands         = MakeShared<FUnrealMCPAssetCommands>();
+    AssetCommands         = MakeShared<FUnrealMCPAssetCommands>(AssetNameIndex);
     DiagnosticsCommands   = MakeShared<FUnrealMCPDiagnosticsCommands>();
-    TestCommands          = MakeShared<FUnrealMCPTestCommands>();
+    TestCommands          = MakeShared<FUnrealMCPTestCommands>(JobManager, ChangeJournal);
     MaterialCommands      = MakeShared<FUnrealMCPMaterialCommands>();
+    InstancingCommands    = MakeShared<FUnrealMCPInstancingCommands>();
 
     // Each module self-registers into the registry.
     // To add a new command module: instantiate it and call RegisterCommands here.
@@ -108,6 +125,10 @@ UUnrealMCPBridge::UUnrealMCPBridge()
     DiagnosticsCommands->RegisterCommands(*CommandRegistry);
     TestCommands->RegisterCommands(*CommandRegistry);
     MaterialCommands->RegisterCommands(*CommandRegistry);
+    InstancingCommands->RegisterCommands(*CommandRegistry);
+    ChangeJournal->RegisterCommands(*CommandRegistry);
+    JobManager->RegisterCommands(*CommandRegistry);
+    LogCapture->RegisterCommands(*CommandRegistry);
 }
 
 UUnrealMCPBridge::~UUnrealMCPBridge()
@@ -123,6 +144,11 @@ UUnrealMCPBridge::~UUnrealMCPBridge()
     DiagnosticsCommands.Reset();
     TestCommands.Reset();
     MaterialCommands.Reset();
+    InstancingCommands.Reset();
+    ChangeJournal.Reset();
+    JobManager.Reset();
+    AssetNameIndex.Reset();
+    LogCapture.Reset();
 }
 
 // Initialize subsystem
@@ -140,12 +166,38 @@ void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     const UUnrealMCPSettings* Settings = GetDefault<UUnrealMCPSettings>();
     Port = static_cast<uint16>(Settings->Port);
 
+    // In-memory log ring for query_log; attached first so it sees the rest of startup
+    LogCapture->Start();
+
+    // Start journaling actor changes (bound here, not in the constructor, so the CDO never listens)
+    ChangeJournal->Start();
+
+    // Asset name index for find_asset; builds on a worker once the registry scan completes
+    AssetNameIndex->Start();
+
+    // Project-wide blueprint name lookup used by FUnrealMCPCommonUtils::FindBlueprint
+    FMCPBlueprintResolver::Get().Start();
+
+    // Class short-name index for component, function-target and cast lookups; refreshed on module load / hot reload
+    FMCPClassResolver::Get().Start();
+
+    // Cached export_blueprint results, invalidated when anything a blueprint owns is modified
+    FMCPBlueprintExporter::Get().Start();
+
+    // Compiled property paths for the set_*_property commands; dropped on module load, hot reload and blueprint compile
+    FMCPPropertyPath::Get().Start();
+
     // Register editor Tools menu (deferred until ToolMenus system is ready)
     UToolMenus::RegisterStartupCallback(
         FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &UUnrealMCPBridge::RegisterMenus));
 
-    // Conditionally auto-start based on settings
-    if (Settings->bAutoStartServer)
+    // Conditionally auto-start based on settings. Commandlets (e.g. sharded UnrealMCPBatch
+    // children) never listen: they would all compete for the same port.
+    if (IsRunningCommandlet())
+    {
+        UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Running as commandlet — server not started"));
+    }
+    else if (Settings->bAutoStartServer)
     {
         StartServer();
     }
@@ -160,6 +212,15 @@ void UUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Shutting down"));
     StopServer();
+    ChangeJournal->Stop();
+    AssetNameIndex->Stop();
+    FMCPBlueprintResolver::Get().Stop();
+    FMCPClassResolver::Get().Stop();
+    FMCPBlueprintNodeIndex::Get().Stop();
+    FMCPBlueprintExporter::Get().Stop();
+    FMCPPropertyPath::Get().Stop();
+    JobManager->Stop();
+    LogCapture->Stop();
 
     // Unregister startup callback and remove all menus owned by this subsystem
     UToolMenus::UnRegisterStartupCallback(this);
@@ -325,89 +386,107 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
 
+    // Read-only commands registered as thread-safe skip the game-thread round trip
+    // so they neither wait for nor stall the editor tick.
+    if (CommandRegistry->CanExecuteOffGameThread(CommandType))
+    {
+        return DispatchCommand(CommandType, Params);
+    }
+
     TPromise<FString> Promise;
     TFuture<FString> Future = Promise.GetFuture();
 
     AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
     {
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+        Promise.SetValue(DispatchCommand(CommandType, Params));
+    });
 
-        try
-        {
-            TSharedPtr<FJsonObject> ResultJson;
+    return Future.Get();
+}
 
-            // --- Built-in commands (not routed via registry) ---
-            if (CommandType == TEXT("ping"))
-            {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
-            }
-            else if (CommandType == TEXT("get_capabilities"))
-            {
-                TArray<FString> Commands = CommandRegistry->GetRegisteredCommands();
-                // Append built-in commands that are not in the registry
-                Commands.Add(TEXT("batch"));
-                Commands.Add(TEXT("get_capabilities"));
-                Commands.Add(TEXT("ping"));
-                Commands.Sort();
-
-                TArray<TSharedPtr<FJsonValue>> CmdArray;
-                for (const FString& Cmd : Commands)
-                {
-                    CmdArray.Add(MakeShared<FJsonValueString>(Cmd));
-                }
-
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetArrayField(TEXT("commands"), CmdArray);
-                ResultJson->SetStringField(TEXT("version"), TEXT("1.0.0"));
-            }
-            else if (CommandType == TEXT("batch"))
-            {
-                ResultJson = ExecuteBatchCommand(Params);
-            }
-            // --- All other commands: registry lookup ---
-            else
-            {
-                ResultJson = CommandRegistry->ExecuteCommand(CommandType, Params);
-            }
+TSharedPtr<FJsonObject> UUnrealMCPBridge::ExecuteRegistryCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    return CommandRegistry->ExecuteCommand(CommandType, Params);
+}
 
-            // Wrap result using the same success/error logic as before
-            bool bSuccess = true;
-            FString ErrorMessage;
+// Run a command on the current thread and serialize the wrapped response
+FString UUnrealMCPBridge::DispatchCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
 
-            if (ResultJson->HasField(TEXT("success")))
-            {
-                bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                if (!bSuccess && ResultJson->HasField(TEXT("error")))
-                {
-                    ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-                }
-            }
+    try
+    {
+        TSharedPtr<FJsonObject> ResultJson;
 
-            if (bSuccess)
+        // --- Built-in commands (not routed via registry) ---
+        if (CommandType == TEXT("ping"))
+        {
+            ResultJson = MakeShareable(new FJsonObject);
+            ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+        }
+        else if (CommandType == TEXT("get_capabilities"))
+        {
+            TArray<FString> Commands = CommandRegistry->GetRegisteredCommands();
+            // Append built-in commands that are not in the registry
+            Commands.Add(TEXT("batch"));
+            Commands.Add(TEXT("get_capabilities"));
+            Commands.Add(TEXT("ping"));
+            Commands.Sort();
+
+            TArray<TSharedPtr<FJsonValue>> CmdArray;
+            for (const FString& Cmd : Commands)
             {
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+                CmdArray.Add(MakeShared<FJsonValueString>(Cmd));
             }
-            else
+
+            ResultJson = MakeShareable(new FJsonObject);
+            ResultJson->SetArrayField(TEXT("commands"), CmdArray);
+            ResultJson->SetStringField(TEXT("version"), TEXT("1.0.0"));
+        }
+        else if (CommandType == TEXT("batch"))
+        {
+            ResultJson = ExecuteBatchCommand(Params);
+        }
+        // --- All other commands: registry lookup ---
+        else
+        {
+            ResultJson = CommandRegistry->ExecuteCommand(CommandType, Params);
+        }
+
+        // Wrap result using the same success/error logic as before
+        bool bSuccess = true;
+        FString ErrorMessage;
+
+        if (ResultJson->HasField(TEXT("success")))
+        {
+            bSuccess = ResultJson->GetBoolField(TEXT("success"));
+            if (!bSuccess && ResultJson->HasField(TEXT("error")))
             {
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+                ErrorMessage = ResultJson->GetStringField(TEXT("error"));
             }
         }
-        catch (const std::exception& e)
+
+        if (bSuccess)
+        {
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+        }
+        else
         {
             ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+            ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
         }
+    }
+    catch (const std::exception& e)
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+    }
 
-        FString ResultString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-        Promise.SetValue(ResultString);
-    });
-
-    return Future.Get();
+    FString ResultString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
+    FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+    return ResultString;
 }
 
 // Execute a batch of commands sequentially on the game thread.
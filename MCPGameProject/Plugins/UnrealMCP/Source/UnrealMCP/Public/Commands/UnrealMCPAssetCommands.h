@@ -4,6 +4,8 @@
 #include "Json.h"
 #include "MCPCommandRegistry.h"
 
+class FMCPAssetNameIndex;
+
 /**
  * Handler class for Asset management MCP commands.
  * Handles listing, finding, creating, importing, and managing Content Browser assets.
@@ -12,7 +14,7 @@
 class UNREALMCP_API FUnrealMCPAssetCommands
 {
 public:
-    FUnrealMCPAssetCommands();
+    explicit FUnrealMCPAssetCommands(TSharedPtr<FMCPAssetNameIndex, ESPMode::ThreadSafe> InNameIndex = nullptr);
 
     /** Register all asset commands into the central registry. */
     void RegisterCommands(FMCPCommandRegistry& Registry);
@@ -23,6 +25,11 @@ private:
     TSharedPtr<FJsonObject> HandleFindAsset(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleDoesAssetExist(const TSharedPtr<FJsonObject>& Params);
 
+    // Dependency graph (registry only, no package loads)
+    TSharedPtr<FJsonObject> HandleGetAssetDependencies(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetAssetReferencers(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> QueryDependencyGraph(const TSharedPtr<FJsonObject>& Params, bool bReferencers);
+
     // Folder management
     TSharedPtr<FJsonObject> HandleCreateFolder(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleListFolders(const TSharedPtr<FJsonObject>& Params);
@@ -43,4 +50,12 @@ private:
 
     // Asset editor
     TSharedPtr<FJsonObject> HandleOpenAssetEditor(const TSharedPtr<FJsonObject>& Params);
+
+    /** Name index backing find_asset; falls back to a registry scan until it is ready. */
+    TSharedPtr<FMCPAssetNameIndex, ESPMode::ThreadSafe> NameIndex;
+
+    /** Dependency query results, valid while NameIndex's registry revision is unchanged. */
+    FCriticalSection GraphCacheLock;
+    uint64 GraphCacheRevision = 0;
+    TMap<FString, TSharedPtr<FJsonObject>> GraphCache;
 };
@@ -33,6 +33,7 @@ private:
     TSharedPtr<FJsonObject> HandleGetBlueprintComponents(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleListBlueprints(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleGetBlueprintCompileErrors(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleExportBlueprint(const TSharedPtr<FJsonObject>& Params);
 
     // Collision commands
     TSharedPtr<FJsonObject> HandleSetComponentCollisionProfile(const TSharedPtr<FJsonObject>& Params);
@@ -25,6 +25,7 @@ private:
     TSharedPtr<FJsonObject> HandleAddBlueprintInputActionNode(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddBlueprintSelfReference(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindBlueprintNodes(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleQueryBlueprintNodes(const TSharedPtr<FJsonObject>& Params);
 
     // New node commands
     TSharedPtr<FJsonObject> HandleAddBlueprintGetVariableNode(const TSharedPtr<FJsonObject>& Params);
@@ -35,4 +36,5 @@ private:
     TSharedPtr<FJsonObject> HandleAddBlueprintMathNode(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddBlueprintPrintStringNode(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddBlueprintCustomFunction(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleBuildBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
 };
\ No newline at end of file
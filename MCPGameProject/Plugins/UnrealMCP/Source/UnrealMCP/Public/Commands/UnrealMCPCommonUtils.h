@@ -31,6 +31,14 @@ public:
     static FVector2D GetVector2DFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
     static FVector GetVectorFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
     static FRotator GetRotatorFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
+    /**
+     * Read a flat transform array (FieldName) whose per-item layout is set by the
+     * optional "stride" field: 3 = location, 6 = +rotation, 9 = +scale (default).
+     */
+    static bool GetPackedTransformsFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName,
+                                            TArray<double>& OutValues, int32& OutStride, FString& OutError);
+    /** Apply packed item Index on top of Base; components not covered by the stride keep Base's values. */
+    static FTransform UnpackTransform(const TArray<double>& Values, int32 Stride, int32 Index, const FTransform& Base);
     
     // Actor utilities
     static TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
@@ -40,12 +48,17 @@ public:
     static UBlueprint* FindBlueprint(const FString& BlueprintName);
     /**
      * Find a Blueprint by name.
-     * @param BlueprintName  Short asset name (e.g. "MyBP")
-     * @param AssetPath      Optional full package path (e.g. "/Game/Characters/MyBP").
-     *                       When empty, defaults to "/Game/Blueprints/<BlueprintName>".
+     * @param BlueprintName  Short asset name (e.g. "MyBP") or full package / object path.
+     *                       Short names are resolved project-wide by FMCPBlueprintResolver.
+     * @param AssetPath      Optional full package path (e.g. "/Game/Characters/MyBP"),
+     *                       takes precedence over BlueprintName when set.
+     * @param DefaultFolder  Folder preferred for ambiguous or not-yet-registered short names.
      */
     static UBlueprint* FindBlueprintByName(const FString& BlueprintName,
-                                            const FString& AssetPath = TEXT(""));
+                                            const FString& AssetPath = TEXT(""),
+                                            const FString& DefaultFolder = TEXT("/Game/Blueprints/"));
+    /** Error text for the last failed FindBlueprint call ("not found", or the ambiguous candidates). */
+    static FString DescribeBlueprintLookupFailure(const FString& BlueprintName);
     static UEdGraph* FindOrCreateEventGraph(UBlueprint* Blueprint);
     
     // Blueprint node utilities
@@ -11,7 +11,10 @@
  *   - Viewport camera info / actor screen-position queries
  *   - Actor highlighting (select + focus)
  *   - LiveCoding hot-reload control
- *   - C++ source file read / write (with automatic backup)
+ *   - C++ source file read (whole file or line / byte ranges, hash-conditional)
+ *   - C++ source file write (whole file, unified diff or line ranges; atomic,
+ *     with content-addressed backups)
+ *   - Parallel literal / regex search over the project's source tree
  *   - Engine installation path discovery
  */
 class UNREALMCP_API FUnrealMCPDiagnosticsCommands
@@ -34,8 +37,16 @@ private:
 
     // Source file access
     TSharedPtr<FJsonObject> HandleGetSourceFile(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSearchSource(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleModifySourceFile(const TSharedPtr<FJsonObject>& Params);
 
     // Engine / project path discovery
     TSharedPtr<FJsonObject> HandleGetEnginePath(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Held by modify_source_file from reading the file to renaming the new one
+     * over it. Connections run it concurrently, and two edits against the same
+     * base_hash must not both pass the check and both write.
+     */
+    FCriticalSection SourceWriteLock;
 };
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "MCPCommandRegistry.h"
+
+class AActor;
+class UWorld;
+class ULevel;
+class UStaticMesh;
+class UHierarchicalInstancedStaticMeshComponent;
+
+/**
+ * Handler class for instanced static mesh placement MCP commands.
+ *
+ * Places large numbers of identical meshes as instances of a single
+ * Hierarchical Instanced Static Mesh (HISM) component instead of one
+ * StaticMeshActor each, keeping actor, component and draw-call counts flat.
+ *
+ *   scatter_instances : append (or replace) instances from packed transforms
+ *                       or a procedural pattern (grid / random / spline)
+ *   remove_instances  : remove instances by index or by world-space box
+ *   consolidate_to_instances : replace groups of matching StaticMeshActors
+ *                       with one HISM actor per group
+ */
+class UNREALMCP_API FUnrealMCPInstancingCommands
+{
+public:
+    FUnrealMCPInstancingCommands();
+
+    /** Register all instancing commands into the central registry. */
+    void RegisterCommands(FMCPCommandRegistry& Registry);
+
+private:
+    /**
+     * Params:
+     *   actor_name  (string)  – HISM holder actor; created when it does not exist
+     *   static_mesh (string)  – mesh path, required when creating the holder; an existing
+     *                           holder without a component for this mesh gets a new one
+     *   transforms  (array)   – packed world-space transforms (see stride), or
+     *   pattern     (object)  – { "type": "grid" | "random" | "spline", ... }
+     *   stride      (int)     – 3 / 6 / 9, default 9
+     *   replace     (bool)    – clear existing instances first (default false)
+     */
+    TSharedPtr<FJsonObject> HandleScatterInstances(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Params: actor_name, and either indices (array of int) or
+     *         box_min / box_max ([x,y,z] world-space bounds)
+     */
+    TSharedPtr<FJsonObject> HandleRemoveInstances(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Groups StaticMeshActors by (level, mesh, material overrides, mobility, collision profile,
+     * actor tags, component tags).
+     * Params:
+     *   actor_names    (array)  – restrict to these actors (default: whole level)
+     *   min_group_size (int)    – smallest group worth converting (default 2)
+     *   dry_run        (bool)   – report the grouping without changing the level
+     */
+    TSharedPtr<FJsonObject> HandleConsolidateToInstances(const TSharedPtr<FJsonObject>& Params);
+
+    // ── helpers ──────────────────────────────────────────────────────────────
+
+    /** Generate world-space transforms for a "pattern" object. Returns false and sets OutError on bad input. */
+    bool GeneratePatternTransforms(UWorld* World, const TSharedPtr<FJsonObject>& Pattern,
+                                   TArray<FTransform>& OutTransforms, FString& OutError) const;
+
+    /** The HISM on Actor that renders Mesh (any HISM when Mesh is null), or null. */
+    UHierarchicalInstancedStaticMeshComponent* FindInstanceComponent(AActor* Actor, const UStaticMesh* Mesh) const;
+
+    /** Add a static HISM rendering Mesh to Actor (as its root when it has none). */
+    UHierarchicalInstancedStaticMeshComponent* AddInstanceComponent(AActor* Actor, UStaticMesh* Mesh) const;
+
+    /** Spawn an empty actor whose root is a static HISM rendering Mesh, in Level (default: the current level). */
+    UHierarchicalInstancedStaticMeshComponent* CreateInstanceActor(UWorld* World, const FString& ActorName,
+                                                                  UStaticMesh* Mesh, ULevel* Level = nullptr) const;
+};
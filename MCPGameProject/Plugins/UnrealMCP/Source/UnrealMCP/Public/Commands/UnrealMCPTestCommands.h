@@ -4,22 +4,36 @@
 #include "Json.h"
 #include "MCPCommandRegistry.h"
 
+class FMCPJobManager;
+class FMCPWorldChangeJournal;
+class FMCPLevelValidationCache;
+
 /**
  * Handler class for Test & Validation MCP commands (Phase 2B).
  *
  * Provides structural validation for:
  *   - validate_blueprint  : compile status, error/warning counts, node & variable counts
- *   - run_level_validation: actors with issues, broken asset refs, uncompiled blueprints
+ *   - validate_blueprints : the same for every blueprint under a path, as a background job
+ *   - run_level_validation: actors with issues, broken asset refs, uncompiled blueprints;
+ *                           per-actor results are cached until the change journal reports the actor changed
  */
 class UNREALMCP_API FUnrealMCPTestCommands
 {
 public:
-    FUnrealMCPTestCommands();
+    explicit FUnrealMCPTestCommands(TSharedPtr<FMCPJobManager> InJobManager = nullptr,
+                                    TSharedPtr<FMCPWorldChangeJournal> InChangeJournal = nullptr);
 
     /** Register all test commands into the central registry. */
     void RegisterCommands(FMCPCommandRegistry& Registry);
 
 private:
     TSharedPtr<FJsonObject> HandleValidateBlueprint(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleValidateBlueprints(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleRunLevelValidation(const TSharedPtr<FJsonObject>& Params);
+
+    /** Runs validate_blueprints and budgeted run_level_validation; owned by the bridge. */
+    TSharedPtr<FMCPJobManager> JobManager;
+
+    /** Per-actor run_level_validation results, shared with in-flight validation jobs. */
+    TSharedPtr<FMCPLevelValidationCache> LevelValidationCache;
 };
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
+#if ENGINE_MAJOR_VERSION >= 5
+#include "AssetRegistry/AssetData.h"
+#else
+#include "AssetData.h"
+#endif
+
+/** How FMCPAssetNameIndex::Query matches the search text. */
+enum class EMCPAssetMatchMode : uint8
+{
+	Substring,   // text appears in the asset name or package path
+	Prefix,      // asset name starts with text
+	Fuzzy,       // ranked by trigram overlap, tolerates typos and reordering
+};
+
+/** One ranked hit returned by FMCPAssetNameIndex::Query. */
+struct FMCPAssetMatch
+{
+	FString ObjectPath;
+	FName AssetName;
+	FName PackageName;
+	FName ClassName;
+	float Score = 0.0f;
+};
+
+/**
+ * Trigram index over asset names and package paths for find_asset.
+ *
+ * Built once on a worker thread after the asset registry finishes its initial
+ * scan, then kept current from OnAssetAdded / OnAssetRemoved / OnAssetRenamed.
+ * Events that arrive while the build is running are queued and replayed when
+ * the new index is published. Queries take a read lock and may run on any
+ * thread.
+ *
+ * Lifetime: owned by UUnrealMCPBridge; Start()/Stop() bind and unbind the
+ * registry delegates from Initialize()/Deinitialize().
+ */
+class UNREALMCP_API FMCPAssetNameIndex : public TSharedFromThis<FMCPAssetNameIndex, ESPMode::ThreadSafe>
+{
+public:
+	~FMCPAssetNameIndex();
+
+	void Start();
+	void Stop();
+
+	/** True once the initial build has been published. */
+	bool IsReady() const { return bReady; }
+
+	/**
+	 * Best matches for Text (case-insensitive), highest score first.
+	 * PathPrefix / ClassName, when set, restrict hits to that package path / class.
+	 */
+	TArray<FMCPAssetMatch> Query(const FString& Text, EMCPAssetMatchMode Mode, int32 Limit,
+	                             const FString& PathPrefix = FString(), FName ClassName = NAME_None) const;
+
+	int32 Num() const;
+
+	/**
+	 * Count of asset registry changes (add/remove/rename/update) seen since Start().
+	 * Results derived from registry state can be cached until this moves.
+	 */
+	uint64 GetRevision() const { return Revision.load(); }
+
+private:
+	struct FEntry
+	{
+		FString ObjectPath;
+		FName AssetName;
+		FName PackageName;
+		FName ClassName;
+		FString LowerName;
+		FString LowerPackage;
+		bool bAlive = true;
+	};
+
+	/** Self-contained index state; the background build fills one and swaps it in. */
+	struct FIndexData
+	{
+		TArray<FEntry> Entries;
+		TMap<FString, int32> ByObjectPath;
+		TMap<uint64, TArray<int32>> Postings;
+		int32 NumDead = 0;
+
+		void Add(const FAssetData& AssetData);
+		void AddEntry(FEntry&& Entry);
+		void Remove(const FString& ObjectPath);
+		void Compact();
+	};
+
+	/** Registry event seen while the background build runs; replayed in order. */
+	struct FPendingEvent
+	{
+		bool bAdded = false;
+		FAssetData Asset;       // valid when bAdded
+		FString RemovedPath;    // valid when !bAdded
+	};
+
+	void KickBuild();
+	void OnFilesLoaded();
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnAssetUpdated(const FAssetData& AssetData);
+
+	static bool ShouldIndex(const FAssetData& AssetData);
+	static FString GetObjectPath(const FAssetData& AssetData);
+
+	mutable FRWLock Lock;
+	FIndexData Data;
+	std::atomic<bool> bReady{false};
+	std::atomic<uint64> Revision{0};
+	bool bBuilding = false;   // guarded by Lock
+	bool bStarted = false;    // guarded by Lock
+
+	TArray<FPendingEvent> PendingEvents;   // guarded by Lock
+
+	FDelegateHandle FilesLoadedHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+};
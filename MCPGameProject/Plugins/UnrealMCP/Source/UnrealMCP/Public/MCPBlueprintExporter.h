@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprint;
+struct FPropertyChangedEvent;
+
+/**
+ * Compact, canonical export of a blueprint's structure (variables, SCS tree,
+ * every graph with its nodes, pins and links) together with a hash of it.
+ *
+ * Canonical means deterministic: graphs are ordered by type and name, nodes
+ * by GUID and links lexicographically, so the same structure always hashes
+ * the same and clients can cache the export keyed by the hash.
+ *
+ * Exports are cached per blueprint. An entry goes dirty when any object
+ * owned by the blueprint (graphs, nodes, SCS nodes, component templates) is
+ * modified or has a property changed, or when the blueprint compiles; until
+ * then a request carrying the cached hash is answered without touching the
+ * graphs.
+ *
+ * Game thread only. UUnrealMCPBridge calls Start()/Stop() from
+ * Initialize()/Deinitialize().
+ */
+class UNREALMCP_API FMCPBlueprintExporter
+{
+public:
+	static FMCPBlueprintExporter& Get();
+
+	void Start();
+	void Stop();
+
+	/**
+	 * Export Blueprint, reusing the cached export while it is clean.
+	 * bOutFromCache tells whether the graphs were walked for this call.
+	 */
+	TSharedPtr<FJsonObject> Export(UBlueprint* Blueprint, FString& OutHash, bool& bOutFromCache);
+
+	/** Hash of the cached export if it is still clean; empty otherwise. */
+	FString GetCleanHash(UBlueprint* Blueprint) const;
+
+private:
+	struct FCacheEntry
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		TSharedPtr<FJsonObject> Export;
+		FString Hash;
+		FDelegateHandle CompiledHandle;
+		bool bDirty = true;
+	};
+
+	static TSharedPtr<FJsonObject> BuildExport(UBlueprint* Blueprint);
+	static FString HashExport(const TSharedPtr<FJsonObject>& Export);
+
+	void MarkDirty(UObject* Object);
+	void OnObjectModified(UObject* Object);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void OnBlueprintCompiled(UBlueprint* Blueprint);
+
+	TMap<FObjectKey, FCacheEntry> Cache;
+
+	bool bStarted = false;
+	FDelegateHandle ObjectModifiedHandle;
+	FDelegateHandle PropertyChangedHandle;
+};
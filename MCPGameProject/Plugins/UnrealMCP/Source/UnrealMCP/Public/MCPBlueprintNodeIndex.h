@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+/**
+ * Per-blueprint map from node GUID to node, covering every graph of the
+ * blueprint (ubergraph pages, functions, macros, delegate signatures and
+ * their collapsed subgraphs).
+ *
+ * An entry is built on the first lookup for a blueprint and marked dirty when
+ * one of its graphs reports a change or the blueprint broadcasts OnChanged
+ * (graphs added or removed). Dirty entries are rebuilt lazily on the next
+ * lookup, so a batch of node edits costs one rebuild. Hits are validated
+ * (node alive, GUID unchanged, still in a graph) and a miss on a clean entry
+ * triggers one rebuild, which covers nodes that get their GUID after
+ * UEdGraph::AddNode has already notified.
+ *
+ * Game thread only. UUnrealMCPBridge calls Stop() from Deinitialize() to
+ * unbind the graph delegates.
+ */
+class UNREALMCP_API FMCPBlueprintNodeIndex
+{
+public:
+	static FMCPBlueprintNodeIndex& Get();
+
+	void Stop();
+
+	/** Find a node anywhere in Blueprint by GUID. */
+	UEdGraphNode* FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid);
+
+	/** Same, parsing the GUID from its string form; null when the string is not a GUID. */
+	UEdGraphNode* FindNode(UBlueprint* Blueprint, const FString& NodeId);
+
+	/** Every graph of Blueprint, in a stable order (ubergraph pages first). */
+	static void GetAllGraphs(UBlueprint* Blueprint, TArray<UEdGraph*>& OutGraphs);
+
+	/** "event", "function", "macro", "delegate" or "subgraph". */
+	static FString GetGraphType(UBlueprint* Blueprint, const UEdGraph* Graph);
+
+	/** Drop the cached entry for Blueprint; the next lookup rebuilds it. */
+	void Invalidate(UBlueprint* Blueprint);
+
+private:
+	struct FBlueprintEntry
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> Nodes;
+		TArray<TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>> GraphHandles;
+		FDelegateHandle ChangedHandle;
+		bool bDirty = true;
+	};
+
+	FBlueprintEntry& GetEntry(UBlueprint* Blueprint);
+	void Rebuild(FBlueprintEntry& Entry);
+	void Unbind(FBlueprintEntry& Entry);
+
+	void OnGraphChanged(const FEdGraphEditAction& Action, FObjectKey BlueprintKey);
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+
+	TMap<FObjectKey, FBlueprintEntry> Entries;
+};
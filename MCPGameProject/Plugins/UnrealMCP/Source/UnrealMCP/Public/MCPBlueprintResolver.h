@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#if ENGINE_MAJOR_VERSION >= 5
+#include "AssetRegistry/AssetData.h"
+#else
+#include "AssetData.h"
+#endif
+
+class UBlueprint;
+
+/**
+ * Resolves blueprint short names ("BP_Door") to assets anywhere in the project.
+ *
+ * Keeps an index of every blueprint asset (UBlueprint and subclasses such as
+ * UWidgetBlueprint) by asset name, built lazily from the asset registry on the
+ * first lookup and updated from registry add/remove/rename events. Loaded
+ * blueprints are cached through weak pointers, so repeated lookups skip the
+ * object path machinery without keeping anything alive.
+ *
+ * Game thread only. Accessed through Get() because the blueprint helpers in
+ * FUnrealMCPCommonUtils are static; UUnrealMCPBridge calls Start()/Stop()
+ * from Initialize()/Deinitialize().
+ */
+class UNREALMCP_API FMCPBlueprintResolver
+{
+public:
+	static FMCPBlueprintResolver& Get();
+
+	void Start();
+	void Stop();
+
+	/**
+	 * Resolve a short asset name or a package / object path.
+	 * DefaultFolder is the caller's historical default location ("/Game/Widgets/"
+	 * for widgets). A short name that matches several blueprints resolves to the
+	 * one in that folder when present, otherwise fails as ambiguous; a name not
+	 * in the registry yet (created this frame) is looked up there. On failure
+	 * GetLastError() describes why.
+	 */
+	UBlueprint* Resolve(const FString& NameOrPath, const FString& DefaultFolder = TEXT("/Game/Blueprints/"));
+
+	/** Object paths of every blueprint whose asset name is Name. */
+	TArray<FString> FindCandidates(const FString& Name);
+
+	/** Reason the most recent Resolve() returned null (empty after a success). */
+	const FString& GetLastError() const { return LastError; }
+
+private:
+	void EnsureIndex();
+	bool IsBlueprintAsset(const FAssetData& AssetData) const;
+	void AddAsset(const FAssetData& AssetData);
+	void RemoveObjectPath(const FString& ObjectPath);
+	UBlueprint* LoadCached(const FString& ObjectPath);
+
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	/** Asset name -> object paths of blueprints with that name (FName compare is case-insensitive). */
+	TMap<FName, TArray<FString>> ByName;
+	TMap<FString, TWeakObjectPtr<UBlueprint>> Loaded;
+	/** Short names of UBlueprint and every native subclass, for classifying registry events. */
+	TSet<FName> BlueprintClassNames;
+	FString LastError;
+
+	bool bIndexBuilt = false;
+	/** Index was built before the registry finished scanning; rebuild once it has. */
+	bool bIndexPartial = false;
+	bool bStarted = false;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+};
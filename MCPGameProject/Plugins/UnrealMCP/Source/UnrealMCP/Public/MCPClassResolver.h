@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Modules/ModuleManager.h"
+
+/**
+ * Resolves class short names ("StaticMesh", "UGameplayStatics", "BP_Door_C")
+ * to UClass objects without probing FindObject with every spelling.
+ *
+ * The index is built lazily from TObjectIterator<UClass> and keyed by every
+ * spelling callers have historically used: the plain name, the C++ prefixed
+ * name (U/A), and for components the name without the "Component" suffix.
+ * Blueprint generated classes are keyed with and without "_C"; blueprints
+ * that are not loaded yet are found through FMCPBlueprintResolver on a miss.
+ * The index is rebuilt after a module load or a hot reload / live coding
+ * patch, since both introduce new native classes.
+ *
+ * Game thread only. UUnrealMCPBridge calls Start()/Stop() from
+ * Initialize()/Deinitialize().
+ */
+class UNREALMCP_API FMCPClassResolver
+{
+public:
+	static FMCPClassResolver& Get();
+
+	void Start();
+	void Stop();
+
+	/**
+	 * Resolve a class by short name or by path ("/Script/Engine.Actor",
+	 * "/Game/BP_Door.BP_Door_C"). When RequiredBase is set, only classes
+	 * deriving from it are considered. Spellings that match the class name
+	 * exactly win over derived ones (so "StaticMesh" is UStaticMesh, unless
+	 * RequiredBase is UActorComponent). If several classes still match, the
+	 * call fails and GetLastError() lists them.
+	 */
+	UClass* Resolve(const FString& NameOrPath, UClass* RequiredBase = nullptr);
+
+	/** Reason the most recent Resolve() returned null (empty after a success). */
+	const FString& GetLastError() const { return LastError; }
+
+	/** True when the most recent Resolve() failed because the name matched several classes. */
+	bool WasAmbiguous() const { return bLastAmbiguous; }
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<UClass> Class;
+		/** 0 = the class name itself (with or without prefix), 1 = derived spelling. */
+		uint8 Rank = 0;
+	};
+
+	void EnsureIndex();
+	void AddClass(UClass* Class);
+	void AddKey(const FString& Key, UClass* Class, uint8 Rank);
+	UClass* ResolvePath(const FString& Path, UClass* RequiredBase);
+	UClass* ResolveBlueprintClass(const FString& Name, UClass* RequiredBase);
+
+	void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+	void Invalidate() { bIndexBuilt = false; }
+
+	TMap<FName, TArray<FEntry>> ByName;
+	FString LastError;
+	bool bLastAmbiguous = false;
+
+	bool bIndexBuilt = false;
+	bool bStarted = false;
+
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+};
@@ -11,6 +11,13 @@
  */
 using FMCPCommandHandler = TFunction<TSharedPtr<FJsonObject>(const TSharedPtr<FJsonObject>&)>;
 
+/**
+ * Per-call check for commands that may run on the server thread instead of
+ * being marshalled to the game thread. Returning false falls back to the game
+ * thread (e.g. while the asset registry is still scanning).
+ */
+using FMCPOffGameThreadCheck = TFunction<bool()>;
+
 /**
  * Central command registry for the MCP plugin.
  *
@@ -41,6 +48,13 @@ public:
 	 */
 	void RegisterCommand(const FString& CommandName, FMCPCommandHandler Handler);
 
+	/**
+	 * Register a command whose handler is thread-safe whenever CanRunOffGameThread
+	 * returns true. The bridge then executes it directly on the server thread.
+	 */
+	void RegisterCommand(const FString& CommandName, FMCPCommandHandler Handler,
+	                     FMCPOffGameThreadCheck CanRunOffGameThread);
+
 	/**
 	 * Execute a registered command.
 	 * Returns an error JSON object if CommandName is not registered.
@@ -51,6 +65,9 @@ public:
 	/** Returns true if CommandName has been registered. */
 	bool HasCommand(const FString& CommandName) const;
 
+	/** Returns true if CommandName may be executed on the calling (non-game) thread right now. */
+	bool CanExecuteOffGameThread(const FString& CommandName) const;
+
 	/**
 	 * Returns a sorted list of all registered command names.
 	 * Used by the get_capabilities built-in command.
@@ -59,4 +76,5 @@ public:
 
 private:
 	TMap<FString, FMCPCommandHandler> Commands;
+	TMap<FString, FMCPOffGameThreadCheck> OffGameThreadChecks;
 };
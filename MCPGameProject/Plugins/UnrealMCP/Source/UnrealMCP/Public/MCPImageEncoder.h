@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EMCPImageFormat : uint8
+{
+	Png,
+	Jpeg,
+};
+
+/** Raw pixels as read back from a viewport (BGRA, row-major, Width * Height entries). */
+struct FMCPImage
+{
+	int32 Width = 0;
+	int32 Height = 0;
+	TArray<FColor> Pixels;
+};
+
+struct FMCPImageEncodeOptions
+{
+	EMCPImageFormat Format = EMCPImageFormat::Png;
+	/** JPEG quality, 1-100; ignored for PNG. */
+	int32 Quality = 85;
+	/** Downscale (never upscale) to fit within these bounds, keeping the aspect ratio; 0 = unbounded. */
+	int32 MaxWidth = 0;
+	int32 MaxHeight = 0;
+};
+
+/**
+ * Screenshot encoding: optional downscale, opaque alpha, PNG or JPEG
+ * compression. Independent of viewports and of the game thread, so
+ * take_screenshot runs it on the server thread after only the pixel read-back
+ * was marshalled to the game thread, and it can be exercised with synthetic
+ * bitmaps.
+ */
+class UNREALMCP_API FMCPImageEncoder
+{
+public:
+	/** "png", "jpg" or "jpeg" (case-insensitive). */
+	static bool ParseFormat(const FString& Name, EMCPImageFormat& OutFormat);
+	static const TCHAR* GetExtension(EMCPImageFormat Format);
+	static const TCHAR* GetMimeType(EMCPImageFormat Format);
+
+	/** Size a Width x Height image is encoded at under Options. */
+	static FIntPoint GetOutputSize(int32 Width, int32 Height, const FMCPImageEncodeOptions& Options);
+
+	/**
+	 * Encode Image into OutBytes. Image is resized and made opaque in place.
+	 * Safe on any thread once LoadModules() has run on the game thread.
+	 */
+	static bool Encode(FMCPImage& Image, const FMCPImageEncodeOptions& Options, TArray<uint8>& OutBytes, FString& OutError);
+
+	/** Load the ImageWrapper module (game thread). */
+	static void LoadModules();
+};
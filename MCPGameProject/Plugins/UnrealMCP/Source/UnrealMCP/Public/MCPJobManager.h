@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Containers/Ticker.h"
+#include "MCPCommandRegistry.h"
+
+/** Lifecycle of a job submitted to FMCPJobManager. */
+enum class EMCPJobState : uint8
+{
+	Queued,
+	Running,
+	Finished,
+	Cancelled,
+};
+
+/**
+ * Long-running editor work that is advanced a slice at a time on the game
+ * thread. Subclasses keep their own cursor and results; FMCPJobManager calls
+ * Step() once per frame with a deadline and reports progress to clients.
+ */
+class UNREALMCP_API FMCPJob
+{
+public:
+	virtual ~FMCPJob() = default;
+
+	/** Do work until FPlatformTime::Seconds() reaches Deadline. Returns true once the job is finished. */
+	virtual bool Step(double Deadline) = 0;
+
+	/** Progress in work units (blueprints, actors...). Total may grow while the job discovers work. */
+	virtual int32 GetCompleted() const = 0;
+	virtual int32 GetTotal() const = 0;
+
+	/** Number of per-item results produced so far; results are append-only. */
+	virtual int32 GetNumResults() const = 0;
+	virtual TSharedPtr<FJsonValue> GetResult(int32 Index) const = 0;
+
+	/** Totals reported with every status poll (counts so far, and the final summary once finished). */
+	virtual void WriteSummary(FJsonObject& OutSummary) const {}
+
+	/** Release anything held between steps; Step() is not called again afterwards. */
+	virtual void Cancel() {}
+};
+
+/**
+ * Runs FMCPJob instances in submission order on the core ticker, giving the
+ * job at the head of the queue a time budget each frame, and serves
+ * get_job_status / cancel_job / list_jobs.
+ *
+ * Results are streamed: a status poll returns the results produced since the
+ * client's cursor, so a 3,000-item job never has to be sent in one reply.
+ *
+ * Game thread only. Owned by UUnrealMCPBridge and shared with the command
+ * modules that submit jobs; Stop() from Deinitialize() cancels running jobs.
+ */
+class UNREALMCP_API FMCPJobManager
+{
+public:
+	~FMCPJobManager();
+
+	void Stop();
+
+	/** Register the job status commands into the central registry. */
+	void RegisterCommands(FMCPCommandRegistry& Registry);
+
+	/** Queue Job and return its id. BudgetMs is the game-thread time it may use per frame. */
+	FString Submit(const FString& Kind, const TSharedRef<FMCPJob>& Job, double BudgetMs);
+
+	/** Status object (the same one get_job_status returns) for JobId, or null if unknown. */
+	TSharedPtr<FJsonObject> DescribeJob(const FString& JobId, int32 Cursor, int32 MaxResults) const;
+
+private:
+	struct FJobRecord
+	{
+		FString Id;
+		FString Kind;
+		TSharedPtr<FMCPJob> Job;
+		EMCPJobState State = EMCPJobState::Queued;
+		double BudgetSeconds = 0.01;
+		double SubmitTime = 0.0;
+		double StartTime = 0.0;
+		double EndTime = 0.0;
+		/** Game-thread time actually spent in Step(). */
+		double BusySeconds = 0.0;
+	};
+
+	bool Tick(float DeltaTime);
+	void EnsureTicking();
+	void PruneFinished();
+	const FJobRecord* FindRecord(const FString& JobId) const;
+
+	TSharedPtr<FJsonObject> HandleGetJobStatus(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleCancelJob(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleListJobs(const TSharedPtr<FJsonObject>& Params);
+
+	/** Submission order; finished jobs are kept for a while so clients can collect results. */
+	TArray<FJobRecord> Jobs;
+	int32 NextJobNumber = 1;
+
+#if ENGINE_MAJOR_VERSION >= 5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+	bool bTicking = false;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Misc/OutputDevice.h"
+#include "MCPCommandRegistry.h"
+#include <atomic>
+
+/**
+ * Output device that keeps the most recent log lines in memory, each with a
+ * sequence number, category, verbosity and UTC timestamp, so query_log can
+ * answer "errors since N" in time proportional to the ring, not the log file,
+ * including lines not yet flushed to disk and across log file rotation.
+ *
+ * The ring is a fixed array of slots written without locks: a writer claims
+ * the next sequence number atomically and publishes the slot seqlock-style,
+ * and readers discard any slot that changed while they copied it. Messages
+ * longer than MaxMessageChars are truncated.
+ *
+ * Lifetime: owned by UUnrealMCPBridge; Start()/Stop() add and remove the
+ * device from GLog in Initialize()/Deinitialize().
+ */
+class UNREALMCP_API FMCPLogCapture : public FOutputDevice
+{
+public:
+	static constexpr int32 MaxMessageChars = 512;
+
+	explicit FMCPLogCapture(int32 InCapacity = 8192);
+	virtual ~FMCPLogCapture();
+
+	void Start();
+	void Stop();
+
+	/** Register query_log into the central registry. */
+	void RegisterCommands(FMCPCommandRegistry& Registry);
+
+	//~ FOutputDevice
+	virtual void Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual bool CanBeUsedOnAnyThread() const override { return true; }
+	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+
+private:
+	struct FSlot
+	{
+		/** Sequence of the entry held, 0 while empty or being written. */
+		std::atomic<uint64> Sequence{0};
+		int64 Ticks = 0;
+		FName Category;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+		int32 Length = 0;
+		bool bTruncated = false;
+		TCHAR Text[MaxMessageChars];
+	};
+
+	/** Copy of one slot taken by a reader. */
+	struct FEntry
+	{
+		uint64 Sequence = 0;
+		int64 Ticks = 0;
+		FName Category;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+		int32 Length = 0;
+		bool bTruncated = false;
+		TCHAR Text[MaxMessageChars + 1];
+	};
+
+	/** Copy the entry with Sequence into OutEntry; false if it was overwritten or is still being written. */
+	bool ReadEntry(uint64 Sequence, FEntry& OutEntry) const;
+	/** True when Sequence is claimed by a writer that has not published it yet (as opposed to overwritten). */
+	bool IsPending(uint64 Sequence) const;
+
+	TSharedPtr<FJsonObject> HandleQueryLog(const TSharedPtr<FJsonObject>& Params);
+
+	const int32 Capacity;
+	TUniquePtr<FSlot[]> Slots;
+	/** Sequence of the last claimed entry; sequences start at 1. */
+	std::atomic<uint64> LastSequence{0};
+	bool bStarted = false;
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/ObjectKey.h"
+#include "Modules/ModuleManager.h"
+
+class FProperty;
+
+/** Where a property path ended up: the value to read or write and the object that owns it. */
+struct FMCPPropertyTarget
+{
+	/** Object the value lives in (the last sub-object on the path); receives the edit notifications. */
+	UObject* Owner = nullptr;
+	/** Top-level property of Owner that contains the value. */
+	FProperty* MemberProperty = nullptr;
+	/** Property describing the value itself (an array's inner property after "[i]", etc.). */
+	FProperty* Property = nullptr;
+	void* ValuePtr = nullptr;
+};
+
+/**
+ * Property paths into objects: dotted members, "[i]" indices into arrays and
+ * fixed-size arrays, "[key]" into maps, and object properties followed into
+ * their sub-objects, e.g. "StaticMeshComponent.BodyInstance.MassInKgOverride"
+ * or "Tags[2]". On actors a leading segment may also name a component.
+ *
+ * Each (UClass, path) is parsed and its FProperty chain looked up once; later
+ * calls only walk the cached chain. A path that crosses into a sub-object is
+ * cached in hops, keyed by the sub-object's runtime class, so derived
+ * component classes still resolve their own properties. The cache is dropped
+ * when modules load, after hot reload / live coding, and after any blueprint
+ * compile, since those recreate FProperty objects.
+ *
+ * SetProperties() applies many values in one call with a single
+ * PreEditChange/PostEditChange pair per owning object; ReadProperties()
+ * serializes only the requested values.
+ *
+ * Game thread only. UUnrealMCPBridge calls Start()/Stop() from
+ * Initialize()/Deinitialize().
+ */
+class UNREALMCP_API FMCPPropertyPath
+{
+public:
+	static FMCPPropertyPath& Get();
+
+	void Start();
+	void Stop();
+
+	/**
+	 * Resolve Path on Object. With bAllowGrow, "[i]" one past the end of an
+	 * array appends an element and a missing map key adds it.
+	 */
+	bool Resolve(UObject* Object, const FString& Path, FMCPPropertyTarget& OutTarget, FString& OutError,
+		bool bAllowGrow = false);
+
+	/**
+	 * Set each path in Values (path -> JSON value) on Object. Values are
+	 * converted per property type: numbers, bools, strings, names, text, enums
+	 * by (optionally qualified) name or number, objects by path, structs from
+	 * JSON objects or numeric arrays ([x, y, z]), containers from JSON arrays /
+	 * objects, and anything else from UE text form ("(X=1,Y=2)").
+	 *
+	 * Every owning object gets one Modify()/PreEditChange()/PostEditChange()
+	 * around all of its edits. OutErrors receives "path: reason" for the
+	 * values that could not be set; returns the number that were.
+	 */
+	int32 SetProperties(UObject* Object, const TArray<TPair<FString, TSharedPtr<FJsonValue>>>& Values,
+		TArray<FString>& OutErrors);
+
+	/** SetProperties() with the paths and values of a JSON object ({"Tags[0]": "A", "bHidden": true}). */
+	int32 SetProperties(UObject* Object, const FJsonObject& Values, TArray<FString>& OutErrors);
+
+	/** Convert Value into the property value at ValuePtr (no edit notifications). */
+	static bool SetValueFromJson(FProperty* Property, void* ValuePtr, UObject* Owner,
+		const TSharedPtr<FJsonValue>& Value, FString& OutError);
+
+	/**
+	 * Read Paths from Object into {path: value}; paths that do not resolve go
+	 * to OutErrors as "path: reason". With no paths, every editable (CPF_Edit)
+	 * property of Object's class is read, from a per-class list built once, so
+	 * reading thousands of objects of one class shares the same plan.
+	 */
+	TSharedPtr<FJsonObject> ReadProperties(UObject* Object, const TArray<FString>& Paths, TArray<FString>& OutErrors);
+
+	/**
+	 * The value at ValuePtr as JSON: enums by name, structs as objects,
+	 * arrays and sets as arrays, maps as objects (or [key, value] pairs when
+	 * keys are not strings / numbers) and object references as paths.
+	 * Sub-objects are never expanded.
+	 */
+	static TSharedPtr<FJsonValue> ValueToJson(FProperty* Property, const void* ValuePtr);
+
+private:
+	struct FStep
+	{
+		enum class EKind : uint8
+		{
+			Member,       // Property looked up in the current struct / class
+			StaticIndex,  // element of a fixed-size (ArrayDim > 1) member
+			ArrayIndex,   // element of a TArray
+			MapKey,       // value of a TMap entry
+		};
+
+		EKind Kind = EKind::Member;
+		FProperty* Property = nullptr;
+		int32 Index = 0;
+		FString Key;
+	};
+
+	/** Steps within one object; Remainder is the rest of the path inside the sub-object the last step points at. */
+	struct FCompiledPath
+	{
+		TArray<FStep> Steps;
+		FString Remainder;
+		FString Error;
+	};
+
+	enum class EWalkResult : uint8
+	{
+		Ok,
+		NeedsGrow,  // a container on the path is missing the element; resolve again with bAllowGrow
+		Failed,
+	};
+
+	const FCompiledPath& Compile(UClass* Class, const FString& Path);
+	static void CompileInto(UClass* Class, const FString& Path, FCompiledPath& Out);
+	EWalkResult Walk(UObject* Object, const FString& Path, bool bAllowGrow, FMCPPropertyTarget& OutTarget,
+		FString& OutError, int32 Depth);
+
+	const TArray<FProperty*>& GetEditableProperties(UClass* Class);
+
+	void Invalidate()
+	{
+		Cache.Reset();
+		EditableProperties.Reset();
+	}
+	void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+
+	TMap<TPair<FObjectKey, FString>, FCompiledPath> Cache;
+	TMap<FObjectKey, TArray<FProperty*>> EditableProperties;
+
+	bool bStarted = false;
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+};
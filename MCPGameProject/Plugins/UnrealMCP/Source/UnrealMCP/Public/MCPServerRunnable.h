@@ -4,11 +4,16 @@
 #include "HAL/Runnable.h"
 #include "Sockets.h"
 #include "Interfaces/IPv4/IPv4Address.h"
+#include <atomic>
 
 class UUnrealMCPBridge;
+class FRunnableThread;
+class FMCPClientConnection;
 
 /**
- * Runnable class for the MCP server thread
+ * Accept loop of the MCP server thread. Every accepted client is served by
+ * its own FMCPClientConnection thread, so a client may keep several
+ * connections open and have thread-safe commands run concurrently.
  */
 class FMCPServerRunnable : public FRunnable
 {
@@ -22,13 +27,79 @@ public:
 	virtual void Stop() override;
 	virtual void Exit() override;
 
-protected:
-	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
-	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	/** Clients served at once; further connections are closed right after accept. */
+	static constexpr int32 MaxConnections = 16;
 
 private:
+	/** Delete the connections whose thread has finished (all of them with bAll). */
+	void ReapConnections(bool bAll);
+
 	UUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
-	bool bRunning;
-}; 
\ No newline at end of file
+	/** Only touched by the server thread. */
+	TArray<TUniquePtr<FMCPClientConnection>> Connections;
+	std::atomic<bool> bRunning;
+};
+
+/**
+ * One client socket, served on its own thread.
+ *
+ * Each request is a 4-byte big-endian length followed by that many bytes of
+ * UTF-8 JSON ({"type": ..., "params": {...}}), and is answered with a frame
+ * of the same form. A request starting with '{' is instead read as one bare
+ * JSON object and answered unframed, which keeps hand-written socket scripts
+ * working. Requests may be pipelined: everything already received is
+ * answered in order, and every request gets exactly one response, so the
+ * client can match responses to requests by position.
+ */
+class FMCPClientConnection : public FRunnable
+{
+public:
+	FMCPClientConnection(UUnrealMCPBridge* InBridge, FSocket* InSocket, int32 InId);
+	/** Stops and joins the thread, then destroys the socket. */
+	virtual ~FMCPClientConnection();
+
+	bool Start();
+	bool IsFinished() const { return bFinished; }
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	/** Largest accepted request frame; a longer length prefix closes the connection. */
+	static constexpr uint32 MaxFrameBytes = 64 * 1024 * 1024;
+
+private:
+	/** Wait for and append the next chunk of input; false once the client is gone. */
+	bool ReceiveMore();
+
+	/**
+	 * Take the next complete request starting at ReadPos. Returns false when
+	 * more input is needed; bOutProtocolError is set for input that can never
+	 * become a request.
+	 */
+	bool TakeRequest(int32& OutStart, int32& OutLength, bool& bOutFramed, bool& bOutProtocolError);
+
+	/** Execute one request and write its response. */
+	bool HandleRequest(const uint8* Data, int32 Length, bool bFramed);
+
+	bool SendAll(const uint8* Data, int32 Length);
+
+	UUnrealMCPBridge* Bridge;
+	FSocket* Socket;
+	int32 Id;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bRunning;
+	std::atomic<bool> bFinished;
+
+	/** Received bytes; everything before ReadPos has been handled. */
+	TArray<uint8> Buffer;
+	int32 ReadPos = 0;
+	TArray<uint8> ReceiveChunk;
+
+	/** Scan state for an unframed JSON request, so each byte is looked at once. */
+	int32 JsonScanPos = 0;
+	int32 JsonDepth = 0;
+	bool bJsonInString = false;
+	bool bJsonEscape = false;
+};
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Read-only view of a whole file: memory-mapped when the platform supports
+ * it, otherwise loaded into memory. UTF-16 files (with a BOM) are converted
+ * and presented as UTF-8. Close the view before the file is replaced.
+ */
+class UNREALMCP_API FMCPFileView
+{
+public:
+	FMCPFileView();
+	~FMCPFileView();
+
+	bool Open(const FString& Path, FString& OutError);
+	void Close();
+
+	const uint8* GetData() const { return Data; }
+	int64 GetSize() const { return Size; }
+
+	/** Offset of the text after a UTF-8 byte order mark (0 or 3). */
+	int64 GetTextStart() const;
+
+private:
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+	TArray64<uint8> Loaded;
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+};
+
+/**
+ * A text file as lines (without terminators) plus what is needed to write it
+ * back the same way: byte order mark, line ending style and final newline.
+ * Line endings follow the file's first line break.
+ */
+struct UNREALMCP_API FMCPTextLines
+{
+	TArray<FString> Lines;
+	bool bTrailingNewline = true;
+	bool bCRLF = false;
+	bool bBom = false;
+
+	static FMCPTextLines Parse(const uint8* Data, int64 Size);
+	/** Split Text on line breaks; a final line break does not start another line. */
+	static TArray<FString> SplitLines(const FString& Text);
+	TArray<uint8> ToBytes() const;
+};
+
+/** Replace lines [StartLine, EndLine] (1-based, inclusive) with NewLines; EndLine == StartLine - 1 inserts before StartLine. */
+struct FMCPLineEdit
+{
+	int32 StartLine = 0;
+	int32 EndLine = 0;
+	TArray<FString> NewLines;
+};
+
+struct FMCPSourceSearchOptions
+{
+	FString Pattern;
+	bool bRegex = false;
+	/** Case-insensitive matching folds ASCII letters only. */
+	bool bCaseSensitive = true;
+	/** Absolute directories to scan recursively. */
+	TArray<FString> Roots;
+	/**
+	 * Wildcards ("*.h", "Source/MyGame/*") matched against the file name, or
+	 * against the project-relative path when they contain '/'. An empty
+	 * Include means the usual C++ / C# source extensions.
+	 */
+	TArray<FString> Include;
+	TArray<FString> Exclude;
+	int32 ContextLines = 0;
+	int32 MaxResults = 200;
+	/** 0 = no per-file limit. */
+	int32 MaxPerFile = 0;
+};
+
+struct FMCPSourceMatch
+{
+	/** Relative to the project directory. */
+	FString File;
+	/** 1-based. */
+	int64 Line = 0;
+	/** 1-based, in characters, of the first match on the line. */
+	int32 Column = 0;
+	FString Text;
+	TArray<FString> Before;
+	TArray<FString> After;
+};
+
+struct FMCPSourceSearchResult
+{
+	/** One entry per matching line, in file then line order. */
+	TArray<FMCPSourceMatch> Matches;
+	/** Files actually scanned; past the cut this depends on scheduling, unlike Matches. */
+	int32 FilesSearched = 0;
+	int32 FilesMatched = 0;
+	/** MaxResults was reached before the last file; matches may follow the cut. */
+	bool bTruncated = false;
+};
+
+/** Helpers shared by the source-file commands. All of them are thread-safe. */
+struct UNREALMCP_API FMCPSourceFiles
+{
+	/** Relative paths resolve against the project directory. */
+	static FString ResolvePath(const FString& Path);
+
+	/** Lowercase hex SHA-1 of Data; the content hash reported and checked by the source commands. */
+	static FString HashBytes(const uint8* Data, int64 Size);
+
+	static FString Utf8ToString(const uint8* Data, int64 Size);
+
+	/** The project's Source/ directory and, with bIncludePlugins, the Source/ directories of project plugins. */
+	static TArray<FString> GetSourceRoots(bool bIncludePlugins);
+
+	/**
+	 * Search the files under Options.Roots line by line. Files are mapped and
+	 * scanned in parallel; each is first checked for a literal the pattern
+	 * requires (the pattern itself, or the longest required run of a regex),
+	 * so only candidate files are split into lines or handed to the regex
+	 * engine. Regexes use ICU syntax with ^ / $ anchored at line boundaries.
+	 */
+	static void Search(const FMCPSourceSearchOptions& Options, FMCPSourceSearchResult& OutResult);
+
+	/**
+	 * Apply a unified diff to Text. Hunk headers only hint where a hunk
+	 * starts: its context and removed lines must match exactly, and the match
+	 * closest to the hinted line (after the previous hunk) is used, so line
+	 * counts that are off do not matter. "\ No newline at end of file"
+	 * markers are honoured.
+	 */
+	static bool ApplyUnifiedDiff(FMCPTextLines& Text, const FString& Patch, int32& OutHunks, FString& OutError);
+
+	/** Apply line-range edits, all numbered against the original lines; ranges must not overlap. */
+	static bool ApplyLineEdits(FMCPTextLines& Text, TArray<FMCPLineEdit> Edits, FString& OutError);
+
+	/**
+	 * Write Bytes to a temporary file next to Path and rename it over Path,
+	 * so readers see either the old or the new file, never a partial one.
+	 */
+	static bool WriteFileAtomically(const FString& Path, const TArray<uint8>& Bytes, FString& OutError);
+
+	/** Where the backup of content with this hash lives (Saved/MCPSourceBackups/<hash>.bak). */
+	static FString GetBackupPath(const FString& Hash);
+
+	/**
+	 * Store Data as the backup for Hash unless a backup of that content
+	 * already exists; returns the backup path, or "" on failure.
+	 */
+	static FString StoreBackup(const uint8* Data, int64 Size, const FString& Hash);
+
+	/** True when Data starts with a UTF-16 byte order mark (either endianness). */
+	static bool IsUtf16(const uint8* Data, int64 Size)
+	{
+		return Size >= 2 && ((Data[0] == 0xFF && Data[1] == 0xFE) || (Data[0] == 0xFE && Data[1] == 0xFF));
+	}
+
+	/** True for the second and later bytes of a UTF-8 sequence. */
+	static bool IsUtf8Continuation(uint8 Byte) { return (Byte & 0xC0) == 0x80; }
+};
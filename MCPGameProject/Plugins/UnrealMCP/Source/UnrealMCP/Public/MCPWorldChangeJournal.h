@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/ObjectKey.h"
+#include "MCPCommandRegistry.h"
+
+class AActor;
+class UObject;
+class UWorld;
+struct FPropertyChangedEvent;
+
+/** Kind of actor-level change recorded by FMCPWorldChangeJournal. */
+enum class EMCPWorldChangeType : uint8
+{
+	Added,
+	Removed,
+	TransformChanged,
+	PropertyChanged,
+	Renamed,
+};
+
+/**
+ * Per-world revision counter plus a fixed-size ring buffer of actor changes.
+ *
+ * Fed from editor delegates (actor added/deleted/moved, property edits, label
+ * changes) so clients can mirror a level by polling get_world_changes_since
+ * instead of re-downloading the full actor list. When the requested revision
+ * has already been overwritten in the ring, the command falls back to a full
+ * snapshot.
+ *
+ * Lifetime: owned by UUnrealMCPBridge; Start()/Stop() bind and unbind the
+ * delegates from Initialize()/Deinitialize().
+ */
+class UNREALMCP_API FMCPWorldChangeJournal
+{
+public:
+	explicit FMCPWorldChangeJournal(int32 InCapacity = 8192);
+	~FMCPWorldChangeJournal();
+
+	void Start();
+	void Stop();
+
+	/** Register get_world_changes_since into the central registry. */
+	void RegisterCommands(FMCPCommandRegistry& Registry);
+
+	/** Current revision of World (0 when the world is not journaled yet). */
+	uint64 GetRevision(const UWorld* World) const;
+
+	/**
+	 * Revision of the last change recorded for Actor (0 if none since the world
+	 * was loaded). After an undo/redo every actor reports at least the reset
+	 * revision, since undo does not say which actors it touched.
+	 */
+	uint64 GetActorRevision(const AActor* Actor) const;
+
+private:
+	struct FChange
+	{
+		uint64 Revision = 0;
+		EMCPWorldChangeType Type = EMCPWorldChangeType::PropertyChanged;
+		FName ActorName;
+		FString Detail;   // property name for PropertyChanged, new label for Renamed
+		TWeakObjectPtr<AActor> Actor;
+	};
+
+	struct FWorldJournal
+	{
+		FGuid Epoch = FGuid::NewGuid();
+		/** Starts at 1 so that revision 0 always means "client has no state". */
+		uint64 Revision = 1;
+		/** Oldest revision whose entry is still in the ring; anything older needs a snapshot. */
+		uint64 FirstRetained = 2;
+		/** Revision of the last undo/redo; a floor for every actor's revision. */
+		uint64 ResetRevision = 0;
+		TArray<FChange> Ring;
+		/** Last revision per actor; never wraps, unlike the ring. */
+		TMap<FObjectKey, uint64> ActorRevisions;
+	};
+
+	void Record(AActor* Actor, EMCPWorldChangeType Type, const FString& Detail = FString());
+	FWorldJournal* FindJournal(const UWorld* World);
+
+	// Delegate handlers
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnActorMoved(AActor* Actor);
+	void OnActorLabelChanged(AActor* Actor);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void OnPostUndoRedo();
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	TSharedPtr<FJsonObject> HandleGetWorldChangesSince(const TSharedPtr<FJsonObject>& Params);
+
+	int32 Capacity;
+	TMap<FObjectKey, FWorldJournal> Journals;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle PostUndoRedoHandle;
+	FDelegateHandle WorldCleanupHandle;
+	bool bStarted = false;
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Json.h"
+#include "UnrealMCPBatchCommandlet.generated.h"
+
+class UUnrealMCPBridge;
+
+/**
+ * Runs an operation script (a list of registry commands) over many maps
+ * without the editor UI, e.g. to audit every level with run_level_validation.
+ *
+ *   UnrealEditor-Cmd Project.uproject -run=UnrealMCPBatch
+ *       -script=Ops.json [-maps=/Game/A,/Game/B | -mapsfile=Maps.txt | -mappath=/Game/Maps]
+ *       [-output=Result.json] [-shards=N]
+ *
+ * The script is {"commands": [{"type": "...", "params": {...}}], "save": false}
+ * (a bare array of commands is accepted too). Each map is loaded, every command
+ * is run through the bridge's registry, and garbage is collected before the
+ * next map so memory does not grow with the map count. Unless "save" is set,
+ * packages dirtied by the script are discarded.
+ *
+ * With -shards=N (N > 1) this process only plans: it splits the maps across
+ * N child commandlets, waits for them, and merges their JSON outputs.
+ */
+UCLASS()
+class UNREALMCP_API UUnrealMCPBatchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UUnrealMCPBatchCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Maps from -maps, -mapsfile or -mappath (all maps under a content path), sorted. */
+	static bool GatherMaps(const FString& Params, TArray<FString>& OutMaps, FString& OutError);
+
+	/** Run the script over Maps in this process; returns the result document. */
+	static TSharedPtr<FJsonObject> RunMaps(UUnrealMCPBridge* Bridge, const TArray<FString>& Maps,
+		const TArray<TSharedPtr<FJsonValue>>& Commands, bool bSave);
+
+	/** Spawn ShardCount children over Maps and merge their outputs. */
+	static TSharedPtr<FJsonObject> RunSharded(const FString& ScriptPath, const TArray<FString>& Maps,
+		int32 ShardCount, const FString& WorkDir);
+};
@@ -9,6 +9,10 @@
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "MCPCommandRegistry.h"
+#include "MCPWorldChangeJournal.h"
+#include "MCPAssetNameIndex.h"
+#include "MCPJobManager.h"
+#include "MCPLogCapture.h"
 #include "Commands/UnrealMCPEditorCommands.h"
 #include "Commands/UnrealMCPBlueprintCommands.h"
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
@@ -19,6 +23,7 @@
 #include "Commands/UnrealMCPDiagnosticsCommands.h"
 #include "Commands/UnrealMCPTestCommands.h"
 #include "Commands/UnrealMCPMaterialCommands.h"
+#include "Commands/UnrealMCPInstancingCommands.h"
 #include "UnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
@@ -55,6 +60,10 @@ public:
 	// Command execution
 	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+	// Run a registry command on the calling thread, unwrapped (used by UUnrealMCPBatchCommandlet,
+	// which already runs on the game thread and would deadlock in ExecuteCommand)
+	TSharedPtr<FJsonObject> ExecuteRegistryCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
 private:
 	// Editor menu integration
 	void RegisterMenus();
@@ -84,6 +93,22 @@ private:
 	TSharedPtr<FUnrealMCPDiagnosticsCommands>    DiagnosticsCommands;
 	TSharedPtr<FUnrealMCPTestCommands>           TestCommands;
 	TSharedPtr<FUnrealMCPMaterialCommands>       MaterialCommands;
+	TSharedPtr<FUnrealMCPInstancingCommands>     InstancingCommands;
+
+	// Actor change journal backing get_world_changes_since (delegates bound in Initialize)
+	TSharedPtr<FMCPWorldChangeJournal>           ChangeJournal;
+
+	// Trigram index over asset names, shared with AssetCommands (started in Initialize)
+	TSharedPtr<FMCPAssetNameIndex, ESPMode::ThreadSafe> AssetNameIndex;
+
+	// Time-sliced background jobs (validate_blueprints) and their status commands
+	TSharedPtr<FMCPJobManager>                   JobManager;
+
+	// Log lines captured from GLog for query_log (attached in Initialize)
+	TSharedPtr<FMCPLogCapture>                   LogCapture;
+
+	// Runs a command on the calling thread and returns the serialized response
+	FString DispatchCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
 	// Built-in special commands (not routed via registry)
 	TSharedPtr<FJsonObject> ExecuteBatchCommand(const TSharedPtr<FJsonObject>& Params);
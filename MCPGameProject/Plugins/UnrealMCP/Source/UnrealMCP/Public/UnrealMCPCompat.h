@@ -27,3 +27,16 @@
 #else
 	#define MCP_ENHANCED_INPUT_SUPPORTED 0
 #endif
+
+// ---------------------------------------------------------------------------
+// Property text import: FProperty::ImportText_Direct (UE 5.1+) replaced
+// ImportText, whose argument order differs. Evaluates to the end of the
+// parsed text, or null when Buffer could not be parsed.
+// ---------------------------------------------------------------------------
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
+	#define MCP_IMPORT_TEXT(Property, Buffer, Data, Owner, ErrorText) \
+		(Property)->ImportText_Direct((Buffer), (Data), (Owner), PPF_None, (ErrorText))
+#else
+	#define MCP_IMPORT_TEXT(Property, Buffer, Data, Owner, ErrorText) \
+		(Property)->ImportText((Buffer), (Data), PPF_None, (Owner), (ErrorText))
+#endif
@@ -67,7 +67,8 @@ public class UnrealMCP : ModuleRules
 				"GameplayTags",     // For tag operations
 				"LiveCoding",       // For hot-reload / compile status queries
 				"EngineSettings",   // For UGeneralProjectSettings
-				"MaterialEditor"    // For UMaterialEditingLibrary (create/connect material expressions)
+				"MaterialEditor",   // For UMaterialEditingLibrary (create/connect material expressions)
+				"ImageWrapper"      // For PNG/JPEG screenshot encoding off the game thread
 			}
 		);
 
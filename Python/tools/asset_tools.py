@@ -26,28 +26,134 @@ def register_asset_tools(mcp: FastMCP):
         path: str = "/Game/",
         recursive: bool = True,
         filter_class: Optional[str] = None,
+        classes: List[str] = None,
+        package_paths: List[str] = None,
+        tags: Dict[str, str] = None,
+        fields: List[str] = None,
+        limit: int = 0,
+        cursor: str = None,
     ) -> Dict[str, Any]:
-        """List assets in a Content Browser directory.
+        """List assets using server-side asset registry filters.
 
         Args:
             path: Content Browser directory to search (e.g. '/Game/').
             recursive: Whether to search subdirectories.
-            filter_class: Optional class filter (e.g. 'StaticMesh', 'Blueprint').
+            filter_class: Optional class filter (e.g. 'StaticMesh', 'Blueprint'); subclasses included.
+            classes: Additional class names or paths (e.g. '/Script/Engine.Texture2D').
+            package_paths: Additional directories to search.
+            tags: Asset registry tag filter; an empty value only requires the tag to exist.
+            fields: Subset of path, name, class, class_path, package, package_path, tags.
+            limit: Page size (0 = return everything).
+            cursor: next_cursor value from the previous page.
+
+        Returns:
+            Dict with assets, count, total_matched and next_cursor when more pages remain.
+
+        Example:
+            list_assets(path="/Game/Props", filter_class="StaticMesh", fields=["path"], limit=500)
         """
         params: Dict[str, Any] = {"path": path, "recursive": recursive}
         if filter_class:
-            params["filter_class"] = filter_class
+            params["class_filter"] = filter_class
+        if classes:
+            params["classes"] = classes
+        if package_paths:
+            params["package_paths"] = package_paths
+        if tags:
+            params["tags"] = {key: (value if value else None) for key, value in tags.items()}
+        if fields:
+            params["fields"] = fields
+        if limit:
+            params["limit"] = limit
+        if cursor:
+            params["cursor"] = cursor
         return send_unreal_command("list_assets", params)
 
     @mcp.tool()
-    def find_asset(ctx: Context, name: str, path: str = "/Game/") -> Dict[str, Any]:
-        """Find an asset by name in the Content Browser.
+    def find_asset(
+        ctx: Context,
+        name: str,
+        path: str = "/Game/",
+        mode: str = "substring",
+        class_name: str = None,
+        limit: int = 50,
+    ) -> Dict[str, Any]:
+        """Find assets by name, ranked by match quality.
 
         Args:
-            name: Asset name to search for (partial match supported).
+            name: Text to search for (case-insensitive).
             path: Root directory to search within.
+            mode: "substring" (name or path contains text), "prefix" (name starts with text)
+                  or "fuzzy" (typo-tolerant, ranked by trigram overlap).
+            class_name: Optional short class name filter (e.g. 'StaticMesh').
+            limit: Maximum number of results.
+
+        Returns:
+            Dict with assets (path, name, class, package, score), count and index_ready.
+
+        Example:
+            find_asset(name="BP_Charcter", mode="fuzzy", limit=5)
+        """
+        params: Dict[str, Any] = {"name": name, "path": path, "mode": mode, "limit": limit}
+        if class_name:
+            params["class"] = class_name
+        return send_unreal_command("find_asset", params)
+
+    @mcp.tool()
+    def get_asset_dependencies(
+        ctx: Context,
+        asset_path: str,
+        depth: int = 1,
+        dependency_type: str = "all",
+        include_script: bool = False,
+        max_nodes: int = 10000,
+    ) -> Dict[str, Any]:
+        """List packages an asset depends on, optionally transitively, without loading anything.
+
+        Args:
+            asset_path: Package or object path (e.g. '/Game/Maps/Main').
+            depth: Levels to follow (1 = direct only, 0 = full transitive closure).
+            dependency_type: "all", "hard" or "soft".
+            include_script: Include /Script/ native packages.
+            max_nodes: Stop after this many packages (result marked truncated).
+
+        Returns:
+            Dict with nodes (package, depth, via), cycles, truncated and cached.
+
+        Example:
+            get_asset_dependencies(asset_path="/Game/Maps/Main", depth=0, dependency_type="hard")
+        """
+        return send_unreal_command("get_asset_dependencies", {
+            "asset_path": asset_path, "depth": depth, "dependency_type": dependency_type,
+            "include_script": include_script, "max_nodes": max_nodes,
+        })
+
+    @mcp.tool()
+    def get_asset_referencers(
+        ctx: Context,
+        asset_path: str,
+        depth: int = 1,
+        dependency_type: str = "all",
+        max_nodes: int = 10000,
+    ) -> Dict[str, Any]:
+        """List packages that reference an asset, optionally transitively, without loading anything.
+
+        Args:
+            asset_path: Package or object path (e.g. '/Game/Meshes/SM_Rock').
+            depth: Levels to follow (1 = direct only, 0 = full transitive closure).
+            dependency_type: "all", "hard" or "soft".
+            max_nodes: Stop after this many packages (result marked truncated).
+
+        Returns:
+            Dict with nodes (package, depth, via), cycles, truncated and cached.
+
+        Example:
+            get_asset_referencers(asset_path="/Game/Meshes/SM_Rock")
         """
-        return send_unreal_command("find_asset", {"name": name, "path": path})
+        return send_unreal_command("get_asset_referencers", {
+            "asset_path": asset_path, "depth": depth, "dependency_type": dependency_type,
+            "max_nodes": max_nodes,
+        })
 
     @mcp.tool()
     def does_asset_exist(ctx: Context, asset_path: str) -> Dict[str, Any]:
@@ -3,7 +3,7 @@ Common helpers for Unreal MCP tools.
 """
 
 import logging
-from typing import Dict, Any
+from typing import Dict, Any, List, Tuple
 
 logger = logging.getLogger("UnrealMCP")
 
@@ -28,6 +28,23 @@ def send_unreal_command(command: str, params: Dict[str, Any] = None) -> Dict[str
         return {"success": False, "message": str(e)}
 
 
+def send_unreal_commands(commands: List[Tuple[str, Dict[str, Any]]]) -> List[Dict[str, Any]]:
+    """Send (command, params) pairs pipelined on one connection; responses come back in order.
+
+    Cheaper than one send_unreal_command per command when a tool issues many
+    independent commands, and unlike "batch" each command keeps its own response.
+    """
+    from unreal_mcp_server import get_unreal_connection
+    try:
+        unreal = get_unreal_connection()
+        if not unreal:
+            return [{"success": False, "message": "Failed to connect to Unreal Engine"} for _ in commands]
+        return unreal.send_commands([(command, params or {}) for command, params in commands])
+    except Exception as e:
+        logger.error(f"[pipelined x{len(commands)}] Error: {e}")
+        return [{"success": False, "message": str(e)} for _ in commands]
+
+
 def make_error(message: str) -> Dict[str, Any]:
     """Return a standard error dict."""
     return {"success": False, "message": message}
@@ -142,21 +142,26 @@ def register_blueprint_tools(mcp: FastMCP):
     def set_blueprint_property(
         ctx: Context,
         blueprint_name: str,
-        property_name: str,
-        property_value
+        property_name: str = None,
+        property_value=None,
+        properties: Dict[str, Any] = None,
     ) -> Dict[str, Any]:
-        """Set a property on a Blueprint class default object.
+        """Set one or several properties on a Blueprint class default object.
 
         Args:
             blueprint_name: Name of the target Blueprint
-            property_name: Name of the property to set
+            property_name: Name or path of the property to set (e.g. "Tags[0]")
             property_value: Value to set the property to
+            properties: {path: value} to set several properties in one call
+                        (used instead of property_name / property_value)
         """
-        return send_unreal_command("set_blueprint_property", {
-            "blueprint_name": blueprint_name,
-            "property_name": property_name,
-            "property_value": property_value,
-        })
+        params: Dict[str, Any] = {"blueprint_name": blueprint_name}
+        if properties:
+            params["properties"] = properties
+        else:
+            params["property_name"] = property_name
+            params["property_value"] = property_value
+        return send_unreal_command("set_blueprint_property", params)
 
     # ------------------------------------------------------------------
     # Blueprint query commands
@@ -231,6 +236,125 @@ def register_blueprint_tools(mcp: FastMCP):
             "blueprint_name": blueprint_name
         })
 
+    @mcp.tool()
+    def export_blueprint(
+        ctx: Context,
+        blueprint_name: str,
+        if_hash: str = None,
+    ) -> Dict[str, Any]:
+        """Export a Blueprint's full structure in one compact, canonical document.
+
+        Covers variables, the component (SCS) tree, and every graph with its nodes,
+        pins and links. Keep the returned hash; passing it back as if_hash returns
+        {"unchanged": true} without re-sending the structure.
+
+        Args:
+            blueprint_name: Name or path of the Blueprint.
+            if_hash: Hash from a previous export_blueprint call.
+
+        Returns:
+            Dict with unchanged, hash and, when changed, blueprint:
+            {name, path, parent_class, variables, components,
+             graphs: [{name, type, nodes: [{id, class, title, member, x, y,
+             pins: [[name, "i"|"o", type, default?]]}], links: [[from_node, from_pin, to_node, to_pin]]}]}
+
+        Example:
+            export_blueprint("BP_Door", if_hash="3f2a...")
+        """
+        params: Dict[str, Any] = {"blueprint_name": blueprint_name}
+        if if_hash:
+            params["if_hash"] = if_hash
+        return send_unreal_command("export_blueprint", params)
+
+    @mcp.tool()
+    def validate_blueprints(
+        ctx: Context,
+        path: str = "/Game",
+        recursive: bool = True,
+        name_filter: str = None,
+        batch_size: int = 50,
+        budget_ms: float = 20.0,
+        include_warnings: bool = True,
+        include_passing: bool = True,
+    ) -> Dict[str, Any]:
+        """Compile every Blueprint under a content path as a background job.
+
+        Returns immediately with a job_id. The editor compiles a few Blueprints
+        per frame (budget_ms of game-thread time), so it stays responsive; poll
+        get_job_status to stream per-Blueprint results as they complete.
+
+        Args:
+            path: Content folder to scan, e.g. "/Game/Blueprints".
+            recursive: Include subfolders.
+            name_filter: Only Blueprints whose asset name contains this substring.
+            batch_size: Blueprints per batch; garbage is collected between batches.
+            budget_ms: Game-thread milliseconds the job may use per frame.
+            include_warnings: Include warning messages in each result.
+            include_passing: Also report Blueprints that compiled cleanly.
+
+        Returns:
+            Dict with job_id, path, total and registry_partial.
+
+        Example:
+            validate_blueprints(path="/Game/Characters", include_passing=False)
+        """
+        params: Dict[str, Any] = {
+            "path": path,
+            "recursive": recursive,
+            "batch_size": batch_size,
+            "budget_ms": budget_ms,
+            "include_warnings": include_warnings,
+            "include_passing": include_passing,
+        }
+        if name_filter:
+            params["name_filter"] = name_filter
+        return send_unreal_command("validate_blueprints", params)
+
+    @mcp.tool()
+    def get_job_status(
+        ctx: Context,
+        job_id: str,
+        cursor: int = 0,
+        max_results: int = 500,
+    ) -> Dict[str, Any]:
+        """Poll a background job (e.g. validate_blueprints) for progress and results.
+
+        Results are streamed: pass the previous response's next_cursor to receive
+        only the results produced since then.
+
+        Args:
+            job_id: Id returned when the job was started.
+            cursor: Index of the first result to return.
+            max_results: Maximum results per reply (0 = all available).
+
+        Returns:
+            Dict with state (queued/running/finished/cancelled), done, completed,
+            total, progress, elapsed_ms, results, next_cursor, has_more_results
+            and summary (running totals; slowest compiles for validate_blueprints).
+
+        Example:
+            get_job_status("validate_blueprints-1", cursor=120)
+        """
+        return send_unreal_command("get_job_status", {
+            "job_id": job_id,
+            "cursor": cursor,
+            "max_results": max_results,
+        })
+
+    @mcp.tool()
+    def cancel_job(ctx: Context, job_id: str) -> Dict[str, Any]:
+        """Cancel a queued or running background job.
+
+        Results produced before the cancel remain available via get_job_status.
+
+        Args:
+            job_id: Id returned when the job was started.
+
+        Returns:
+            Dict with job_id, cancelled and state.
+        """
+        return send_unreal_command("cancel_job", {"job_id": job_id})
+
     # ------------------------------------------------------------------
     # Collision commands
     # ------------------------------------------------------------------
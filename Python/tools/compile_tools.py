@@ -16,7 +16,7 @@ import socket
 import subprocess
 import sys
 import time
-from typing import Dict, Any
+from typing import Dict, Any, List, Optional
 from mcp.server.fastmcp import FastMCP, Context
 from tools.base import send_unreal_command, make_error
 
@@ -130,28 +130,139 @@ def register_compile_tools(mcp: FastMCP):
     def read_cpp_file(
         ctx: Context,
         path: str,
+        start_line: Optional[int] = None,
+        end_line: Optional[int] = None,
+        max_lines: Optional[int] = None,
+        offset: Optional[int] = None,
+        length: Optional[int] = None,
+        if_hash: Optional[str] = None,
     ) -> Dict[str, Any]:
-        """Read a C++ source file from the UE project.
+        """Read a C++ source file (or part of it) from the UE project.
+
+        Every response carries the file's content hash, mtime and size in
+        bytes. Prefer ranges over whole-file reads for large files.
 
         Args:
             path: Path to the file. Relative paths are resolved from the
                   project root directory.
+            start_line: First line to return (1-based).
+            end_line: Last line to return (inclusive).
+            max_lines: Number of lines from start_line (instead of end_line).
+            offset: Byte offset to start at (byte-range mode).
+            length: Number of bytes to return from offset.
+            if_hash: Hash from a previous read; when the file is unchanged the
+                     reply is {"not_modified": true} without content.
+
+        Returns:
+            path, hash, mtime, size and content; line ranges add start_line,
+            end_line, total_lines, has_more; byte ranges add offset, length,
+            next_offset, has_more.
+
+        Example:
+            read_cpp_file("Source/MyGame/MyActor.cpp", start_line=100, max_lines=50)
+        """
+        params: Dict[str, Any] = {"path": path}
+        for key, value in (("start_line", start_line), ("end_line", end_line),
+                           ("max_lines", max_lines), ("offset", offset),
+                           ("length", length), ("if_hash", if_hash)):
+            if value is not None:
+                params[key] = value
+        return send_unreal_command("get_source_file", params)
+
+    @mcp.tool()
+    def search_cpp_source(
+        ctx: Context,
+        pattern: str,
+        regex: bool = False,
+        case_sensitive: bool = True,
+        include_plugins: bool = False,
+        paths: Optional[List[str]] = None,
+        include: Optional[List[str]] = None,
+        exclude: Optional[List[str]] = None,
+        context_lines: int = 0,
+        max_results: int = 200,
+        max_per_file: Optional[int] = None,
+    ) -> Dict[str, Any]:
+        """Search the project's C++ sources for a literal string or regex.
+
+        Use this to locate a symbol before reading a file with read_cpp_file.
+
+        Args:
+            pattern: Text to find (or an ICU regex when regex=True).
+            regex: Treat pattern as a regular expression; ^ and $ match at line boundaries.
+            case_sensitive: False folds ASCII letters only.
+            include_plugins: Also search the Source/ folders of project plugins.
+            paths: Directories to search instead, relative to the project root.
+            include: Wildcards to keep, e.g. ["*.h"] or ["Source/MyGame/Private/*"]
+                     (default: C++ / C# sources).
+            exclude: Wildcards to skip.
+            context_lines: Lines of context before and after each match (max 20).
+            max_results: Maximum matching lines returned (max 5000).
+            max_per_file: Maximum matching lines per file.
+
+        Returns:
+            matches (file, line, column, text, before, after), match_count,
+            files_searched, files_matched, truncated, elapsed_ms.
+
+        Example:
+            search_cpp_source("UFUNCTION\\(.*BlueprintCallable", regex=True, include=["*.h"])
         """
-        return send_unreal_command("get_source_file", {"path": path})
+        params: Dict[str, Any] = {
+            "pattern": pattern,
+            "regex": regex,
+            "case_sensitive": case_sensitive,
+            "include_plugins": include_plugins,
+            "context_lines": context_lines,
+            "max_results": max_results,
+        }
+        for key, value in (("paths", paths), ("include", include),
+                           ("exclude", exclude), ("max_per_file", max_per_file)):
+            if value is not None:
+                params[key] = value
+        return send_unreal_command("search_source", params)
 
     @mcp.tool()
     def write_cpp_file(
         ctx: Context,
         path: str,
-        content: str,
+        content: Optional[str] = None,
+        patch: Optional[str] = None,
+        edits: Optional[List[Dict[str, Any]]] = None,
+        restore_hash: Optional[str] = None,
+        base_hash: Optional[str] = None,
     ) -> Dict[str, Any]:
-        """Write content to a C++ source file (creates an automatic timestamped backup).
+        """Modify a C++ source file. Pass exactly one of content, patch, edits or restore_hash.
+
+        Prefer patch or edits with base_hash over sending the whole file. The
+        file is replaced atomically and only when its content changes; the
+        previous version is backed up once per distinct content under
+        Saved/MCPSourceBackups/<hash>.bak.
 
         Args:
             path: Path to the file. Relative paths are resolved from the project root.
-            content: New file content.
+            content: The whole new file content.
+            patch: Unified diff against the current file (hunk line numbers are
+                   hints; context and removed lines must match exactly).
+            edits: Line-range replacements numbered against the current file:
+                   [{"start_line": 10, "end_line": 12, "text": "..."}]. Use
+                   end_line = start_line - 1 to insert and text "" to delete.
+            restore_hash: Restore the backed-up version with this hash (40 hex characters).
+            base_hash: Hash from read_cpp_file; the write is refused (and
+                       current_hash returned) if the file changed since.
+
+        Returns:
+            path, hash, previous_hash, unchanged, bytes_written, backup_path.
+
+        Example:
+            write_cpp_file("Source/MyGame/MyActor.cpp", base_hash=h,
+                           edits=[{"start_line": 42, "end_line": 42, "text": "    Speed = 600.f;"}])
         """
-        return send_unreal_command("modify_source_file", {"path": path, "content": content})
+        params: Dict[str, Any] = {"path": path}
+        for key, value in (("content", content), ("patch", patch), ("edits", edits),
+                           ("restore_hash", restore_hash), ("base_hash", base_hash)):
+            if value is not None:
+                params[key] = value
+        return send_unreal_command("modify_source_file", params)
 
     @mcp.tool()
     def read_python_tool(
@@ -2,17 +2,14 @@
 Diagnostics Tools for Unreal MCP.
 
 Provides visual perception and actor inspection via the C++ DiagnosticsCommands module.
-Also wraps take_screenshot (from EditorCommands) to return base64-encoded PNG data
-so AI clients can analyse viewport content without disk I/O.
+Also wraps take_screenshot (from EditorCommands) to return the encoded image inline
+(base64 PNG or JPEG) so AI clients can analyse viewport content without disk I/O.
 """
 
-import base64
 import logging
-import os
-import tempfile
 from typing import Dict, Any, Optional
 from mcp.server.fastmcp import FastMCP, Context
-from tools.base import send_unreal_command, make_error
+from tools.base import send_unreal_command, send_unreal_commands, make_error
 
 logger = logging.getLogger("UnrealMCP")
 
@@ -56,75 +53,102 @@ def register_diagnostics_tools(mcp: FastMCP):
         """
         return send_unreal_command("highlight_actor", {"name": name})
 
+    def _screenshot_inline(params: Dict[str, Any]) -> Dict[str, Any]:
+        """take_screenshot with the encoded image returned in the response.
+
+        The editor encodes off the game thread and sends the bytes back as
+        base64, so nothing is written to (or read back from) disk unless
+        params has a filepath. The image is moved to "base64_png" /
+        "base64_jpeg" at the top level of the response.
+        """
+        return _unpack_screenshot(send_unreal_command("take_screenshot", dict(params, inline=True)))
+
+    def _unpack_screenshot(response: Dict[str, Any]) -> Dict[str, Any]:
+        """Move the inline image of a take_screenshot response to the top level."""
+        result = response.get("result")
+        if response.get("status") == "error" or not isinstance(result, dict):
+            return response
+        data = result.pop("data", None)
+        if data is not None:
+            response[f"base64_{result.get('format', 'png')}"] = data
+            response["file_size_bytes"] = result.get("bytes")
+        return response
+
+    def _screenshot_params(
+        filepath: Optional[str],
+        format: str,
+        quality: int,
+        max_width: Optional[int],
+        max_height: Optional[int],
+    ) -> Dict[str, Any]:
+        params: Dict[str, Any] = {"format": format, "quality": quality}
+        if filepath:
+            params["filepath"] = filepath
+        if max_width:
+            params["max_width"] = max_width
+        if max_height:
+            params["max_height"] = max_height
+        return params
+
     @mcp.tool()
     def take_and_read_screenshot(
         ctx: Context,
         filepath: Optional[str] = None,
+        format: str = "png",
+        quality: int = 85,
+        max_width: Optional[int] = None,
+        max_height: Optional[int] = None,
     ) -> Dict[str, Any]:
-        """Take a viewport screenshot and return its content as a base64-encoded PNG.
+        """Take a viewport screenshot and return its content base64-encoded.
 
-        Useful for AI multimodal analysis of the current editor state.
+        Useful for AI multimodal analysis of the current editor state. Encoding
+        happens off the editor's game thread; JPEG with a max_width is much
+        smaller and faster for frequent screenshots.
 
         Args:
-            filepath: Optional file path to save the PNG. A temp file is used
-                      when omitted. The file is NOT deleted so it can be reused.
+            filepath: Optional file path to also save the image to.
+            format: "png" or "jpeg".
+            quality: JPEG quality, 1-100.
+            max_width: Downscale to at most this width (keeps the aspect ratio).
+            max_height: Downscale to at most this height.
+
+        Returns:
+            The take_screenshot response (width, height, bytes, capture_ms,
+            encode_ms, ...) plus base64_png or base64_jpeg.
+
+        Example:
+            take_and_read_screenshot(format="jpeg", quality=70, max_width=1024)
         """
-        if not filepath:
-            tmp = tempfile.NamedTemporaryFile(suffix=".png", delete=False)
-            tmp.close()
-            filepath = tmp.name
-
-        result = send_unreal_command("take_screenshot", {"filepath": filepath})
-        if result.get("status") == "error":
-            return result
-
-        # Read PNG and encode to base64
-        try:
-            with open(filepath, "rb") as f:
-                png_bytes = f.read()
-            b64 = base64.b64encode(png_bytes).decode("utf-8")
-            result["base64_png"] = b64
-            result["file_size_bytes"] = len(png_bytes)
-        except Exception as e:
-            result["base64_error"] = str(e)
-
-        return result
+        return _screenshot_inline(_screenshot_params(filepath, format, quality, max_width, max_height))
 
     @mcp.tool()
     def capture_actor_focused(
         ctx: Context,
         name: str,
         filepath: Optional[str] = None,
+        format: str = "png",
+        quality: int = 85,
+        max_width: Optional[int] = None,
     ) -> Dict[str, Any]:
         """Highlight an actor, then take a screenshot focused on it.
 
-        Returns base64-encoded PNG plus actor screen position for reference.
+        Returns the base64-encoded image plus actor screen position for reference.
 
         Args:
             name: Actor name or editor label.
-            filepath: Optional output PNG path.
+            filepath: Optional output image path.
+            format: "png" or "jpeg".
+            quality: JPEG quality, 1-100.
+            max_width: Downscale to at most this width.
         """
         highlight_result = send_unreal_command("highlight_actor", {"name": name})
         if highlight_result.get("status") == "error":
             return highlight_result
 
-        if not filepath:
-            tmp = tempfile.NamedTemporaryFile(suffix=".png", delete=False)
-            tmp.close()
-            filepath = tmp.name
-
-        screenshot_result = send_unreal_command("take_screenshot", {"filepath": filepath})
+        screenshot_result = _screenshot_inline(_screenshot_params(filepath, format, quality, max_width, None))
         if screenshot_result.get("status") == "error":
             return screenshot_result
 
-        try:
-            with open(filepath, "rb") as f:
-                png_bytes = f.read()
-            screenshot_result["base64_png"] = base64.b64encode(png_bytes).decode("utf-8")
-            screenshot_result["file_size_bytes"] = len(png_bytes)
-        except Exception as e:
-            screenshot_result["base64_error"] = str(e)
-
         screenshot_result["highlighted_actor"] = name
         return screenshot_result
 
@@ -134,25 +158,24 @@ def register_diagnostics_tools(mcp: FastMCP):
 
         Useful as a single-call 'scene snapshot' for AI situational awareness.
         """
-        tmp = tempfile.NamedTemporaryFile(suffix=".png", delete=False)
-        tmp.close()
-
-        camera_info = send_unreal_command("get_viewport_camera_info", {})
-        screenshot = send_unreal_command("take_screenshot", {"filepath": tmp.name})
-        actors = send_unreal_command("get_actors_in_level", {})
+        # Independent queries: pipelined on one connection instead of three round trips
+        camera_info, screenshot, actors = send_unreal_commands([
+            ("get_viewport_camera_info", {}),
+            ("take_screenshot", {"format": "png", "inline": True}),
+            ("get_actors_in_level", {}),
+        ])
+        screenshot = _unpack_screenshot(screenshot)
 
         result: Dict[str, Any] = {
             "success": True,
             "camera": camera_info if camera_info.get("success") else {},
             "actor_count": len(actors.get("actors", [])) if actors.get("success") else 0,
-            "screenshot_path": tmp.name,
         }
 
-        try:
-            with open(tmp.name, "rb") as f:
-                result["base64_png"] = base64.b64encode(f.read()).decode("utf-8")
-        except Exception as e:
-            result["base64_error"] = str(e)
+        if "base64_png" in screenshot:
+            result["base64_png"] = screenshot["base64_png"]
+        else:
+            result["base64_error"] = screenshot.get("error", "Screenshot failed")
 
         return result
 
@@ -25,6 +25,53 @@ def register_editor_tools(mcp: FastMCP):
             return response["result"]["actors"]
         return response.get("actors", [])
 
+    @mcp.tool()
+    def query_actors(
+        ctx: Context,
+        class_name: str = None,
+        tag: str = None,
+        folder: str = None,
+        level: str = None,
+        name: str = None,
+        fields: List[str] = None,
+        layout: str = "rows",
+        limit: int = 500,
+        cursor: str = None,
+    ) -> Dict[str, Any]:
+        """List actors with server-side filters, paging and field projection.
+
+        Prefer this over get_actors_in_level on large levels.
+
+        Args:
+            class_name: Actor class name; subclasses match too (e.g. "StaticMeshActor", "Light")
+            tag: Only actors carrying this tag
+            folder: World Outliner folder (e.g. "Props/Rocks"); subfolders included
+            level: Level package name, full or short (e.g. "/Game/Maps/Main" or "Main")
+            name: Wildcard pattern against actor name or label (e.g. "Wall_*")
+            fields: Subset of ["name","label","class","location","rotation","scale",
+                    "transform","tags","folder","level"]. Defaults to name/class/transform.
+            layout: "rows" (one object per actor) or "columns" (one array per field,
+                    vectors packed flat as [x0,y0,z0,x1,...])
+            limit: Page size; 0 returns every match
+            cursor: The next_cursor value from the previous page
+
+        Returns:
+            Dict with "actors" (rows) or "columns", plus "count", "total_matched"
+            and "next_cursor" when more pages remain.
+
+        Example:
+            query_actors(class_name="StaticMeshActor", fields=["name", "location"],
+                         layout="columns", limit=1000)
+        """
+        params = {"layout": layout, "limit": limit}
+        optional = {
+            "class": class_name, "tag": tag, "folder": folder,
+            "level": level, "name": name, "fields": fields, "cursor": cursor,
+        }
+        params.update({k: v for k, v in optional.items() if v is not None})
+        response = send_unreal_command("get_actors_in_level", params)
+        return response.get("result", response)
+
     @mcp.tool()
     def find_actors_by_name(ctx: Context, pattern: str) -> List[str]:
         """Find actors by name pattern."""
@@ -88,28 +135,198 @@ def register_editor_tools(mcp: FastMCP):
         return send_unreal_command("set_actor_transform", params)
 
     @mcp.tool()
-    def get_actor_properties(ctx: Context, name: str) -> Dict[str, Any]:
-        """Get all properties of an actor."""
-        return send_unreal_command("get_actor_properties", {"name": name})
+    def spawn_actors(
+        ctx: Context,
+        type: str,
+        transforms: List[float],
+        stride: int = 9,
+        names: List[str] = None,
+        name_prefix: str = None,
+        static_mesh: str = None,
+    ) -> Dict[str, Any]:
+        """Spawn many actors of one type in a single undoable transaction.
+
+        Args:
+            type: Actor type, same values as spawn_actor (e.g. StaticMeshActor, PointLight)
+            transforms: Packed transforms, `stride` numbers per actor:
+                        [x, y, z, pitch, yaw, roll, sx, sy, sz, ...]
+            stride: 3 (location), 6 (location+rotation) or 9 (location+rotation+scale)
+            names: Optional explicit names, one per actor (must be unique)
+            name_prefix: Optional prefix for engine-generated unique names
+            static_mesh: Mesh path for StaticMeshActor (e.g. "/Engine/BasicShapes/Cube.Cube")
+
+        Returns:
+            Dict with count, succeeded, failed (index + error) and the spawned names.
+
+        Example:
+            spawn_actors(type="StaticMeshActor", stride=3, name_prefix="Rock",
+                         transforms=[0, 0, 0, 200, 0, 0], static_mesh="/Engine/BasicShapes/Cube.Cube")
+        """
+        params: Dict[str, Any] = {"type": type, "transforms": transforms, "stride": stride}
+        if names:
+            params["names"] = names
+        if name_prefix:
+            params["name_prefix"] = name_prefix
+        if static_mesh:
+            params["static_mesh"] = static_mesh
+        return send_unreal_command("spawn_actors", params)
+
+    @mcp.tool()
+    def set_actor_transforms(
+        ctx: Context,
+        names: List[str],
+        transforms: List[float],
+        stride: int = 9,
+    ) -> Dict[str, Any]:
+        """Set the transforms of many actors in a single undoable transaction.
+
+        Args:
+            names: Actor names or labels
+            transforms: Packed transforms, `stride` numbers per name (see spawn_actors)
+            stride: 3 keeps current rotation/scale, 6 keeps current scale, 9 sets everything
+
+        Example:
+            set_actor_transforms(names=["Rock_1", "Rock_2"], stride=3,
+                                 transforms=[0, 0, 100, 200, 0, 100])
+        """
+        return send_unreal_command("set_actor_transforms", {
+            "names": names,
+            "transforms": transforms,
+            "stride": stride,
+        })
+
+    @mcp.tool()
+    def delete_actors(ctx: Context, names: List[str]) -> Dict[str, Any]:
+        """Delete many actors in a single undoable transaction.
+
+        Args:
+            names: Actor names or labels
+
+        Example:
+            delete_actors(names=["Rock_1", "Rock_2"])
+        """
+        return send_unreal_command("delete_actors", {"names": names})
+
+    @mcp.tool()
+    def get_actor_properties(
+        ctx: Context,
+        name: str,
+        properties: List[str] = None,
+        all_editable: bool = False,
+    ) -> Dict[str, Any]:
+        """Get properties of an actor.
+
+        Without properties / all_editable this returns a fixed summary
+        (transform, class, ...). Otherwise values are read by reflection.
+
+        Args:
+            name: Name of the actor
+            properties: Property paths to read, e.g. ["StaticMeshComponent.CastShadow", "Tags"]
+            all_editable: Read every editable property of the actor's class
+
+        Returns:
+            Dict with name, class, values ({path: value}) and errors ("path: reason").
+
+        Example:
+            get_actor_properties("Lamp_1", properties=["LightComponent.Intensity"])
+        """
+        params: Dict[str, Any] = {"name": name}
+        if properties:
+            params["properties"] = properties
+        if all_editable:
+            params["all_editable"] = True
+        return send_unreal_command("get_actor_properties", params)
+
+    @mcp.tool()
+    def get_actors_properties(
+        ctx: Context,
+        names: List[str] = None,
+        class_name: str = None,
+        properties: List[str] = None,
+        limit: int = 1000,
+    ) -> Dict[str, Any]:
+        """Read the same properties from many actors in one call.
+
+        Args:
+            names: Actor names or labels
+            class_name: Instead of names, every actor of this class (and subclasses)
+            properties: Property paths to read; omit for every editable property
+            limit: Maximum number of actors returned
+
+        Returns:
+            Dict with count, truncated, actors ([{name, class, values, errors?}])
+            and not_found (names that matched no actor).
+
+        Example:
+            get_actors_properties(class_name="StaticMeshActor",
+                                  properties=["StaticMeshComponent.StaticMesh", "StaticMeshComponent.CastShadow"])
+        """
+        params: Dict[str, Any] = {"limit": limit}
+        if names:
+            params["names"] = names
+        if class_name:
+            params["class"] = class_name
+        if properties:
+            params["properties"] = properties
+        return send_unreal_command("get_actors_properties", params)
 
     @mcp.tool()
     def set_actor_property(
         ctx: Context,
         name: str,
-        property_name: str,
-        property_value,
+        property_name: str = None,
+        property_value=None,
+        properties: Dict[str, Any] = None,
     ) -> Dict[str, Any]:
-        """Set a property on an actor.
+        """Set one or several properties on an actor.
+
+        Property names may be paths: dotted members, "[i]" for array elements
+        and "[key]" for map values, e.g. "StaticMeshComponent.BodyInstance.MassInKgOverride"
+        or "Tags[2]". A leading segment may name one of the actor's components.
 
         Args:
             name: Name of the actor
-            property_name: Name of the property to set
+            property_name: Name or path of the property to set
             property_value: Value to set the property to
+            properties: {path: value} to set several properties in one call
+                        (used instead of property_name / property_value)
+
+        Returns:
+            Dict with success and actor_details; with properties, also set
+            (number of values applied) and errors ("path: reason").
+
+        Example:
+            set_actor_property("Lamp_1", properties={"LightComponent.Intensity": 5000, "Tags[0]": "Lit"})
         """
-        return send_unreal_command("set_actor_property", {
-            "name": name,
-            "property_name": property_name,
-            "property_value": property_value,
+        params: Dict[str, Any] = {"name": name}
+        if properties:
+            params["properties"] = properties
+        else:
+            params["property_name"] = property_name
+            params["property_value"] = property_value
+        return send_unreal_command("set_actor_property", params)
+
+    @mcp.tool()
+    def set_actors_properties(
+        ctx: Context,
+        names: List[str],
+        properties: Dict[str, Any],
+    ) -> Dict[str, Any]:
+        """Set the same properties on many actors in a single undoable transaction.
+
+        Args:
+            names: Actor names or labels
+            properties: {path: value}; paths as in set_actor_property
+
+        Returns:
+            Dict with count, succeeded and failed ([{index, error}]).
+
+        Example:
+            set_actors_properties(names=["Rock_1", "Rock_2"], properties={"StaticMeshComponent.CastShadow": False})
+        """
+        return send_unreal_command("set_actors_properties", {
+            "names": names,
+            "properties": properties,
         })
 
     @mcp.tool()
@@ -129,7 +346,7 @@ def register_editor_tools(mcp: FastMCP):
             location: The [x, y, z] world location to spawn at
             rotation: The [pitch, yaw, roll] rotation in degrees
             asset_path: Optional full asset path (e.g. '/Game/Characters/MyBP').
-                        When omitted, defaults to '/Game/Blueprints/<blueprint_name>'.
+                        When omitted, the name is resolved across the whole project.
         """
         params = {
             "blueprint_name": blueprint_name,
@@ -147,6 +364,33 @@ def register_editor_tools(mcp: FastMCP):
 
         return send_unreal_command("spawn_blueprint_actor", params)
 
+    @mcp.tool()
+    def get_world_changes_since(ctx: Context, revision: int = 0, epoch: str = None) -> Dict[str, Any]:
+        """Get actor changes in the editor world since a journal revision.
+
+        Use this to keep a cached view of the level in sync instead of re-listing
+        every actor. Pass revision=0 on the first call to receive a full snapshot;
+        then pass back the "revision" and "epoch" from the previous response.
+
+        Args:
+            revision: Last revision the client has applied (0 = no cached state)
+            epoch: Journal epoch from the previous response; a mismatch (level was
+                   reloaded) returns a snapshot
+
+        Returns:
+            Dict with "revision", "epoch" and either "changes" (each with revision,
+            type = added/removed/transform_changed/property_changed/renamed, name)
+            or "snapshot": true plus the full "actors" list.
+
+        Example:
+            get_world_changes_since(revision=42, epoch="8F3C...")
+        """
+        params: Dict[str, Any] = {"revision": revision}
+        if epoch:
+            params["epoch"] = epoch
+        response = send_unreal_command("get_world_changes_since", params)
+        return response.get("result", response)
+
     # ------------------------------------------------------------------
     # Actor selection
     # ------------------------------------------------------------------
@@ -0,0 +1,170 @@
+"""
+Instancing Tools for Unreal MCP.
+
+This module provides tools for placing many copies of a mesh as instances of a
+single Hierarchical Instanced Static Mesh (HISM) component.
+"""
+
+import logging
+from typing import Dict, List, Any
+from mcp.server.fastmcp import FastMCP, Context
+from tools.base import send_unreal_command, make_error
+
+logger = logging.getLogger("UnrealMCP")
+
+
+def register_instancing_tools(mcp: FastMCP):
+    """Register instancing tools with the MCP server."""
+
+    @mcp.tool()
+    def scatter_instances(
+        ctx: Context,
+        actor_name: str,
+        static_mesh: str = None,
+        transforms: List[float] = None,
+        stride: int = 9,
+        pattern: str = None,
+        origin: List[float] = None,
+        count: List[int] = None,
+        spacing: List[float] = None,
+        extent: List[float] = None,
+        seed: int = 0,
+        random_yaw: bool = True,
+        scale_range: List[float] = None,
+        spline_actor: str = None,
+        align: bool = True,
+        replace: bool = False,
+    ) -> Dict[str, Any]:
+        """Add mesh instances to a HISM actor, creating the actor if needed.
+
+        Provide either packed `transforms` or a procedural `pattern`:
+          - "grid":   origin, count [nx, ny, nz], spacing [sx, sy, sz]
+          - "random": origin (box center), extent (half size), count [n], seed, random_yaw, scale_range [min, max]
+          - "spline": spline_actor, count [n] or spacing [distance], align
+
+        Args:
+            actor_name: HISM holder actor (created when it does not exist)
+            static_mesh: Mesh path, required when creating (e.g. "/Engine/BasicShapes/Cube.Cube");
+                an existing actor gets a new component when none renders this mesh
+            transforms: Packed world transforms, `stride` numbers per instance
+            stride: 3 (location), 6 (location+rotation) or 9 (location+rotation+scale)
+            pattern: "grid", "random" or "spline"
+            origin: Grid origin or random box center
+            count: Grid counts, or a single instance count for random/spline
+            spacing: Grid spacing, or a single distance between spline instances
+            extent: Random box half size
+            seed: Random seed
+            random_yaw: Randomize yaw for the random pattern
+            scale_range: Uniform scale range for the random pattern
+            spline_actor: Actor owning the SplineComponent for the spline pattern
+            align: Orient spline instances along the spline tangent
+            replace: Clear existing instances first
+
+        Returns:
+            Dict with actor_name, created, added, first_index and instance_count.
+
+        Example:
+            scatter_instances(actor_name="Rocks", static_mesh="/Engine/BasicShapes/Cube.Cube",
+                              pattern="grid", origin=[0, 0, 0], count=[100, 100, 1], spacing=[200, 200, 0])
+        """
+        params: Dict[str, Any] = {"actor_name": actor_name, "replace": replace}
+        if static_mesh:
+            params["static_mesh"] = static_mesh
+
+        if pattern:
+            spec: Dict[str, Any] = {"type": pattern}
+            if pattern == "grid":
+                spec["origin"] = origin or [0, 0, 0]
+                spec["count"] = count or [1, 1, 1]
+                spec["spacing"] = spacing or [100, 100, 100]
+            elif pattern == "random":
+                spec["center"] = origin or [0, 0, 0]
+                spec["extent"] = extent or [0, 0, 0]
+                spec["count"] = count[0] if count else 0
+                spec["seed"] = seed
+                spec["random_yaw"] = random_yaw
+                if scale_range:
+                    spec["scale_range"] = scale_range
+            elif pattern == "spline":
+                if not spline_actor:
+                    return make_error("spline pattern requires spline_actor")
+                spec["spline_actor"] = spline_actor
+                spec["align"] = align
+                if count:
+                    spec["count"] = count[0]
+                if spacing:
+                    spec["spacing"] = spacing[0]
+            else:
+                return make_error(f"Unknown pattern '{pattern}' (expected grid, random or spline)")
+            params["pattern"] = spec
+        elif transforms:
+            params["transforms"] = transforms
+            params["stride"] = stride
+        else:
+            return make_error("Provide either transforms or pattern")
+
+        return send_unreal_command("scatter_instances", params)
+
+    @mcp.tool()
+    def remove_instances(
+        ctx: Context,
+        actor_name: str,
+        indices: List[int] = None,
+        box_min: List[float] = None,
+        box_max: List[float] = None,
+    ) -> Dict[str, Any]:
+        """Remove instances from a HISM actor by index or by world-space box.
+
+        Args:
+            actor_name: HISM holder actor
+            indices: Instance indices to remove
+            box_min: Minimum corner of the removal box (used when indices is omitted)
+            box_max: Maximum corner of the removal box
+
+        Returns:
+            Dict with removed and the remaining instance_count.
+
+        Example:
+            remove_instances(actor_name="Rocks", box_min=[-500, -500, -100], box_max=[500, 500, 100])
+        """
+        params: Dict[str, Any] = {"actor_name": actor_name}
+        if indices:
+            params["indices"] = indices
+        elif box_min and box_max:
+            params["box_min"] = box_min
+            params["box_max"] = box_max
+        else:
+            return make_error("Provide either indices or box_min + box_max")
+        return send_unreal_command("remove_instances", params)
+
+    @mcp.tool()
+    def consolidate_to_instances(
+        ctx: Context,
+        actor_names: List[str] = None,
+        min_group_size: int = 2,
+        dry_run: bool = False,
+    ) -> Dict[str, Any]:
+        """Replace groups of identical StaticMeshActors with one HISM actor per group.
+
+        Actors are grouped by level, mesh, material overrides, mobility, collision
+        profile and actor / component tags, so only identically tagged actors merge
+        and each holder is spawned in its group's level with the group's tags.
+        Transforms become instances. The whole conversion is a single undo step.
+
+        Args:
+            actor_names: Only consider these actors (default: every StaticMeshActor in the level)
+            min_group_size: Smallest group worth converting
+            dry_run: Report the grouping and savings without changing the level
+
+        Returns:
+            Dict with groups, skipped, actors_before/after and estimated draw_calls_before/after.
+
+        Example:
+            consolidate_to_instances(dry_run=True)
+        """
+        params: Dict[str, Any] = {"min_group_size": min_group_size, "dry_run": dry_run}
+        if actor_names:
+            params["actor_names"] = actor_names
+        return send_unreal_command("consolidate_to_instances", params)
+
+    logger.info("Instancing tools registered successfully")
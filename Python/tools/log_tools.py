@@ -10,9 +10,11 @@ import logging
 import os
 import re
 import glob
-from typing import Dict, Any, Optional, List
+import threading
+from collections import Counter, OrderedDict
+from typing import Dict, Any, Optional, List, Tuple
 from mcp.server.fastmcp import FastMCP, Context
-from tools.base import make_error
+from tools.base import send_unreal_command, make_error
 
 logger = logging.getLogger("UnrealMCP")
 
@@ -27,6 +29,225 @@ _ERROR_KEYWORDS = [
     "exception", "crash", "Access violation", "Unhandled", "LogOutputDevice: Error"
 ]
 _WARNING_KEYWORDS = ["Warning:", "warning:"]
+_FATAL_KEYWORDS = ["Fatal:", "fatal:", "Assertion failed"]
+
+# Byte-level equivalents used by the incremental scanner; they run over whole
+# chunks in C instead of line by line in Python
+_ERROR_RE_B = re.compile(b"|".join(re.escape(k.encode()) for k in _ERROR_KEYWORDS))
+_WARNING_RE_B = re.compile(b"|".join(re.escape(k.encode()) for k in _WARNING_KEYWORDS))
+_FATAL_RE_B = re.compile(b"|".join(re.escape(k.encode()) for k in _FATAL_KEYWORDS))
+# "...][ 12]Category:" - keyed on the frame counter, twice as fast as anchoring at ^
+_CATEGORY_RE_B = re.compile(rb"\]\[ *\d+\]([^:\n]+):")
+
+_TAIL_BLOCK = 64 * 1024
+_SCAN_CHUNK = 8 * 1024 * 1024
+_HEAD_BYTES = 256
+_MAX_LINE_BYTES = 64 * 1024
+_MAX_INDEXED_FILES = 8
+
+
+def _read_tail(path: str, lines: int) -> List[str]:
+    """Return the last `lines` lines of a file, reading backwards in blocks."""
+    if lines <= 0:
+        return []
+    with open(path, "rb") as f:
+        f.seek(0, os.SEEK_END)
+        pos = f.tell()
+        blocks: List[bytes] = []
+        newlines = 0
+        # One newline more than requested guarantees the first kept line is complete
+        while pos > 0 and newlines <= lines:
+            size = min(_TAIL_BLOCK, pos)
+            pos -= size
+            f.seek(pos)
+            block = f.read(size)
+            blocks.append(block)
+            newlines += block.count(b"\n")
+    data = b"".join(reversed(blocks))
+    tail = data.splitlines(keepends=True)
+    if pos > 0:
+        tail = tail[1:]
+    return [line.decode("utf-8", errors="replace") for line in tail[-lines:]]
+
+
+def _read_line_at(f, offset: int) -> str:
+    """Read the line starting at byte `offset` of an open binary file."""
+    f.seek(offset)
+    line = f.readline(_MAX_LINE_BYTES)
+    return line.decode("utf-8", errors="replace").rstrip()
+
+
+class _LogIndex:
+    """Incremental scan state for one log file.
+
+    Remembers the file's identity (device, inode and first bytes) and the
+    offset of the first line not yet parsed, so each refresh only reads bytes
+    appended since the last call; a rotated, replaced or truncated file is
+    rescanned from the start. Error and warning lines are kept as
+    (line number, byte offset) pairs and their text is read back on demand.
+    """
+
+    def __init__(self, path: str):
+        self.path = path
+        self.lock = threading.Lock()
+        self._reset(None)
+
+    def _reset(self, identity: Optional[Tuple[int, int]]) -> None:
+        self.identity = identity
+        self.head = b""
+        self.offset = 0
+        self.line_count = 0
+        self.errors: List[Tuple[int, int]] = []
+        self.warnings: List[Tuple[int, int]] = []
+        self.category_counts: Counter = Counter()
+        self.last_fatal_offset: Optional[int] = None
+
+    def refresh(self) -> None:
+        """Parse whatever complete lines were appended since the last refresh."""
+        st = os.stat(self.path)
+        identity = (st.st_dev, st.st_ino)
+        with open(self.path, "rb") as f:
+            if identity != self.identity or st.st_size < self.offset or f.read(len(self.head)) != self.head:
+                self._reset(identity)
+            if len(self.head) < _HEAD_BYTES:
+                f.seek(0)
+                self.head = f.read(_HEAD_BYTES)
+
+            f.seek(self.offset)
+            while True:
+                chunk = f.read(_SCAN_CHUNK)
+                if not chunk:
+                    break
+                end = chunk.rfind(b"\n") + 1
+                if end == 0:
+                    if len(chunk) < _SCAN_CHUNK:
+                        break  # an unfinished last line; parsed once it is complete
+                    end = len(chunk)  # a single enormous line
+                self._scan(chunk[:end])
+                self.offset += end
+                f.seek(self.offset)
+
+    def _scan(self, data: bytes) -> None:
+        """Index the complete lines in `data`, which starts at self.offset."""
+        base = self.offset
+        first_line = self.line_count + 1
+
+        error_starts = self._matching_lines(_ERROR_RE_B, data)
+        error_set = set(error_starts)
+        warning_starts = [p for p in self._matching_lines(_WARNING_RE_B, data) if p not in error_set]
+
+        for starts, target in ((error_starts, self.errors), (warning_starts, self.warnings)):
+            line, last = first_line, 0
+            for start in starts:
+                line += data.count(b"\n", last, start)
+                last = start
+                target.append((line, base + start))
+
+        fatal_starts = self._matching_lines(_FATAL_RE_B, data)
+        if fatal_starts:
+            self.last_fatal_offset = base + fatal_starts[-1]
+
+        self.category_counts.update(m.strip() for m in _CATEGORY_RE_B.findall(data))
+        self.line_count += data.count(b"\n")
+
+    @staticmethod
+    def _matching_lines(pattern: "re.Pattern", data: bytes) -> List[int]:
+        """Start offsets of the lines in `data` containing `pattern`, once per line."""
+        starts: List[int] = []
+        pos = 0
+        while True:
+            m = pattern.search(data, pos)
+            if not m:
+                return starts
+            start = data.rfind(b"\n", 0, m.start()) + 1
+            starts.append(start)
+            end = data.find(b"\n", m.end())
+            if end < 0:
+                return starts
+            pos = end + 1
+
+
+class _LineCounter:
+    """Newline count of one log file, kept current the same way as _LogIndex.
+
+    Only counts: one bytes.count per chunk and no pattern scans, so read_log_tail
+    can report total_lines without paying for a full error/category index.
+    """
+
+    def __init__(self, path: str):
+        self.path = path
+        self.lock = threading.Lock()
+        self.identity: Optional[Tuple[int, int]] = None
+        self.head = b""
+        self.offset = 0
+        self.line_count = 0
+
+    def refresh(self) -> None:
+        """Count the newlines appended since the last refresh."""
+        st = os.stat(self.path)
+        identity = (st.st_dev, st.st_ino)
+        with open(self.path, "rb") as f:
+            if identity != self.identity or st.st_size < self.offset or f.read(len(self.head)) != self.head:
+                self.identity, self.head, self.offset, self.line_count = identity, b"", 0, 0
+            if len(self.head) < _HEAD_BYTES:
+                f.seek(0)
+                self.head = f.read(_HEAD_BYTES)
+
+            f.seek(self.offset)
+            while True:
+                chunk = f.read(_SCAN_CHUNK)
+                if not chunk:
+                    break
+                self.line_count += chunk.count(b"\n")
+                self.offset += len(chunk)
+
+
+_indexes: "OrderedDict[str, _LogIndex]" = OrderedDict()
+_indexes_lock = threading.Lock()
+_line_counters: "OrderedDict[str, _LineCounter]" = OrderedDict()
+_line_counters_lock = threading.Lock()
+
+
+def _get_cached(table: OrderedDict, table_lock: threading.Lock, path: str, factory):
+    """Return the up-to-date entry for `path` in `table`, keeping the most recently used few."""
+    key = os.path.abspath(path)
+    with table_lock:
+        entry = table.get(key)
+        if entry is None:
+            entry = factory(key)
+            table[key] = entry
+            while len(table) > _MAX_INDEXED_FILES:
+                table.popitem(last=False)
+        else:
+            table.move_to_end(key)
+    with entry.lock:
+        entry.refresh()
+    return entry
+
+
+def _get_index(path: str) -> _LogIndex:
+    """Return the up-to-date index for `path`."""
+    return _get_cached(_indexes, _indexes_lock, path, _LogIndex)
+
+
+def _count_lines(path: str) -> int:
+    """Complete lines in `path`; only newly appended bytes are read after the first call."""
+    return _get_cached(_line_counters, _line_counters_lock, path, _LineCounter).line_count
+
+
+def _indexed_entries(f, entries: List[Tuple[int, int]]) -> List[Dict[str, Any]]:
+    """Read back indexed lines as {line, text, category, message} dicts."""
+    result: List[Dict[str, Any]] = []
+    for lineno, offset in entries:
+        text = _read_line_at(f, offset)
+        m = _LOG_RE.match(text)
+        result.append({
+            "line": lineno,
+            "text": text,
+            "category": m.group("category").strip() if m else "",
+            "message": m.group("message").strip() if m else text,
+        })
+    return result
 
 
 def _find_latest_log(project_dir: Optional[str] = None) -> Optional[str]:
@@ -89,10 +310,19 @@ def register_log_tools(mcp: FastMCP):
     ) -> Dict[str, Any]:
         """Read the last N lines from a UE log file.
 
+        Reads backwards from the end in blocks, so the cost depends on N, not
+        on the size of the log. total_lines comes from a newline counter that
+        only reads the bytes appended since the previous call; the first call
+        on a file counts it once, without the error/category scans of
+        analyze_log_errors / get_log_summary.
+
         Args:
             log_path: Absolute path to the log file. Auto-detected when omitted.
             lines: Number of tail lines to return (default 200).
             project_dir: Optional project directory for auto-detection.
+
+        Returns:
+            content, returned_lines, size_bytes and total_lines.
         """
         if not log_path:
             log_path = _find_latest_log(project_dir)
@@ -100,13 +330,13 @@ def register_log_tools(mcp: FastMCP):
             return make_error(f"Log file not found: {log_path}")
 
         try:
-            with open(log_path, "r", encoding="utf-8", errors="replace") as f:
-                all_lines = f.readlines()
-            tail = all_lines[-lines:]
+            tail = _read_tail(log_path, lines)
+            total_lines = _count_lines(log_path)
             return {
                 "success": True,
                 "log_path": log_path,
-                "total_lines": len(all_lines),
+                "total_lines": total_lines,
+                "size_bytes": os.path.getsize(log_path),
                 "returned_lines": len(tail),
                 "content": "".join(tail),
             }
@@ -119,51 +349,45 @@ def register_log_tools(mcp: FastMCP):
         log_path: Optional[str] = None,
         max_errors: int = 50,
         project_dir: Optional[str] = None,
+        latest: bool = False,
     ) -> Dict[str, Any]:
         """Extract errors and warnings from a UE log file.
 
+        Error and warning lines are indexed incrementally: the first call scans
+        the file once, later calls only parse what was appended since.
+
         Args:
             log_path: Absolute path to the log file. Auto-detected when omitted.
             max_errors: Maximum number of error/warning lines to return.
             project_dir: Optional project directory for auto-detection.
+            latest: Return the last max_errors errors/warnings instead of the first.
+
+        Returns:
+            errors, warnings (line, text, category, message), error_count and
+            warning_count (returned), total_errors and total_warnings (in the file).
         """
         if not log_path:
             log_path = _find_latest_log(project_dir)
         if not log_path or not os.path.isfile(log_path):
             return make_error(f"Log file not found: {log_path}")
 
-        errors: List[Dict[str, Any]] = []
-        warnings: List[Dict[str, Any]] = []
-
         try:
-            with open(log_path, "r", encoding="utf-8", errors="replace") as f:
-                for lineno, line in enumerate(f, 1):
-                    line_strip = line.rstrip()
-                    is_error = any(k in line_strip for k in _ERROR_KEYWORDS)
-                    is_warning = not is_error and any(k in line_strip for k in _WARNING_KEYWORDS)
-
-                    if is_error and len(errors) < max_errors:
-                        m = _LOG_RE.match(line_strip)
-                        errors.append({
-                            "line": lineno,
-                            "text": line_strip,
-                            "category": m.group("category").strip() if m else "",
-                            "message": m.group("message").strip() if m else line_strip,
-                        })
-                    elif is_warning and len(warnings) < max_errors:
-                        m = _LOG_RE.match(line_strip)
-                        warnings.append({
-                            "line": lineno,
-                            "text": line_strip,
-                            "category": m.group("category").strip() if m else "",
-                            "message": m.group("message").strip() if m else line_strip,
-                        })
+            index = _get_index(log_path)
+            with index.lock:
+                all_errors, all_warnings = list(index.errors), list(index.warnings)
+            pick = (lambda items: items[-max_errors:] if max_errors > 0 else []) if latest \
+                else (lambda items: items[:max(max_errors, 0)])
+            with open(log_path, "rb") as f:
+                errors = _indexed_entries(f, pick(all_errors))
+                warnings = _indexed_entries(f, pick(all_warnings))
 
             return {
                 "success": True,
                 "log_path": log_path,
                 "error_count": len(errors),
                 "warning_count": len(warnings),
+                "total_errors": len(all_errors),
+                "total_warnings": len(all_warnings),
                 "errors": errors,
                 "warnings": warnings,
             }
@@ -200,8 +424,10 @@ def register_log_tools(mcp: FastMCP):
         try:
             with open(log_path, "r", encoding="utf-8", errors="replace") as f:
                 for lineno, line in enumerate(f, 1):
-                    if compiled.search(line) and len(matches) < max_results:
+                    if compiled.search(line):
                         matches.append({"line": lineno, "text": line.rstrip()})
+                        if len(matches) >= max_results:
+                            break
 
             return {
                 "success": True,
@@ -230,31 +456,20 @@ def register_log_tools(mcp: FastMCP):
         if not log_path or not os.path.isfile(log_path):
             return make_error(f"Log file not found: {log_path}")
 
-        total_lines = 0
-        error_count = 0
-        warning_count = 0
-        last_fatal: Optional[str] = None
-        category_counts: Dict[str, int] = {}
-
         try:
-            with open(log_path, "r", encoding="utf-8", errors="replace") as f:
-                for line in f:
-                    total_lines += 1
-                    line_s = line.rstrip()
-                    m = _LOG_RE.match(line_s)
-                    if m:
-                        cat = m.group("category").strip()
-                        category_counts[cat] = category_counts.get(cat, 0) + 1
-
-                    if any(k in line_s for k in ["Fatal:", "fatal:", "Assertion failed"]):
-                        last_fatal = line_s
-                    if any(k in line_s for k in _ERROR_KEYWORDS):
-                        error_count += 1
-                    elif any(k in line_s for k in _WARNING_KEYWORDS):
-                        warning_count += 1
-
-            # Top 10 most active categories
-            top_categories = sorted(category_counts.items(), key=lambda x: -x[1])[:10]
+            index = _get_index(log_path)
+            with index.lock:
+                total_lines = index.line_count
+                error_count = len(index.errors)
+                warning_count = len(index.warnings)
+                last_fatal_offset = index.last_fatal_offset
+                # Top 10 most active categories
+                top_categories = index.category_counts.most_common(10)
+
+            last_fatal: Optional[str] = None
+            if last_fatal_offset is not None:
+                with open(log_path, "rb") as f:
+                    last_fatal = _read_line_at(f, last_fatal_offset)
 
             return {
                 "success": True,
@@ -263,9 +478,50 @@ def register_log_tools(mcp: FastMCP):
                 "error_count": error_count,
                 "warning_count": warning_count,
                 "last_fatal": last_fatal,
-                "top_categories": [{"category": c, "count": n} for c, n in top_categories],
+                "top_categories": [
+                    {"category": c.decode("utf-8", errors="replace"), "count": n} for c, n in top_categories
+                ],
             }
         except Exception as e:
             return make_error(f"Failed to summarize log: {e}")
 
+    @mcp.tool()
+    def query_editor_log(
+        ctx: Context,
+        category: Optional[List[str]] = None,
+        min_verbosity: Optional[str] = None,
+        contains: Optional[str] = None,
+        since: Optional[int] = None,
+        limit: int = 200,
+    ) -> Dict[str, Any]:
+        """Query the log lines the running editor captured in memory.
+
+        Unlike the file-based tools this sees lines not yet flushed to disk and
+        costs only the size of the result. The editor keeps the most recent
+        8192 lines.
+
+        Args:
+            category: Log categories to keep, e.g. ["LogBlueprint", "LogTemp"].
+            min_verbosity: Least severe verbosity to keep: Fatal, Error,
+                           Warning, Display, Log or Verbose.
+            contains: Case-insensitive substring the message must contain.
+            since: Only entries after this sequence number (oldest first); pass
+                   the previous response's next_since to poll incrementally.
+                   Without it the newest matching entries are returned.
+            limit: Maximum entries to return (max 5000).
+
+        Returns:
+            entries (seq, time, category, verbosity, message), next_since,
+            has_more, missed (entries after since were already overwritten).
+
+        Example:
+            query_editor_log(min_verbosity="Warning", since=last["next_since"])
+        """
+        params: Dict[str, Any] = {"limit": limit}
+        for key, value in (("category", category), ("min_verbosity", min_verbosity),
+                           ("contains", contains), ("since", since)):
+            if value is not None:
+                params[key] = value
+        return send_unreal_command("query_log", params)
+
     logger.info("Log tools registered successfully")
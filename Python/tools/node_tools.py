@@ -187,6 +187,69 @@ def register_blueprint_node_tools(mcp: FastMCP):
             "event_type": event_type,
         })
 
+    @mcp.tool()
+    def query_blueprint_nodes(
+        ctx: Context,
+        blueprint_name: str,
+        graph_name: str = None,
+        graph_type: str = None,
+        node_class: str = None,
+        title: str = None,
+        function: str = None,
+        variable: str = None,
+        pin_type: str = None,
+        connected: bool = None,
+        connected_to: str = None,
+        include_pins: bool = False,
+        limit: int = 200,
+    ) -> Dict[str, Any]:
+        """Query nodes across every graph of a Blueprint (event graphs, functions, macros).
+
+        All filters are optional and combine with AND.
+
+        Args:
+            blueprint_name: Name or path of the Blueprint.
+            graph_name: Only search the graph with this name.
+            graph_type: Only search graphs of this type: event, function, macro, delegate, subgraph.
+            node_class: Node class name, matched against the class hierarchy (e.g. "K2Node_CallFunction", "K2Node_Event").
+            title: Case-insensitive substring of the node title.
+            function: Function or event the node calls or implements (e.g. "PrintString", "ReceiveBeginPlay").
+            variable: Variable the node gets or sets.
+            pin_type: Pin category, sub-category or type object name that at least one pin must have
+                (e.g. "exec", "bool", "object", "Vector").
+            connected: True for nodes with at least one link, False for nodes with none.
+            connected_to: GUID of a node that matching nodes must be linked to.
+            include_pins: Include pins with their types, defaults and links.
+            limit: Maximum number of nodes returned (default 200).
+
+        Returns:
+            Dict with nodes (node_id, class, title, graph, graph_type, x, y, function, variable,
+            connected, pins), total_matched, truncated and graphs_searched.
+
+        Example:
+            query_blueprint_nodes("BP_Door", function="PrintString", include_pins=True)
+        """
+        params: Dict[str, Any] = {
+            "blueprint_name": blueprint_name,
+            "include_pins": include_pins,
+            "limit": limit,
+        }
+        for key, value in (
+            ("graph_name", graph_name),
+            ("graph_type", graph_type),
+            ("node_class", node_class),
+            ("title", title),
+            ("function", function),
+            ("variable", variable),
+            ("pin_type", pin_type),
+            ("connected_to", connected_to),
+        ):
+            if value:
+                params[key] = value
+        if connected is not None:
+            params["connected"] = connected
+        return send_unreal_command("query_blueprint_nodes", params)
+
     # ------------------------------------------------------------------
     # New node commands
     # ------------------------------------------------------------------
@@ -389,4 +452,57 @@ def register_blueprint_node_tools(mcp: FastMCP):
             "function_name": function_name,
         })
 
+    @mcp.tool()
+    def build_blueprint_graph(
+        ctx: Context,
+        blueprint_name: str,
+        nodes: List[Dict[str, Any]],
+        edges: List[Dict[str, Any]] = None,
+        graph_name: str = None,
+        origin: List[float] = None,
+        compile: bool = True,
+    ) -> Dict[str, Any]:
+        """Create a whole graph (nodes, pin defaults and links) in one call, then compile once.
+
+        Nodes are laid out automatically in columns following the edges, below any
+        existing nodes, unless a node gives its own position. If any node or edge
+        fails, nothing is added.
+
+        Args:
+            blueprint_name: Name or path of the Blueprint.
+            nodes: Node specs, each with a local "id" and a "type":
+                event (event_name), custom_event (event_name), function (function, target),
+                get_variable / set_variable (variable), branch, sequence (output_count),
+                cast (target_class), math (operation, math_type), print_string (message),
+                self, component (component_name), input_action (action_name).
+                Optional "position": [x, y] and "pins": {pin_name: default_value}.
+            edges: Links as {"from", "from_pin", "to", "to_pin"}. "from"/"to" are local ids
+                or GUIDs of existing nodes; an omitted pin means the exec pin.
+            graph_name: Target graph. Defaults to EventGraph.
+            origin: [X, Y] of the top-left node for auto layout.
+            compile: Compile the Blueprint after building (default True).
+
+        Returns:
+            Dict with nodes (local id -> node GUID), edges_connected, and compiled /
+            compile_status when compiling.
+
+        Example:
+            build_blueprint_graph("BP_Door",
+                nodes=[{"id": "begin", "type": "event", "event_name": "ReceiveBeginPlay"},
+                       {"id": "print", "type": "print_string", "message": "Opened"}],
+                edges=[{"from": "begin", "to": "print"}])
+        """
+        params: Dict[str, Any] = {
+            "blueprint_name": blueprint_name,
+            "nodes": nodes,
+            "compile": compile,
+        }
+        if edges:
+            params["edges"] = edges
+        if graph_name:
+            params["graph_name"] = graph_name
+        if origin:
+            params["origin"] = origin
+        return send_unreal_command("build_blueprint_graph", params)
+
     logger.info("Blueprint node tools registered successfully")
@@ -62,7 +62,7 @@ def register_umg_tools(mcp: FastMCP):
             font_size: Font size in points
             color: [R, G, B, A] color values (0.0 to 1.0)
             path: Optional directory where the Widget Blueprint is located.
-                  Defaults to '/Game/Widgets/' when omitted.
+                  When omitted, the name is resolved across the whole project.
         """
         params = {
             "blueprint_name": widget_name,
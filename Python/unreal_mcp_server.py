@@ -4,12 +4,17 @@ Unreal Engine MCP Server
 A simple MCP server for interacting with Unreal Engine.
 """
 
+import collections
 import logging
 import socket
+import struct
 import sys
 import json
+import threading
+import time
+from concurrent.futures import Future, TimeoutError as FutureTimeoutError
 from contextlib import asynccontextmanager
-from typing import AsyncIterator, Dict, Any, Optional
+from typing import AsyncIterator, Deque, Dict, Any, List, Optional, Tuple
 from mcp.server.fastmcp import FastMCP
 
 # Configure logging with more detailed format
@@ -27,209 +32,284 @@ logger = logging.getLogger("UnrealMCP")
 UNREAL_HOST = "127.0.0.1"
 UNREAL_PORT = 55557
 
+# Connections kept open to the editor. Concurrent tool calls each get their
+# own until POOL_SIZE are open, then pipeline on the least busy one.
+POOL_SIZE = 4
+CONNECT_TIMEOUT = 5  # seconds
+COMMAND_TIMEOUT = 300  # seconds to wait for a response
+
+# Requests and responses are framed as a 4-byte big-endian length followed by
+# that many bytes of UTF-8 JSON (see FMCPClientConnection in MCPServerRunnable.h).
+_FRAME_HEADER = struct.Struct(">I")
+MAX_REQUEST_BYTES = 64 * 1024 * 1024  # the editor's limit
+
+
+def _error_response(message: str) -> Dict[str, Any]:
+    return {"status": "error", "error": message}
+
+
+def _normalize_response(command: str, response: Dict[str, Any]) -> Dict[str, Any]:
+    """Bring both error formats to {"status": "error", "error": ...}."""
+    # Check for both error formats: {"status": "error", ...} and {"success": false, ...}
+    if response.get("status") == "error":
+        error_message = response.get("error") or response.get("message", "Unknown Unreal error")
+        logger.error(f"Unreal error in {command} (status=error): {error_message}")
+        # We want to preserve the original error structure but ensure error is accessible
+        if "error" not in response:
+            response["error"] = error_message
+    elif response.get("success") is False:
+        # This format uses {"success": false, "error": "message"} or {"success": false, "message": "message"}
+        error_message = response.get("error") or response.get("message", "Unknown Unreal error")
+        logger.error(f"Unreal error in {command} (success=false): {error_message}")
+        # Convert to the standard format expected by higher layers
+        response = _error_response(error_message)
+    return response
+
+
 class UnrealConnection:
-    """Connection to an Unreal Engine instance."""
-    
+    """One persistent, framed connection to an Unreal Engine instance.
+
+    Requests are written as soon as they are submitted, without waiting for
+    earlier ones (pipelining). The editor answers a connection's requests in
+    order, so a reader thread hands each response frame to the oldest
+    waiting request. A connection is not reopened once closed; the pool
+    replaces it.
+    """
+
     def __init__(self):
         """Initialize the connection."""
         self.socket = None
         self.connected = False
-    
+        # Requests handed out by the pool but not submitted yet (guarded by the pool's lock)
+        self.users = 0
+        self._send_lock = threading.Lock()
+        self._pending: Deque[Future] = collections.deque()
+
+    @property
+    def load(self) -> int:
+        """Requests using or waiting on this connection."""
+        return self.users + len(self._pending)
+
     def connect(self) -> bool:
-        """Connect to the Unreal Engine instance."""
+        """Connect to the Unreal Engine instance and start reading responses."""
         try:
-            # Close any existing socket
-            if self.socket:
-                try:
-                    self.socket.close()
-                except:
-                    pass
-                self.socket = None
-            
             logger.info(f"Connecting to Unreal at {UNREAL_HOST}:{UNREAL_PORT}...")
-            self.socket = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
-            self.socket.settimeout(5)  # 5 second timeout
-            
+            sock = socket.create_connection((UNREAL_HOST, UNREAL_PORT), timeout=CONNECT_TIMEOUT)
+
             # Set socket options for better stability
-            self.socket.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
-            self.socket.setsockopt(socket.SOL_SOCKET, socket.SO_KEEPALIVE, 1)
-            
+            sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            sock.setsockopt(socket.SOL_SOCKET, socket.SO_KEEPALIVE, 1)
+
             # Set larger buffer sizes
-            self.socket.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 65536)
-            self.socket.setsockopt(socket.SOL_SOCKET, socket.SO_SNDBUF, 65536)
-            
-            self.socket.connect((UNREAL_HOST, UNREAL_PORT))
-            self.connected = True
-            logger.info("Connected to Unreal Engine")
-            return True
-            
-        except Exception as e:
+            sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 65536)
+            sock.setsockopt(socket.SOL_SOCKET, socket.SO_SNDBUF, 65536)
+
+            # The reader blocks until a response arrives; callers time out on their futures
+            sock.settimeout(None)
+        except OSError as e:
             logger.error(f"Failed to connect to Unreal: {e}")
-            self.connected = False
             return False
-    
+
+        self.socket = sock
+        self.connected = True
+        threading.Thread(target=self._read_loop, args=(sock,), name="UnrealMCPReader", daemon=True).start()
+        logger.info("Connected to Unreal Engine")
+        return True
+
     def disconnect(self):
-        """Disconnect from the Unreal Engine instance."""
-        if self.socket:
+        """Close the connection; requests still waiting fail with ConnectionError."""
+        self.connected = False
+        sock = self.socket
+        if sock:
             try:
-                self.socket.close()
-            except:
+                # Wakes the reader thread, which fails the pending requests
+                sock.shutdown(socket.SHUT_RDWR)
+            except OSError:
                 pass
-        self.socket = None
-        self.connected = False
 
-    def receive_full_response(self, sock, buffer_size=4096) -> bytes:
-        """Receive a complete response from Unreal, handling chunked data."""
-        chunks = []
-        sock.settimeout(5)  # 5 second timeout
+    def submit(self, command: str, params: Dict[str, Any] = None) -> Future:
+        """Write one request and return a future for its raw JSON response.
+
+        Raises OSError when the request could not be written; the connection
+        is closed in that case.
+        """
+        body = json.dumps({"type": command, "params": params or {}}).encode("utf-8")
+        future: Future = Future()
+        if len(body) > MAX_REQUEST_BYTES:
+            future.set_exception(ValueError(f"{command} request is {len(body)} bytes, over the {MAX_REQUEST_BYTES} byte limit"))
+            return future
+
+        with self._send_lock:
+            if not self.connected:
+                raise ConnectionError("Connection to Unreal Engine is closed")
+            # Queued before writing so the reader can never see a response without its request
+            self._pending.append(future)
+            try:
+                self.socket.sendall(_FRAME_HEADER.pack(len(body)) + body)
+            except OSError:
+                # A partly written frame leaves the stream unusable
+                self.disconnect()
+                raise
+
+        logger.debug(f"Sent {command} ({len(body)} bytes, {len(self._pending)} in flight)")
+        return future
+
+    def _read_loop(self, sock: socket.socket):
+        """Read response frames until the connection closes, resolving requests in order."""
+        error: Optional[Exception] = None
+        stream = sock.makefile("rb")
         try:
             while True:
-                chunk = sock.recv(buffer_size)
-                if not chunk:
-                    if not chunks:
-                        raise Exception("Connection closed before receiving data")
+                header = stream.read(_FRAME_HEADER.size)
+                if len(header) < _FRAME_HEADER.size:
                     break
-                chunks.append(chunk)
-                
-                # Process the data received so far
-                data = b''.join(chunks)
-                decoded_data = data.decode('utf-8')
-                
-                # Try to parse as JSON to check if complete
-                try:
-                    json.loads(decoded_data)
-                    logger.info(f"Received complete response ({len(data)} bytes)")
-                    return data
-                except json.JSONDecodeError:
-                    # Not complete JSON yet, continue reading
-                    logger.debug(f"Received partial response, waiting for more data...")
-                    continue
-                except Exception as e:
-                    logger.warning(f"Error processing response chunk: {str(e)}")
-                    continue
-        except socket.timeout:
-            logger.warning("Socket timeout during receive")
-            if chunks:
-                # If we have some data already, try to use it
-                data = b''.join(chunks)
-                try:
-                    json.loads(data.decode('utf-8'))
-                    logger.info(f"Using partial response after timeout ({len(data)} bytes)")
-                    return data
-                except:
-                    pass
-            raise Exception("Timeout receiving Unreal response")
-        except Exception as e:
-            logger.error(f"Error during receive: {str(e)}")
-            raise
-    
-    def send_command(self, command: str, params: Dict[str, Any] = None) -> Optional[Dict[str, Any]]:
-        """Send a command to Unreal Engine and get the response."""
-        # Always reconnect for each command, since Unreal closes the connection after each command
-        # This is different from Unity which keeps connections alive
-        if self.socket:
+                (length,) = _FRAME_HEADER.unpack(header)
+                payload = stream.read(length)
+                if len(payload) < length:
+                    break
+                if not self._pending:
+                    error = ConnectionError("Unexpected response from Unreal Engine")
+                    break
+                self._pending.popleft().set_result(payload)
+        except (OSError, ValueError) as e:
+            error = e
+        finally:
+            stream.close()
+            self._close(sock, error)
+
+    def _close(self, sock: socket.socket, error: Optional[Exception]):
+        with self._send_lock:
+            self.connected = False
+            self.socket = None
             try:
-                self.socket.close()
-            except:
+                sock.close()
+            except OSError:
                 pass
-            self.socket = None
-            self.connected = False
-        
-        if not self.connect():
-            logger.error("Failed to connect to Unreal Engine for command")
+            if self._pending:
+                logger.warning(f"Connection to Unreal Engine closed with {len(self._pending)} request(s) in flight: {error}")
+            while self._pending:
+                self._pending.popleft().set_exception(
+                    ConnectionError(f"Connection to Unreal Engine closed: {error}" if error else "Connection to Unreal Engine closed"))
+
+
+class UnrealConnectionPool:
+    """Persistent connections to the editor shared by all tool calls.
+
+    A call takes an idle connection, opening a new one while fewer than
+    POOL_SIZE are open, so commands the editor runs off the game thread can
+    execute concurrently. Once every connection is busy, requests are
+    pipelined on the least loaded one. Closed connections (e.g. after an
+    editor restart) are dropped and replaced on the next call.
+    """
+
+    def __init__(self, size: int = POOL_SIZE):
+        self.size = size
+        self._lock = threading.Lock()
+        self._connections: List[UnrealConnection] = []
+
+    def connect(self) -> bool:
+        """Make sure at least one connection is open."""
+        with self._lock:
+            self._connections = [c for c in self._connections if c.connected]
+            return bool(self._connections) or self._open() is not None
+
+    def disconnect(self):
+        """Close every connection."""
+        with self._lock:
+            connections, self._connections = self._connections, []
+        for connection in connections:
+            connection.disconnect()
+
+    def send_command(self, command: str, params: Dict[str, Any] = None,
+                     timeout: float = COMMAND_TIMEOUT) -> Dict[str, Any]:
+        """Send a command to Unreal Engine and get the response."""
+        return self.send_commands([(command, params)], timeout)[0]
+
+    def send_commands(self, commands: List[Tuple[str, Optional[Dict[str, Any]]]],
+                      timeout: float = COMMAND_TIMEOUT) -> List[Dict[str, Any]]:
+        """Send (command, params) pairs back to back on one connection.
+
+        Every request is written before the first response is awaited, so
+        the round trips overlap; the editor still runs them one after
+        another. Unlike the "batch" command, each gets its own response,
+        returned in order. `timeout` covers the whole sequence.
+        """
+        for attempt in range(2):
+            connection = self._acquire()
+            if connection is None:
+                return [_error_response("Failed to connect to Unreal Engine") for _ in commands]
+
+            futures: List[Future] = []
+            send_error: Optional[OSError] = None
+            try:
+                for command, params in commands:
+                    futures.append(connection.submit(command, params))
+            except OSError as e:
+                send_error = e
+            finally:
+                self._release(connection)
+
+            if send_error is not None and not futures and attempt == 0:
+                # Nothing reached the editor (typically a connection it closed
+                # when restarting), so a fresh connection can safely retry
+                logger.warning(f"Unreal connection failed ({send_error}), reconnecting")
+                continue
+
+            deadline = time.monotonic() + timeout
+            responses = [self._wait(command, future, deadline, timeout)
+                         for (command, _), future in zip(commands, futures)]
+            responses.extend(_error_response(f"Error sending command: {send_error}")
+                             for _ in commands[len(futures):])
+            return responses
+
+    def _acquire(self) -> Optional[UnrealConnection]:
+        with self._lock:
+            self._connections = [c for c in self._connections if c.connected]
+            connection = min(self._connections, key=lambda c: c.load, default=None)
+            if connection is None or (connection.load > 0 and len(self._connections) < self.size):
+                connection = self._open() or connection
+            if connection is not None:
+                connection.users += 1
+            return connection
+
+    def _release(self, connection: UnrealConnection):
+        with self._lock:
+            connection.users -= 1
+
+    def _open(self) -> Optional[UnrealConnection]:
+        """Open and add a connection; called with the lock held."""
+        connection = UnrealConnection()
+        if not connection.connect():
             return None
-        
+        self._connections.append(connection)
+        return connection
+
+    @staticmethod
+    def _wait(command: str, future: Future, deadline: float, timeout: float) -> Dict[str, Any]:
         try:
-            # Match Unity's command format exactly
-            command_obj = {
-                "type": command,  # Use "type" instead of "command"
-                "params": params or {}  # Use Unity's params or {} pattern
-            }
-            
-            # Send without newline, exactly like Unity
-            command_json = json.dumps(command_obj)
-            logger.info(f"Sending command: {command_json}")
-            self.socket.sendall(command_json.encode('utf-8'))
-            
-            # Read response using improved handler
-            response_data = self.receive_full_response(self.socket)
-            response = json.loads(response_data.decode('utf-8'))
-            
-            # Log complete response for debugging
-            logger.info(f"Complete response from Unreal: {response}")
-            
-            # Check for both error formats: {"status": "error", ...} and {"success": false, ...}
-            if response.get("status") == "error":
-                error_message = response.get("error") or response.get("message", "Unknown Unreal error")
-                logger.error(f"Unreal error (status=error): {error_message}")
-                # We want to preserve the original error structure but ensure error is accessible
-                if "error" not in response:
-                    response["error"] = error_message
-            elif response.get("success") is False:
-                # This format uses {"success": false, "error": "message"} or {"success": false, "message": "message"}
-                error_message = response.get("error") or response.get("message", "Unknown Unreal error")
-                logger.error(f"Unreal error (success=false): {error_message}")
-                # Convert to the standard format expected by higher layers
-                response = {
-                    "status": "error",
-                    "error": error_message
-                }
-            
-            # Always close the connection after command is complete
-            # since Unreal will close it on its side anyway
-            try:
-                self.socket.close()
-            except:
-                pass
-            self.socket = None
-            self.connected = False
-            
-            return response
-            
+            payload = future.result(timeout=max(0.0, deadline - time.monotonic()))
+            response = json.loads(payload)
+        except FutureTimeoutError:
+            # The response is still matched to this request if it arrives later
+            logger.error(f"Timed out waiting for Unreal response to {command}")
+            return _error_response(f"Timed out after {timeout:g}s waiting for Unreal Engine")
         except Exception as e:
-            logger.error(f"Error sending command: {e}")
-            # Always reset connection state on any error
-            self.connected = False
-            try:
-                self.socket.close()
-            except:
-                pass
-            self.socket = None
-            return {
-                "status": "error",
-                "error": str(e)
-            }
+            logger.error(f"Error sending command {command}: {e}")
+            return _error_response(str(e))
+
+        logger.debug(f"Received {command} response ({len(payload)} bytes)")
+        return _normalize_response(command, response)
+
 
-# Global connection state
-_unreal_connection: UnrealConnection = None
+# Global connection pool; connections are opened on first use
+_unreal_connection = UnrealConnectionPool()
 
-def get_unreal_connection() -> Optional[UnrealConnection]:
-    """Get the connection to Unreal Engine."""
-    global _unreal_connection
+def get_unreal_connection() -> Optional[UnrealConnectionPool]:
+    """Get the connection pool, or None when Unreal Engine cannot be reached."""
     try:
-        if _unreal_connection is None:
-            _unreal_connection = UnrealConnection()
-            if not _unreal_connection.connect():
-                logger.warning("Could not connect to Unreal Engine")
-                _unreal_connection = None
-        else:
-            # Verify connection is still valid with a ping-like test
-            try:
-                # Simple test by sending an empty buffer to check if socket is still connected
-                _unreal_connection.socket.sendall(b'\x00')
-                logger.debug("Connection verified with ping test")
-            except Exception as e:
-                logger.warning(f"Existing connection failed: {e}")
-                _unreal_connection.disconnect()
-                _unreal_connection = None
-                # Try to reconnect
-                _unreal_connection = UnrealConnection()
-                if not _unreal_connection.connect():
-                    logger.warning("Could not reconnect to Unreal Engine")
-                    _unreal_connection = None
-                else:
-                    logger.info("Successfully reconnected to Unreal Engine")
-        
+        if not _unreal_connection.connect():
+            logger.warning("Could not connect to Unreal Engine")
+            return None
         return _unreal_connection
     except Exception as e:
         logger.error(f"Error getting Unreal connection: {e}")
@@ -238,24 +318,16 @@ def get_unreal_connection() -> Optional[UnrealConnection]:
 @asynccontextmanager
 async def server_lifespan(server: FastMCP) -> AsyncIterator[Dict[str, Any]]:
     """Handle server startup and shutdown."""
-    global _unreal_connection
     logger.info("UnrealMCP server starting up")
-    try:
-        _unreal_connection = get_unreal_connection()
-        if _unreal_connection:
-            logger.info("Connected to Unreal Engine on startup")
-        else:
-            logger.warning("Could not connect to Unreal Engine on startup")
-    except Exception as e:
-        logger.error(f"Error connecting to Unreal Engine on startup: {e}")
-        _unreal_connection = None
-    
+    if get_unreal_connection():
+        logger.info("Connected to Unreal Engine on startup")
+    else:
+        logger.warning("Could not connect to Unreal Engine on startup")
+
     try:
         yield {}
     finally:
-        if _unreal_connection:
-            _unreal_connection.disconnect()
-            _unreal_connection = None
+        _unreal_connection.disconnect()
         logger.info("Unreal MCP server shut down")
 
 # Initialize server
@@ -351,7 +423,7 @@ def info():
     - `get_viewport_camera_info()` - Viewport camera location/rotation/FOV
     - `get_actor_screen_position(name)` - Actor pixel position in viewport
     - `highlight_actor(name)` - Select + focus viewport on actor
-    - `take_and_read_screenshot(filepath=None)` - Screenshot + base64 PNG
+    - `take_and_read_screenshot(filepath=None, format, quality, max_width)` - Screenshot + inline base64 PNG/JPEG
     - `capture_actor_focused(name, filepath=None)` - Highlight then screenshot
     - `get_scene_overview()` - One-shot scene snapshot (camera + actors + PNG)
 
@@ -361,10 +433,12 @@ def info():
     - `analyze_log_errors(log_path=None, max_errors=50)` - Extract errors/warnings
     - `search_log(pattern, log_path=None, max_results=100)` - Regex search in log
     - `get_log_summary(log_path=None)` - Compact stats + top categories
+    - `query_editor_log(category=None, min_verbosity=None, contains=None, since=None)` - In-memory editor log (live, incremental)
 
     ### Compile Management
-    - `read_cpp_file(path)` - Read C++ source file (project-relative)
-    - `write_cpp_file(path, content)` - Write C++ source file (auto-backup)
+    - `read_cpp_file(path, start_line=None, max_lines=None, if_hash=None)` - Read C++ source (line/byte ranges, content hash)
+    - `search_cpp_source(pattern, regex=False, include=None, context_lines=0)` - Search project C++ sources
+    - `write_cpp_file(path, patch=None, edits=None, base_hash=None, content=None)` - Patch/replace C++ source (atomic, deduplicated backups)
     - `read_python_tool(tool_name)` - Read a Python tool module source
     - `write_python_tool(tool_name, content)` - Write Python tool (auto-backup)
     - `reload_python_tool(tool_name)` - Hot-reload Python tool without MCP restart